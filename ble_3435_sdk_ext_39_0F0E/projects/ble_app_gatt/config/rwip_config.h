@@ -706,6 +706,7 @@ enum KE_EVENT_TYPE
     #endif // CFG_AUDIO_RSA
     
     #if SECURE_CONNECTIONS
+    // unused, ECC steps run as co_job; kept so that the ROM event numbering does not move
     KE_EVENT_ECC_MULTIPLICATION,
     #endif // SECURE_CONNECTIONS
 
@@ -99,6 +99,8 @@
 #include "ke_mem.h"          // kernel memory manager
 #endif //KE_SUPPORT
 
+#include "co_job.h"          // background jobs
+
 #if (SECURE_CONNECTIONS && (BT_EMB_PRESENT || BLE_EMB_PRESENT))
 #include "ecc_p256.h"        // ECC P256 library
 #endif // (SECURE_CONNECTIONS && (BT_EMB_PRESENT || BLE_EMB_PRESENT))
@@ -408,6 +410,9 @@ void rwip_init(uint32_t error)
     #endif //BT_EMB_PRESENT || BLE_EMB_PRESENT
 	
 
+    // Initialize background jobs
+    co_job_init(false);
+
     #if (SECURE_CONNECTIONS && (BT_EMB_PRESENT || BLE_EMB_PRESENT))
     // Initialize Diffie Hellman Elliptic Curve Algorithm
     ecc_init(false);
@@ -554,6 +559,9 @@ void rwip_reset(void)
     ecc_init(true);
     #endif // (SECURE_CONNECTIONS && (BT_EMB_PRESENT || BLE_EMB_PRESENT))
 
+    // Drop the background jobs, their owners have been reset above
+    co_job_init(true);
+
     #if (HCI_PRESENT)
     // Reset the HCI
     hci_reset();
@@ -635,7 +643,9 @@ void rwip_schedule(void)
     {
         // schedule all pending events
         ke_event_schedule();
-			  
+
+        // give the idle time left before the next radio event to background jobs
+        co_job_schedule();
     }
     #endif //KE_SUPPORT
 }
@@ -657,6 +667,10 @@ uint8_t rwip_sleep(void)
         // Check if some kernel processing is ongoing
         if (!ke_sleep_check())
             break;
+
+        // Check if some background job is ongoing
+        if (co_job_is_pending())
+            break;
 				
         //Processor sleep can be enabled
         proc_sleep |= RW_MCU_IDLE_SLEEP;
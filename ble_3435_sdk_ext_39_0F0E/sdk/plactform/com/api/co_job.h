@@ -0,0 +1,177 @@
+/**
+ ****************************************************************************************
+ *
+ * @file co_job.h
+ *
+ * @brief Cooperative background jobs run in the idle time between radio events
+ *
+ * Copyright (C) RivieraWaves 2009-2015
+ *
+ ****************************************************************************************
+ */
+
+#ifndef _CO_JOB_H_
+#define _CO_JOB_H_
+
+/**
+ *****************************************************************************************
+ * @defgroup CO_JOB Background jobs
+ * @ingroup COMMON
+ *
+ * @brief Budgeted time-slicing of long operations.
+ *
+ * A long operation (ECC point multiplication, full image CRC, ...) is split by its owner
+ * into short steps. co_job_schedule() is called from rwip_schedule() once the kernel
+ * events are handled and runs as many steps of the first pending job as fit in
+ * min(job budget, time left before the next programmed radio event). The job is then
+ * moved at the end of the list so that several jobs share the CPU.
+ *
+ * By default the first step of a slice always runs, the radio interrupt preempts it
+ * if needed. Jobs which stall the CPU (flash erase/program while running from flash)
+ * use CO_JOB_FLAG_NO_OVERLAP: their steps wait for a gap large enough.
+ * @{
+ *****************************************************************************************
+ */
+
+/*
+ * INCLUDE FILES
+ ****************************************************************************************
+ */
+#include <stdint.h>         // standard definition
+#include <stdbool.h>        // boolean definition
+#include "co_list.h"        // list definition
+
+/*
+ * DEFINES
+ ****************************************************************************************
+ */
+
+/// Time kept free before the next radio event, in us (one slot for event programming)
+#ifndef CO_JOB_GUARD_US
+#define CO_JOB_GUARD_US             (625)
+#endif
+
+/// Max time a job may be held back because its step does not fit in the idle window, in us
+#ifndef CO_JOB_MAX_WAIT_US
+#define CO_JOB_MAX_WAIT_US          (30000)
+#endif
+
+/// Idle window returned by the clock when no radio event is programmed
+#define CO_JOB_IDLE_UNBOUNDED       (0xFFFFFFFF)
+
+/// Job flags
+enum co_job_flag
+{
+    /// A step shall not overlap the next radio event
+    CO_JOB_FLAG_NO_OVERLAP      = (1 << 0),
+};
+
+/*
+ * TYPE DEFINITIONS
+ ****************************************************************************************
+ */
+
+/**
+ * Job step callback, does one bounded piece of work.
+ *
+ * @return true when the job is complete, false if more steps are needed
+ */
+typedef bool (*co_job_step_t)(void *p_env);
+
+/// Job completion callback, called once after the last step (the job may be freed here)
+typedef void (*co_job_done_t)(void *p_env);
+
+/// Time source, in us
+struct co_job_clock
+{
+    /// Free running time
+    uint32_t (*now_us)(void);
+    /// Time left before the next radio event, CO_JOB_IDLE_UNBOUNDED if none
+    uint32_t (*idle_us)(void);
+};
+
+/// Background job, embedded in the owner's environment
+struct co_job
+{
+    /// List header for chaining in the job list
+    struct co_list_hdr hdr;
+    /// Step function
+    co_job_step_t step;
+    /// Completion function, may be NULL
+    co_job_done_t done;
+    /// Owner environment passed to the callbacks
+    void *p_env;
+    /// Max time the job may hold the CPU per schedule, in us
+    uint32_t budget_us;
+    /// Running estimate of one step duration, in us
+    uint32_t step_us;
+    /// Time of the last step, in us
+    uint32_t last_us;
+    /// Flags, see enum co_job_flag
+    uint8_t flags;
+};
+
+/*
+ * FUNCTION DECLARATIONS
+ ****************************************************************************************
+ */
+
+/**
+ ****************************************************************************************
+ * @brief Initialize the job list
+ *
+ * @param[in] reset  True on stack reset: pending jobs are dropped without completion,
+ *                   their owners are responsible for freeing them.
+ ****************************************************************************************
+ */
+void co_job_init(bool reset);
+
+/**
+ ****************************************************************************************
+ * @brief Select the time source, NULL restores the radio timer based default.
+ ****************************************************************************************
+ */
+void co_job_clock_set(const struct co_job_clock *clock);
+
+/**
+ ****************************************************************************************
+ * @brief Queue a job
+ *
+ * @param[in] job        Job to start, must stay allocated until done or aborted
+ * @param[in] step       Step function
+ * @param[in] done       Completion function, may be NULL
+ * @param[in] p_env      Environment passed to step and done
+ * @param[in] budget_us  Max time per schedule, at least one step is run per slice
+ * @param[in] step_us    Initial estimate of one step, refined on the fly (0 if unknown)
+ * @param[in] flags      See enum co_job_flag
+ ****************************************************************************************
+ */
+void co_job_start(struct co_job *job, co_job_step_t step, co_job_done_t done, void *p_env,
+                  uint32_t budget_us, uint32_t step_us, uint8_t flags);
+
+/**
+ ****************************************************************************************
+ * @brief Remove a job without calling its completion function
+ *
+ * @return true if the job was pending
+ ****************************************************************************************
+ */
+bool co_job_abort(struct co_job *job);
+
+/**
+ ****************************************************************************************
+ * @brief Check if some job is pending (the processor shall not sleep)
+ ****************************************************************************************
+ */
+bool co_job_is_pending(void);
+
+/**
+ ****************************************************************************************
+ * @brief Run one time slice of the first pending job
+ ****************************************************************************************
+ */
+void co_job_schedule(void);
+
+/// @} CO_JOB
+
+#endif // _CO_JOB_H_
@@ -0,0 +1,283 @@
+/**
+ ****************************************************************************************
+ *
+ * @file co_job.c
+ *
+ * @brief Cooperative background jobs run in the idle time between radio events
+ *
+ * Copyright (C) RivieraWaves 2009-2015
+ *
+ ****************************************************************************************
+ */
+
+/**
+ ****************************************************************************************
+ * @addtogroup CO_JOB
+ * @{
+ ****************************************************************************************
+ */
+
+/*
+ * INCLUDE FILES
+ ****************************************************************************************
+ */
+#include "rwip_config.h"    // stack configuration
+#include <stddef.h>         // for NULL
+#include "co_job.h"         // job definitions
+#include "co_list.h"        // list management
+#include "co_math.h"        // co_min
+
+#if (BLE_EMB_PRESENT)
+#include "co_bt.h"          // SLOT_SIZE
+#include "rwip.h"           // RWIP_INVALID_TARGET_TIME
+#include "ea.h"             // next programmed radio event
+#include "lld_evt.h"        // radio base time
+#include "reg_blecore.h"    // BLE_BASETIMECNT_MASK
+#endif //(BLE_EMB_PRESENT)
+
+/*
+ * TYPE DEFINITIONS
+ ****************************************************************************************
+ */
+
+/// Job environment
+struct co_job_env_tag
+{
+    /// Pending jobs, the first one runs next
+    struct co_list pending;
+    /// Time source, NULL: one step per schedule
+    const struct co_job_clock *clock;
+    /// Idle window at the previous schedule, in us
+    uint32_t last_idle;
+
+    #if (BLE_EMB_PRESENT)
+    /// Accumulated radio time, in us
+    uint32_t time_us;
+    /// Base time counter at last sample, in slots
+    uint32_t last_slot;
+    /// Fine time counter at last sample (counts down from SLOT_SIZE - 1)
+    uint32_t last_fine;
+    #endif //(BLE_EMB_PRESENT)
+};
+
+/*
+ * LOCAL FUNCTION DECLARATIONS
+ ****************************************************************************************
+ */
+#if (BLE_EMB_PRESENT)
+static uint32_t co_job_radio_now_us(void);
+static uint32_t co_job_radio_idle_us(void);
+#endif //(BLE_EMB_PRESENT)
+
+/*
+ * GLOBAL VARIABLE DEFINITIONS
+ ****************************************************************************************
+ */
+
+/// Job environment
+static struct co_job_env_tag co_job_env;
+
+#if (BLE_EMB_PRESENT)
+/// Default time source: BLE base/fine time counters and exchange table
+static const struct co_job_clock co_job_radio_clock =
+{
+    .now_us  = co_job_radio_now_us,
+    .idle_us = co_job_radio_idle_us,
+};
+#endif //(BLE_EMB_PRESENT)
+
+/*
+ * LOCAL FUNCTION DEFINITIONS
+ ****************************************************************************************
+ */
+#if (BLE_EMB_PRESENT)
+/**
+ ****************************************************************************************
+ * @brief Free running time in us.
+ *
+ * Accumulated from the slot counter deltas so that it wraps at 2^32 like any other
+ * uint32_t time, whatever the base time counter width.
+ ****************************************************************************************
+ */
+static uint32_t co_job_radio_now_us(void)
+{
+    uint32_t slot, fine;
+
+    lld_evt_time_get_us(&slot, &fine);
+
+    co_job_env.time_us += ((slot - co_job_env.last_slot) & BLE_BASETIMECNT_MASK) * SLOT_SIZE;
+    co_job_env.time_us += co_job_env.last_fine - fine;
+    co_job_env.last_slot = slot;
+    co_job_env.last_fine = fine;
+
+    return co_job_env.time_us;
+}
+
+/**
+ ****************************************************************************************
+ * @brief Time left before the next event programmed in the exchange table, in us.
+ ****************************************************************************************
+ */
+static uint32_t co_job_radio_idle_us(void)
+{
+    uint32_t slot, fine;
+    uint32_t target;
+    uint32_t delta;
+
+    lld_evt_time_get_us(&slot, &fine);
+    target = ea_timer_target_get(slot);
+
+    if (target == RWIP_INVALID_TARGET_TIME)
+        return CO_JOB_IDLE_UNBOUNDED;
+
+    // Target reached or passed: the event is ongoing
+    delta = (target - slot) & BLE_BASETIMECNT_MASK;
+    if ((delta == 0) || (delta > (BLE_BASETIMECNT_MASK >> 1)))
+        return 0;
+
+    // Remaining part of the current slot plus the full slots up to the target
+    return ((delta - 1) * SLOT_SIZE) + fine;
+}
+#endif //(BLE_EMB_PRESENT)
+
+/**
+ ****************************************************************************************
+ * @brief Refine the step duration estimate: follow increases at once, decreases slowly.
+ ****************************************************************************************
+ */
+static void co_job_step_update(struct co_job *job, uint32_t spent_us)
+{
+    if (spent_us >= job->step_us)
+    {
+        job->step_us = spent_us;
+    }
+    else
+    {
+        job->step_us -= (job->step_us - spent_us) >> 3;
+    }
+}
+
+/*
+ * GLOBAL FUNCTION DEFINITIONS
+ ****************************************************************************************
+ */
+void co_job_init(bool reset)
+{
+    // On reset the owners free their jobs, only forget them here
+    co_list_init(&co_job_env.pending);
+
+    if (!reset)
+    {
+        co_job_clock_set(NULL);
+    }
+}
+
+void co_job_clock_set(const struct co_job_clock *clock)
+{
+    #if (BLE_EMB_PRESENT)
+    // The radio time origin is arbitrary, only differences are used
+    if (clock == NULL)
+    {
+        clock = &co_job_radio_clock;
+    }
+    #endif //(BLE_EMB_PRESENT)
+
+    co_job_env.clock = clock;
+}
+
+void co_job_start(struct co_job *job, co_job_step_t step, co_job_done_t done, void *p_env,
+                  uint32_t budget_us, uint32_t step_us, uint8_t flags)
+{
+    job->step      = step;
+    job->done      = done;
+    job->p_env     = p_env;
+    job->budget_us = budget_us;
+    job->step_us   = step_us;
+    job->flags     = flags;
+    job->last_us   = (co_job_env.clock != NULL) ? co_job_env.clock->now_us() : 0;
+
+    co_list_push_back(&co_job_env.pending, &job->hdr);
+}
+
+bool co_job_abort(struct co_job *job)
+{
+    return co_list_extract(&co_job_env.pending, &job->hdr, 0);
+}
+
+bool co_job_is_pending(void)
+{
+    return !co_list_is_empty(&co_job_env.pending);
+}
+
+void co_job_schedule(void)
+{
+    const struct co_job_clock *clock = co_job_env.clock;
+    struct co_job *job = (struct co_job *) co_list_pick(&co_job_env.pending);
+    bool done = false;
+
+    if (job == NULL)
+        return;
+
+    if (clock == NULL)
+    {
+        // No time source, one step per schedule
+        done = job->step(job->p_env);
+    }
+    else
+    {
+        uint32_t start = clock->now_us();
+        uint32_t idle = clock->idle_us();
+        uint32_t window = job->budget_us;
+        uint32_t now = start;
+        // The idle window only grows once a radio event is over: no larger gap to wait for
+        bool gap_start = (idle > co_job_env.last_idle) || (idle == CO_JOB_IDLE_UNBOUNDED);
+
+        co_job_env.last_idle = idle;
+
+        if (idle != CO_JOB_IDLE_UNBOUNDED)
+        {
+            idle = (idle > CO_JOB_GUARD_US) ? (idle - CO_JOB_GUARD_US) : 0;
+            window = co_min(window, idle);
+        }
+
+        // A step that shall not overlap the next radio event waits for the following gap,
+        // unless this is already the start of a gap or the job has waited for too long
+        if ((job->flags & CO_JOB_FLAG_NO_OVERLAP) && (job->step_us > idle) && !gap_start
+                && ((start - job->last_us) < CO_JOB_MAX_WAIT_US))
+        {
+            // Let the other jobs try their (maybe shorter) steps
+            co_list_pop_front(&co_job_env.pending);
+            co_list_push_back(&co_job_env.pending, &job->hdr);
+            return;
+        }
+
+        // At least one step, then as many as the window allows
+        do
+        {
+            uint32_t step_start = now;
+
+            done = job->step(job->p_env);
+            now = clock->now_us();
+            co_job_step_update(job, now - step_start);
+        } while (!done && (((now - start) + job->step_us) <= window));
+
+        job->last_us = now;
+    }
+
+    // The job is still first, callbacks may have queued new ones behind it
+    co_list_pop_front(&co_job_env.pending);
+
+    if (done)
+    {
+        if (job->done != NULL)
+        {
+            job->done(job->p_env);
+        }
+    }
+    else
+    {
+        co_list_push_back(&co_job_env.pending, &job->hdr);
+    }
+}
+
+/// @} CO_JOB
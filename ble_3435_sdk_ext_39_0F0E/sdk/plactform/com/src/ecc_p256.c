@@ -30,7 +30,7 @@
 #include "co_math.h"
 #include "co_utils.h"
 #include "co_list.h"
-#include "ke_event.h"
+#include "co_job.h"
 
 #include "dbg_swdiag.h"          // Software diag
 
@@ -62,6 +62,40 @@
 #error "ECC Multiplication Algorithm configuration Not Supported"
 #endif // (ECC_MULT_ALGO_TYPE == 16)
 
+/*********************************************************************************
+ *  Width of the NAF window used by the point multiplication.
+ *  The odd multiples P, 3P, ..., (2^(w-1)-1)P are precomputed for each
+ *  multiplication and kept with it in the non retention heap, so every step of w
+ *  costs RAM (one Jacobian point is 132 bytes with 32 bit digits):
+ *      w = 2 : plain NAF, 1 point,  ~86 additions per 256 bit scalar
+ *      w = 3 : 2 points,            ~65 additions
+ *      w = 4 : 4 points,            ~54 additions
+ *  NAF digits are stored as signed nibbles, which bounds w to 4.
+ *********************************************************************************/
+#ifndef ECC_NAF_WINDOW
+#define ECC_NAF_WINDOW  3
+#endif // ECC_NAF_WINDOW
+
+#if ((ECC_NAF_WINDOW < 2) || (ECC_NAF_WINDOW > 4))
+#error "ECC_NAF_WINDOW must be 2, 3 or 4"
+#endif // ((ECC_NAF_WINDOW < 2) || (ECC_NAF_WINDOW > 4))
+
+#define ECC_NAF_TABLE_SIZE  (1 << (ECC_NAF_WINDOW - 2))
+// A 256 bit scalar has at most 257 NAF digits, two digits per byte
+#define ECC_NAF_MAX_DIGITS  257
+
+/*********************************************************************************
+ *  Time slicing of non blocking multiplications, see co_job.h.
+ *  Steps are run back to back for at most ECC_JOB_BUDGET_US and up to the next radio
+ *  event, after which the kernel messages of the link are handled first.
+ *********************************************************************************/
+#ifndef ECC_JOB_BUDGET_US
+#define ECC_JOB_BUDGET_US   5000
+#endif // ECC_JOB_BUDGET_US
+
+// One step is at most a doubling and an addition, learnt on the first step
+#define ECC_JOB_STEP_US     0
+
 /*
  * MACROS
  ****************************************************************************************
@@ -161,28 +195,29 @@ struct ecc_elt_tag
 {
     /// List element for chaining in the ECC environment
     struct co_list_hdr hdr;
+    /// Background job running the multiplication steps
+    struct co_job job;
 
-    u_int32 Point_Mul_Word256;
+    /// Remaining multiplication steps (table precomputation + NAF digits)
+    u_int32 Point_Mul_Steps256;
 
-    // ECC points Q and R in Jacobian format.
+    // Accumulator Q in Jacobian format, holds 2P while the table is computed.
     ECC_Jacobian_Point256 Jacobian_PointQ256;
-    ECC_Jacobian_Point256 Jacobian_PointR256;
+    // Odd multiples P, 3P, 5P, ... of the input point in Jacobian format.
+    ECC_Jacobian_Point256 Jacobian_Table256[ECC_NAF_TABLE_SIZE];
 
-    // The Private/Secret Key used during calculations
-    bigHex256 Pk256;
+    // Width-w NAF of the Private/Secret Key, LSB digit first, signed nibbles
+    u_int8 naf[(ECC_NAF_MAX_DIGITS + 1) / 2];
 
     /// Return message identifier
     ke_msg_id_t msg_id;
     /// Client task identifier
     ke_task_id_t client_id;
 
-    #if (ECC_MULT_ALGO_TYPE == 16)
-    uint16_t current_val;
-    uint16_t bit_cursor;
-    #elif (ECC_MULT_ALGO_TYPE == 32)
-    uint32_t current_val;
-    uint32_t bit_cursor;
-    #endif // (ECC_MULT_ALGO_TYPE == 16)
+    /// Next table entry to compute
+    uint16_t table_cursor;
+    /// NAF digits left to process, the next one is naf[naf_cursor - 1]
+    uint16_t naf_cursor;
 };
 
 
@@ -297,6 +332,7 @@ __INLINE__ int isVeryBigHexGreaterThanOrEqual256(const veryBigHex256 *bigHexA,co
 __INLINE__ void GF_Setup_Jacobian_Infinity_Point256(ECC_Jacobian_Point256 *infinity);
 __INLINE__ void GF_Affine_To_Jacobian_Point_Copy256(const ECC_Point256 *source,ECC_Jacobian_Point256 *destination);
 __INLINE__ void GF_Jacobian_Point_Copy256(const ECC_Jacobian_Point256 *source,ECC_Jacobian_Point256 *destination);
+__INLINE__ void GF_Jacobian_Point_Negate256(const ECC_Jacobian_Point256 *source,ECC_Jacobian_Point256 *destination);
 
 
 
@@ -1695,6 +1731,14 @@ __INLINE__ void GF_Jacobian_Point_Copy256(const ECC_Jacobian_Point256 *source,EC
     copyBigHex256(&source->z,&destination->z);
 }
 
+__INLINE__ void GF_Jacobian_Point_Negate256(const ECC_Jacobian_Point256 *source,ECC_Jacobian_Point256 *destination)
+{
+    // -(X, Y, Z) = (X, P - Y, Z)
+    copyBigHex256(&source->x,&destination->x);
+    SubtractBigHexMod256(&bigHexP256,&source->y,&destination->y);
+    copyBigHex256(&source->z,&destination->z);
+}
+
 __INLINE__ void GF_Affine_To_Jacobian_Point_Copy256(const ECC_Point256 *source,ECC_Jacobian_Point256 *destination)
 {
     bigHex256 BigHex_1;
@@ -1885,176 +1929,251 @@ void divideByTwo256(bigHex256* A)
  *               pPointP  - pointer to the point which is to be multiplied by pk
  *
  * Description
- * This function performs ECC point multiplication. It uses the Scalar Multiplication
- * algorithm. Scalar multiplication works is way through the bits of a BigHex starting with the LSB.
- * For each bit (irrespective of Value) a point Doubling is performed, if the bit has a value = 1 then
- * a point addition is also performed.
+ * This function performs ECC point multiplication. The scalar is first recoded into its
+ * width-w non adjacent form (wNAF): digits are zero or odd with |d| < 2^(w-1), and any w
+ * consecutive digits hold at most one non zero digit. The odd multiples of P are then
+ * precomputed and the digits are consumed starting with the MSB. For each digit a point
+ * doubling is performed, and a non zero digit adds (or subtracts) the matching multiple.
  *
- * Scalar Multiplication: LSB first
- *    Require k=(km-1,km-2,,k0)2, km=1
- *    Compute Q=kP
- *  Q=0, R=P
- *  For i=0 to m-1
- *    If ki=1 then
- *       Q=Q+R
- *    End if
- *    R=2R
- *  End for
- *  Return Q
+ * Scalar Multiplication: wNAF, MSB first
+ *   - Require k=(d(m-1),...,d0) in wNAF, T[i]=(2i+1)P for i < 2^(w-2)
+ *   - Compute Q=kP
+ * - Q=0
+ * - For i=m-1 downto 0
+ *   - Q=2Q
+ *   - If di>0 then Q=Q+T[(di-1)/2]
+ *   - If di<0 then Q=Q-T[(-di-1)/2]
+ * - End for
+ * - Return Q
  ******************************************************************************************/
+
 /**
  ****************************************************************************************
- * @brief Outer function for ECC point multiplications, both multiply an ECC point by 8 bits.
+ * @brief Recode a secret key (LSB first) in width-w NAF, LSB digit first.
  *
- * Used to continue ECC P256 algorithm.
+ * @return Number of NAF digits
  ****************************************************************************************
  */
-static void ecc_point_multiplication_uint8_256(struct ecc_elt_tag* ecc_elt)
+static uint16_t ecc_naf_recode256(const u_int8* secret_key, u_int8* naf)
 {
-    ECC_Jacobian_Point256 tmpResultPoint;
-    ECC_Jacobian_Point256 tmpResultPoint2;
-    ECC_Jacobian_Point256* jPointQ256 = &(ecc_elt->Jacobian_PointQ256);
-    ECC_Jacobian_Point256* jPointR256 = &(ecc_elt->Jacobian_PointR256);
+    // LSW first, one spare word for the carry of negative digits
+    u_int32 k[9];
+    uint16_t len = 0;
+    int32_t i;
 
-    if(ecc_elt->bit_cursor == 0)
+    memset(k, 0, sizeof(k));
+    memset(naf, 0, (ECC_NAF_MAX_DIGITS + 1) / 2);
+    for (i = 0; i < 32; i++)
     {
-        ecc_elt->current_val = ecc_elt->Pk256.num[ecc_elt->Point_Mul_Word256-1];
-        ecc_elt->bit_cursor = ECC_MULT_ALGO_TYPE;
+        k[i >> 2] |= ((u_int32)secret_key[i]) << ((i & 3) * 8);
     }
 
-    // check if bit in current val is set
-    if (ecc_elt->current_val & 0x1)
+    while (k[0] | k[1] | k[2] | k[3] | k[4] | k[5] | k[6] | k[7] | k[8])
     {
-        // Q = Q + R
-        GF_Jacobian_Point_Addition256(jPointQ256, jPointR256, &tmpResultPoint);
-        // Copy ResultPoint to PointQ
-        GF_Jacobian_Point_Copy256(&tmpResultPoint, jPointQ256);
-    }
-    // Point Doubling
-    // R = 2R
-    GF_Jacobian_Point_Double256(jPointR256, &tmpResultPoint2);
-    // Copy Result point to PointR
-    GF_Jacobian_Point_Copy256(&tmpResultPoint2, jPointR256);
+        s_int32 digit = 0;
 
-    // update current value to check next bit
-    ecc_elt->current_val = ecc_elt->current_val >> 1;
-    ecc_elt->bit_cursor--;
+        if (k[0] & 0x1)
+        {
+            // digit = k mods 2^w, then k = k - digit
+            digit = k[0] & ((1 << ECC_NAF_WINDOW) - 1);
+            if (digit >= (1 << (ECC_NAF_WINDOW - 1)))
+            {
+                digit -= (1 << ECC_NAF_WINDOW);
+            }
 
-    // check if a full word has been calculated
-    if(ecc_elt->bit_cursor == 0)
-    {
-        // decrement the counter
-        ecc_elt->Point_Mul_Word256--;
+            if (digit > 0)
+            {
+                // Low bits of k equal digit: no borrow
+                k[0] -= digit;
+            }
+            else
+            {
+                u_int32 carry = (u_int32)(-digit);
+                for (i = 0; (i < 9) && carry; i++)
+                {
+                    k[i] += carry;
+                    carry = (k[i] < carry);
+                }
+            }
+        }
+
+        naf[len >> 1] |= (u_int8)((digit & 0x0F) << ((len & 0x1) * 4));
+        len++;
+
+        // k = k / 2
+        for (i = 0; i < 8; i++)
+        {
+            k[i] = (k[i] >> 1) | (k[i + 1] << 31);
+        }
+        k[8] >>= 1;
     }
+
+    return len;
 }
 
 /**
  ****************************************************************************************
- * @brief ECC ecc_multiplication event handler
+ * @brief Outer function for ECC point multiplications, performs one step of the
+ * multiplication: either one table entry or one NAF digit, each at most one doubling
+ * and one addition.
+ *
+ * Used to continue ECC P256 algorithm.
  ****************************************************************************************
  */
-static void ecc_multiplication_event_handler(void)
+static void ecc_point_multiplication_step256(struct ecc_elt_tag* ecc_elt)
 {
-    DBG_SWDIAG(ECDH, COMPUTE, 1);
-    // Clear the event
-    ke_event_clear(KE_EVENT_ECC_MULTIPLICATION);
+    ECC_Jacobian_Point256 tmpResultPoint;
+    ECC_Jacobian_Point256 tmpResultPoint2;
+    ECC_Jacobian_Point256* jPointQ256 = &(ecc_elt->Jacobian_PointQ256);
+    ECC_Jacobian_Point256* jTable256 = ecc_elt->Jacobian_Table256;
 
-    // Take the next multiplication
-    struct ecc_elt_tag* ecc_elt = (struct ecc_elt_tag*) co_list_pop_front(&ecc_env.ongoing_mul);
+    if (ecc_elt->table_cursor < ECC_NAF_TABLE_SIZE)
+    {
+        if (ecc_elt->table_cursor == 1)
+        {
+            // Q = 2P
+            GF_Jacobian_Point_Double256(&jTable256[0], jPointQ256);
+        }
 
+        // T[i] = T[i-1] + 2P
+        GF_Jacobian_Point_Addition256(&jTable256[ecc_elt->table_cursor - 1], jPointQ256, &jTable256[ecc_elt->table_cursor]);
+        ecc_elt->table_cursor++;
 
-    // Check if element is present
-    if(ecc_elt != NULL)
+        if (ecc_elt->table_cursor == ECC_NAF_TABLE_SIZE)
+        {
+            // Table complete, Q becomes the accumulator
+            GF_Setup_Jacobian_Infinity_Point256(jPointQ256);
+        }
+    }
+    else
     {
-        // Check that current multiplication is not finished
-        if(ecc_elt->Point_Mul_Word256 > 0)
+        s_int32 digit;
+
+        ecc_elt->naf_cursor--;
+        digit = (ecc_elt->naf[ecc_elt->naf_cursor >> 1] >> ((ecc_elt->naf_cursor & 0x1) * 4)) & 0x0F;
+        if (digit & 0x08)
         {
-            DBG_SWDIAG(ECDH, MULT, 1);
-            // Execute 1 multiplication step
-            ecc_point_multiplication_uint8_256(ecc_elt);
+            digit -= 0x10;
+        }
 
-            // Re-insert the multiplication at the end of the list
-            co_list_push_back(&ecc_env.ongoing_mul, &ecc_elt->hdr);
-            DBG_SWDIAG(ECDH, MULT, 0);
+        // Point Doubling, nothing to do while Q is still the point at infinity
+        // Q = 2Q
+        if (!Is_Infinite256(jPointQ256))
+        {
+            GF_Jacobian_Point_Double256(jPointQ256, &tmpResultPoint);
+            GF_Jacobian_Point_Copy256(&tmpResultPoint, jPointQ256);
         }
-        else
+
+        if (digit > 0)
         {
-            DBG_SWDIAG(ECDH, END, 1);
-            // Multiplication completed, report to the client task
-            if(ecc_elt->client_id != TASK_NONE)
-            {
-                int32_t i, j;
-                ECC_Point256 pointQ256;
+            // Q = Q + T[(d-1)/2]
+            GF_Jacobian_Point_Addition256(jPointQ256, &jTable256[digit >> 1], &tmpResultPoint);
+            GF_Jacobian_Point_Copy256(&tmpResultPoint, jPointQ256);
+        }
+        else if (digit < 0)
+        {
+            // Q = Q - T[(-d-1)/2]
+            GF_Jacobian_Point_Negate256(&jTable256[(-digit) >> 1], &tmpResultPoint2);
+            GF_Jacobian_Point_Addition256(jPointQ256, &tmpResultPoint2, &tmpResultPoint);
+            GF_Jacobian_Point_Copy256(&tmpResultPoint, jPointQ256);
+        }
+    }
+
+    ecc_elt->Point_Mul_Steps256--;
+}
+
+/**
+ ****************************************************************************************
+ * @brief ECC multiplication job step
+ *
+ * @return true when all the multiplication steps are done
+ ****************************************************************************************
+ */
+static bool ecc_multiplication_job_step(void* p_env)
+{
+    struct ecc_elt_tag* ecc_elt = (struct ecc_elt_tag*) p_env;
 
-                struct ecc_result_ind* ind = KE_MSG_ALLOC(ecc_elt->msg_id, ecc_elt->client_id, TASK_NONE, ecc_result_ind);
+    DBG_SWDIAG(ECDH, MULT, 1);
+    // Execute 1 multiplication step
+    ecc_point_multiplication_step256(ecc_elt);
+    DBG_SWDIAG(ECDH, MULT, 0);
 
-                initBigNumber256(&pointQ256.x);
-                initBigNumber256(&pointQ256.y);
+    return (ecc_elt->Point_Mul_Steps256 == 0);
+}
 
-                GF_Point_Jacobian_To_Affine256(&(ecc_elt->Jacobian_PointQ256), &pointQ256.x, &pointQ256.y);
+/**
+ ****************************************************************************************
+ * @brief ECC multiplication job completion, reports the result to the client task
+ ****************************************************************************************
+ */
+static void ecc_multiplication_job_done(void* p_env)
+{
+    struct ecc_elt_tag* ecc_elt = (struct ecc_elt_tag*) p_env;
 
-                // Free the memory previously allocated for Jacobian points Q and R and the private key
-                ke_free(ecc_elt);
+    DBG_SWDIAG(ECDH, END, 1);
+    // Remove the multiplication from the ongoing list
+    co_list_extract(&ecc_env.ongoing_mul, &ecc_elt->hdr, 0);
 
-                // Copy result keys X coordinate # LSB first
-                for(i = 31, j=1; i>=0;) // Keys Res is MSB - make it in LSB
-                {
-                    #if (ECC_MULT_ALGO_TYPE == 16)
-                    ind->key_res_x[i] =   ((pointQ256.x.num[j] & 0xFF00) >> 8);
-                    ind->key_res_x[i-1] =  (pointQ256.x.num[j] & 0x00FF);
-                    i-=2;
-                    j++;
-                    #elif (ECC_MULT_ALGO_TYPE == 32)
-                    ind->key_res_x[i]   = ((pointQ256.x.num[j] & 0xFF000000) >> 24);
-                    ind->key_res_x[i-1] = ((pointQ256.x.num[j] & 0x00FF0000) >> 16);
-                    ind->key_res_x[i-2] = ((pointQ256.x.num[j] & 0x0000FF00) >> 8);
-                    ind->key_res_x[i-3] = ( pointQ256.x.num[j] & 0x000000FF);
-                    i-=4;
-                    j++;
-                    #endif // (ECC_MULT_ALGO_TYPE == 16)
-                }
+    if(ecc_elt->client_id != TASK_NONE)
+    {
+        int32_t i, j;
+        ECC_Point256 pointQ256;
 
-                // Copy result keys Y coordinate
-                for(i = 31, j=1; i>=0;) // Keys Res is MSB - make it in LSB
-                {
-                    #if (ECC_MULT_ALGO_TYPE == 16)
-                    ind->key_res_y[i]  = ((pointQ256.y.num[j] & 0xFF00) >> 8);
-                    ind->key_res_y[i-1] = (pointQ256.y.num[j] & 0x00FF);
-
-                    i-=2;
-                    j++;
-                    #elif (ECC_MULT_ALGO_TYPE == 32)
-                    ind->key_res_y[i]   = ((pointQ256.y.num[j] & 0xFF000000) >> 24);
-                    ind->key_res_y[i-1] = ((pointQ256.y.num[j] & 0x00FF0000) >> 16);
-                    ind->key_res_y[i-2] = ((pointQ256.y.num[j] & 0x0000FF00) >> 8);
-                    ind->key_res_y[i-3] = ( pointQ256.y.num[j] & 0x000000FF);
-                    i-=4;
-                    j++;
-                    #endif // (ECC_MULT_ALGO_TYPE == 16)
-                }
+        struct ecc_result_ind* ind = KE_MSG_ALLOC(ecc_elt->msg_id, ecc_elt->client_id, TASK_NONE, ecc_result_ind);
 
-                ke_msg_send(ind);
-            }
+        initBigNumber256(&pointQ256.x);
+        initBigNumber256(&pointQ256.y);
 
-            DBG_SWDIAG(ECDH, END, 0);
+        GF_Point_Jacobian_To_Affine256(&(ecc_elt->Jacobian_PointQ256), &pointQ256.x, &pointQ256.y);
+
+        // Free the memory previously allocated for Jacobian points Q and R and the private key
+        ke_free(ecc_elt);
+
+        // Copy result keys X coordinate # LSB first
+        for(i = 31, j=1; i>=0;) // Keys Res is MSB - make it in LSB
+        {
+            #if (ECC_MULT_ALGO_TYPE == 16)
+            ind->key_res_x[i] =   ((pointQ256.x.num[j] & 0xFF00) >> 8);
+            ind->key_res_x[i-1] =  (pointQ256.x.num[j] & 0x00FF);
+            i-=2;
+            j++;
+            #elif (ECC_MULT_ALGO_TYPE == 32)
+            ind->key_res_x[i]   = ((pointQ256.x.num[j] & 0xFF000000) >> 24);
+            ind->key_res_x[i-1] = ((pointQ256.x.num[j] & 0x00FF0000) >> 16);
+            ind->key_res_x[i-2] = ((pointQ256.x.num[j] & 0x0000FF00) >> 8);
+            ind->key_res_x[i-3] = ( pointQ256.x.num[j] & 0x000000FF);
+            i-=4;
+            j++;
+            #endif // (ECC_MULT_ALGO_TYPE == 16)
         }
-    }
-    else
-    {
-        ASSERT_ERR(0);
-    }
 
-    // Restart the event in case there is multiplication to perform
-    if(!co_list_is_empty(&ecc_env.ongoing_mul))
-    {
-        ke_event_set(KE_EVENT_ECC_MULTIPLICATION);
+        // Copy result keys Y coordinate
+        for(i = 31, j=1; i>=0;) // Keys Res is MSB - make it in LSB
+        {
+            #if (ECC_MULT_ALGO_TYPE == 16)
+            ind->key_res_y[i]  = ((pointQ256.y.num[j] & 0xFF00) >> 8);
+            ind->key_res_y[i-1] = (pointQ256.y.num[j] & 0x00FF);
+
+            i-=2;
+            j++;
+            #elif (ECC_MULT_ALGO_TYPE == 32)
+            ind->key_res_y[i]   = ((pointQ256.y.num[j] & 0xFF000000) >> 24);
+            ind->key_res_y[i-1] = ((pointQ256.y.num[j] & 0x00FF0000) >> 16);
+            ind->key_res_y[i-2] = ((pointQ256.y.num[j] & 0x0000FF00) >> 8);
+            ind->key_res_y[i-3] = ( pointQ256.y.num[j] & 0x000000FF);
+            i-=4;
+            j++;
+            #endif // (ECC_MULT_ALGO_TYPE == 16)
+        }
+
+        ke_msg_send(ind);
     }
-    else
+    DBG_SWDIAG(ECDH, END, 0);
+
+    if(co_list_is_empty(&ecc_env.ongoing_mul))
     {
         DBG_SWDIAG(ECDH, BUSY, 0);
-      
     }
-    DBG_SWDIAG(ECDH, COMPUTE, 0);
 }
 
 
@@ -2072,39 +2191,31 @@ void ecc_init(bool reset)
         {
             // Free allocated memory
             struct ecc_elt_tag* elt = (struct ecc_elt_tag*) co_list_pop_front(&ecc_env.ongoing_mul);
+            co_job_abort(&elt->job);
             ke_free(elt);
         }
        
     }
 
-    // Initialize multiplications list
+    // Initialize multiplications list, the steps run as background jobs
     co_list_init(&ecc_env.ongoing_mul);
-
-    // Register event to handle multiplication steps
-    ke_event_callback_set(KE_EVENT_ECC_MULTIPLICATION, &ecc_multiplication_event_handler);
 }
 
 void ecc_generate_key256(const u_int8* secret_key, const u_int8* public_key_x, const u_int8* public_key_y, ke_msg_id_t msg_id, ke_task_id_t task_id)
 {
     u_int32 big_num_offset=1;
     int32_t i, j;
-    bigHex256 PrivateKey256;
     ECC_Point256 PublicKey256;
 
-    // Now Copy the Public Key and Secret Key coordinates to ECC point format.
-    PrivateKey256.num[0] = 0;
+    // Now Copy the Public Key coordinates to ECC point format.
     PublicKey256.x.num[0] = 0;
     PublicKey256.y.num[0] = 0;
 
     DBG_SWDIAG(ECDH, BUSY, 1);
 
-    for (i=31, j=big_num_offset;i>=0;) // Public and Private Keys Are LSB - make it in MSB
+    for (i=31, j=big_num_offset;i>=0;) // Public Keys Are LSB - make it in MSB
     {
         #if (ECC_MULT_ALGO_TYPE == 16)
-        PrivateKey256.num[j] = (u_int32)
-                                                   ((((*(secret_key+i   )) <<  8) & 0xFF00) +
-                                                    (((*(secret_key+(i-1) ))      & 0x00FF)));
-
         PublicKey256.x.num[j] = (u_int32)
                                                   ( (((*(public_key_x+i   )) <<  8) & 0xFF00) +
                                                     (((*(public_key_x+(i-1) ))      & 0x00FF)));
@@ -2116,12 +2227,6 @@ void ecc_generate_key256(const u_int8* secret_key, const u_int8* public_key_x, c
         i -= 2;
         j++;
         #elif (ECC_MULT_ALGO_TYPE == 32)
-        PrivateKey256.num[j] = (u_int32)
-                                            ((((*(secret_key+i    )) << 24) & 0xFF000000) +
-                                           (((*(secret_key+(i-1))) << 16) & 0x00FF0000) +
-                                           (((*(secret_key+(i-2))) <<  8) & 0x0000FF00) +
-                                           (( *(secret_key+(i-3)))        & 0x000000FF));
-
         PublicKey256.x.num[j] = (u_int32)
                                             ((((*(public_key_x+i    )) << 24) & 0xFF000000) +
                                            (((*(public_key_x+(i-1))) << 16) & 0x00FF0000) +
@@ -2138,7 +2243,6 @@ void ecc_generate_key256(const u_int8* secret_key, const u_int8* public_key_x, c
         #endif // (ECC_MULT_ALGO_TYPE == 16)
     }
 
-    setBigNumberLength256(&PrivateKey256);
     setBigNumberLength256(&PublicKey256.x);
     setBigNumberLength256(&PublicKey256.y);
     PublicKey256.x.sign = 0;
@@ -2146,37 +2250,30 @@ void ecc_generate_key256(const u_int8* secret_key, const u_int8* public_key_x, c
 
 //    ECC_Point_Multiplication256(&PrivateKey256,&PublicKey256,blocking);
     {
-        ECC_Jacobian_Point256 PointP_Jacobian;
-        ECC_Jacobian_Point256* pPointP_Jacobian = &PointP_Jacobian;
-
-        // Allocate Memory for Jacobian Points P, Q, R
+        // Allocate Memory for Jacobian Point Q and the table of odd multiples of P
         struct ecc_elt_tag* ecc_elt = (struct ecc_elt_tag*) ke_malloc(sizeof(struct ecc_elt_tag), KE_MEM_NON_RETENTION);
 
         // Store client message/task ID
         ecc_elt->msg_id = msg_id;
         ecc_elt->client_id = task_id;
 
-        // Need to map from Affine Point to Jacobian Point
-        GF_Affine_To_Jacobian_Point_Copy256(&PublicKey256, pPointP_Jacobian);
-
-        GF_Jacobian_Point_Copy256(pPointP_Jacobian, &(ecc_elt->Jacobian_PointR256));
-
-        copyBigHex256(&PrivateKey256, &(ecc_elt->Pk256));
+        // Need to map from Affine Point to Jacobian Point, T[0] = P
+        GF_Affine_To_Jacobian_Point_Copy256(&PublicKey256, &(ecc_elt->Jacobian_Table256[0]));
 
         GF_Setup_Jacobian_Infinity_Point256(&(ecc_elt->Jacobian_PointQ256));
 
-        // Initialize cursor
-        ecc_elt->current_val = 0;
-        ecc_elt->bit_cursor  = 0;
-        ecc_elt->Point_Mul_Word256 = ELEMENTS_BIG_HEX256;
-        
+        // Initialize cursors
+        ecc_elt->naf_cursor   = ecc_naf_recode256(secret_key, ecc_elt->naf);
+        ecc_elt->table_cursor = 1;
+        ecc_elt->Point_Mul_Steps256 = (ECC_NAF_TABLE_SIZE - 1) + ecc_elt->naf_cursor;
+
         // Check if the client task is expecting a return message
         if (ecc_elt->client_id == TASK_NONE)
         {
             // Execute all the multiplication steps
-            while (ecc_elt->Point_Mul_Word256 > 0)
+            while (ecc_elt->Point_Mul_Steps256 > 0)
             {
-                ecc_point_multiplication_uint8_256(ecc_elt);
+                ecc_point_multiplication_step256(ecc_elt);
             }
         }
         else
@@ -2184,8 +2281,9 @@ void ecc_generate_key256(const u_int8* secret_key, const u_int8* public_key_x, c
             // Insert the multiplication at the end of the list
             co_list_push_back(&ecc_env.ongoing_mul, &ecc_elt->hdr);
 
-            // Start the event
-            ke_event_set(KE_EVENT_ECC_MULTIPLICATION);
+            // Start the steps in the idle time
+            co_job_start(&ecc_elt->job, &ecc_multiplication_job_step, &ecc_multiplication_job_done,
+                         ecc_elt, ECC_JOB_BUDGET_US, ECC_JOB_STEP_US, 0);
         }
     }
 }
@@ -2204,14 +2302,14 @@ void ecc_abort_key256_generation(ke_task_id_t task_id)
             // Extract element from the list
             co_list_extract_after(&ecc_env.ongoing_mul, &prev->hdr, &elt->hdr);
 
-            // Free allocated memory
+            // Stop the steps and free allocated memory
+            co_job_abort(&elt->job);
             ke_free(elt);
 
             // Check if list is empty
             if(co_list_is_empty(&ecc_env.ongoing_mul))
             {
-                // Clear the event
-                ke_event_clear(KE_EVENT_ECC_MULTIPLICATION);
+                DBG_SWDIAG(ECDH, BUSY, 0);
             }
 
             break;
@@ -1,15 +1,15 @@
 #include "app_active_report.h"
 
 /*
-ļ˵
-    Ϊֲļݲapp_portϲķװ׼
-ʹó
-    豸״̬Ҫϱʱapp_active_report_start()豸豸ߺ󼴿ɽϱ
-    豸ϱɺapp_active_report_finished_and_disconnect()Ͽӡ
-ֲ̣
-    1. lock_timer.c/hļдLOCK_TIMER_ACTIVE_REPORTʱڳʱָ㲥
-    2. caseTUYA_BLE_CB_EVT_CONNECTE_STATUSеapp_active_report_stop(ACTICE_REPORT_STOP_STATE_BONDING)ڰ󶨺رնʱ;
-    3. caseAPP_EVT_BLE_GAP_EVT_DISCONNECTEDеapp_active_report_finished_and_disconnect_handler()ϱɺֳָ
+文件说明：
+    为方便移植，该文件的内容不符合app_port对上层的封装标准。
+使用场景：
+    在设备处于离线状态并需要主动上报数据时，调用app_active_report_start()触发网关连接设备，设备上线后即可进行数据上报；
+    设备上报完成后调用app_active_report_finished_and_disconnect()断开连接。
+移植流程：
+    1. 在lock_timer.c/h文件中创建“LOCK_TIMER_ACTIVE_REPORT”定时器，用于超时后恢复广播间隔；
+    2. 在case“TUYA_BLE_CB_EVT_CONNECTE_STATUS”中调用app_active_report_stop(ACTICE_REPORT_STOP_STATE_BONDING)，用于绑定后关闭定时器;
+    3. 在case“APP_EVT_BLE_GAP_EVT_DISCONNECTED”中调用app_active_report_finished_and_disconnect_handler()，用于数据上报完成后恢复现场；
 */
 
 
@@ -44,16 +44,16 @@ FN:
 void app_active_report_start(void)
 {
     if (ke_state_get(TASK_APP) == APPM_ADVERTISING) {
-        //ı㲥
+        //改变广播间隔
         g_adv_param.adv_interval_min = APP_ACTIVE_REPORT_ADV_INTERVAL;
         g_adv_param.adv_interval_max = APP_ACTIVE_REPORT_ADV_INTERVAL;
         bk_adv_param_set();
         
-        //ı־λ
+        //改变标志位
         g_scan_rsp[8] |= 0x01;
         bk_adv_update_advDataAndScanRsp();
         
-        //ʱ
+        //启动定时器
         lock_timer_start(LOCK_TIMER_ACTIVE_REPORT);
         
         s_active_report_running_flag = true;
@@ -73,7 +73,7 @@ void app_active_report_stop(uint8_t state)
         if(state == ACTICE_REPORT_STOP_STATE_OUTTIME) {
             if (ke_state_get(TASK_APP) == APPM_ADVERTISING)
             {
-                //ָ㲥
+                //恢复广播间隔
                 g_adv_param.adv_interval_min = APP_PORT_ADV_INTERVAL;
                 g_adv_param.adv_interval_max = APP_PORT_ADV_INTERVAL;
                 bk_adv_param_set();
@@ -85,7 +85,7 @@ void app_active_report_stop(uint8_t state)
             }
         }
         else if(state == ACTICE_REPORT_STOP_STATE_BONDING) {
-            //رնʱ
+            //关闭定时器
             lock_timer_stop(LOCK_TIMER_ACTIVE_REPORT);
             
             s_active_report_bonding_flag = true;
@@ -111,12 +111,12 @@ FN:
 void app_active_report_finished_and_disconnect_handler(void)
 {
     if(s_active_report_running_flag && s_active_report_bonding_flag) {
-        //ָ㲥
+        //恢复广播间隔
         g_adv_param.adv_interval_min = APP_PORT_ADV_INTERVAL;
         g_adv_param.adv_interval_max = APP_PORT_ADV_INTERVAL;
         bk_adv_param_set();
         
-        //ָ־λ
+        //恢复标志位
         g_scan_rsp[8] &= 0xFE;
         bk_adv_update_advDataAndScanRsp();
         
@@ -78,15 +78,13 @@ static void app_common_tuya_ble_sdk_callback(tuya_ble_cb_evt_param_t* param)
         
         //dp parser
         case TUYA_BLE_CB_EVT_DP_WRITE: {
-            if(param->dp_write_data.p_data[2] == (param->dp_write_data.data_len - 3))
-            {
-                lock_dp_parser_handler(param->dp_write_data.p_data);
-            }
+            lock_dp_parser_handler(param->dp_write_data.p_data, param->dp_write_data.data_len);
         } break;
         
         //response - dp report
         case TUYA_BLE_CB_EVT_DP_DATA_REPORT_RESPONSE: {
-            if(g_sync_new.flag == 1)
+            //only the responses to sync packages move the sync window
+            if(app_port_dp_data_report_response_is_marked() && (g_sync_new.flag == 1))
             {
                 lock_open_meth_sync_new_report(param->dp_response_data.status);
             }
@@ -105,6 +103,7 @@ static void app_common_tuya_ble_sdk_callback(tuya_ble_cb_evt_param_t* param)
             APP_DEBUG_PRINTF("TUYA_BLE_CB_EVT_TIME_STAMP - time_zone: %d", param->timestamp_data.time_zone);
             APP_DEBUG_PRINTF("TUYA_BLE_CB_EVT_TIME_STAMP - timestamp: %d", param->timestamp_data.timestamp);
             app_port_update_timestamp(param->timestamp_data.timestamp);
+            lock_dynamic_pwd_drift_reset();
             lock_timer_start(LOCK_TIMER_BONDING_CONN);
         } break;
         
@@ -185,8 +184,11 @@ static void app_common_evt_process(void *p_param)
         
         case APP_EVT_BLE_GAP_EVT_DISCONNECTED: {
             app_ota_disconn_handler();
+            app_port_dp_data_report_clear();
+            lock_open_meth_sync_new_disconn_handler();
             lock_timer_stop(LOCK_TIMER_CONN_MONITOR);
             app_active_report_finished_and_disconnect_handler();
+            app_port_aes128_ctx_cache_clear();
         } break;
         
         case APP_EVT_TIMER_0: {
@@ -34,6 +34,8 @@ extern "C"
 #include "app_port.h"
 #include "app_flash.h"
 #include "app_ota.h"
+#include "app_ota_delta.h"
+#include "app_ota_unpack.h"
 #include "app_active_report.h"
 #include "app_test.h"
 //app lock
@@ -23,6 +23,9 @@
 #define SETBIT(hardid)         (hardid_bitmap[hardid/8] |=  (1<<hardid%8))
 #define CLEARBIT(hardid)       (hardid_bitmap[hardid/8] &= ~(1<<hardid%8))
 
+//password length from app is not trusted
+#define HARD_PASSWORD_LEN_LIMIT(len)  (((len) > HARD_PASSWORD_MAX_LEN) ? HARD_PASSWORD_MAX_LEN : (len))
+
 /*********************************************************************
  * LOCAL STRUCT
  */
@@ -38,9 +41,15 @@ static uint32_t s_evt_id = 0;
 static uint8_t hardid_array[HARDID_MAX_TOTAL];
 static uint8_t hardtype_array[HARDID_MAX_TOTAL];
 
+//valid only when the bit in hardid_bitmap is set
+static lock_hard_digest_t hard_digest[HARDID_MAX_TOTAL];
+//changes whenever a hard is saved or deleted
+static uint32_t s_hard_generation = 0;
+
 /*********************************************************************
  * LOCAL FUNCTION
  */
+static void lock_hard_digest_update(uint8_t hardid, lock_hard_t* hard);
 
 /*********************************************************************
  * VARIABLES
@@ -143,7 +152,9 @@ uint32_t lock_hard_save(lock_hard_t* hard)
     
 	uint32_t err_code = app_port_nv_set(SF_AREA_1, hardid, hard, sizeof(lock_hard_t));
 	if(err_code == APP_PORT_SUCCESS) {
+        lock_hard_digest_update(hardid, hard);
         SETBIT(hardid);
+        s_hard_generation++;
         return APP_PORT_SUCCESS;
 	}
     return APP_PORT_ERROR_COMMON;
@@ -161,6 +172,40 @@ uint32_t lock_hard_load(uint8_t hardid, lock_hard_t* hard)
 	return app_port_nv_get(SF_AREA_1, hardid, hard, sizeof(lock_hard_t));
 }
 
+/*********************************************************
+FN: 
+*/
+static void lock_hard_digest_update(uint8_t hardid, lock_hard_t* hard)
+{
+    lock_hard_digest_t* digest = &hard_digest[hardid];
+    
+    digest->hard_type = hard->hard_type;
+    digest->member_id = hard->member_id;
+    digest->freeze_state = hard->freeze_state;
+    digest->crc8 = app_port_crc16_compute((void*)digest, 3, NULL) & 0xFF;
+}
+
+/*********************************************************
+FN: get hard digest from ram, no flash access
+*/
+uint32_t lock_hard_digest_get(uint8_t hardid, lock_hard_digest_t* digest)
+{
+    if((hardid >= HARDID_MAX_TOTAL) || (!SELECTBIT(hardid))) {
+        return APP_PORT_ERROR_COMMON;
+    }
+    
+    memcpy(digest, &hard_digest[hardid], sizeof(lock_hard_digest_t));
+    return APP_PORT_SUCCESS;
+}
+
+/*********************************************************
+FN: 
+*/
+uint32_t lock_hard_generation_get(void)
+{
+    return s_hard_generation;
+}
+
 /*********************************************************
 FN: 
 */
@@ -203,23 +248,18 @@ FN:
 */
 uint32_t lock_hardid_load_by_memberid(uint8_t memberid, uint8_t* hardtype_array, uint8_t* hardid_array, uint8_t *hardid_num)
 {
-    lock_hard_t hard;
 	*hardid_num = 0;
     
     for(uint32_t hardid=hardid_start[OPEN_METH_PASSWORD]; hardid<hardid_start[OPEN_METH_MAX]; hardid++)
     {
-        //valid
+        //valid, member id comes from the ram digest
 		if(SELECTBIT(hardid))
 		{
-            //load hard member
-            if(lock_hard_load(hardid, &hard) == 0)
+            if(hard_digest[hardid].member_id == memberid)
             {
-                if(hard.member_id == memberid)
-                {
-                    hardid_array[*hardid_num] = hardid;
-                    hardtype_array[*hardid_num] = hard.hard_type;
-                    *hardid_num += 1;
-                }
+                hardid_array[*hardid_num] = hardid;
+                hardtype_array[*hardid_num] = hard_digest[hardid].hard_type;
+                *hardid_num += 1;
             }
         }
     }
@@ -238,6 +278,7 @@ uint32_t lock_hard_delete(uint8_t hardid)
 	uint32_t err_code = app_port_nv_del(SF_AREA_1, hardid);
 	if(err_code == APP_PORT_SUCCESS) {
         CLEARBIT(hardid);
+        s_hard_generation++;
         return APP_PORT_SUCCESS;
 	}
     
@@ -366,33 +407,36 @@ uint32_t lock_hard_freezeorunfreeze_all_by_memberid(uint8_t memberid, uint8_t fr
 /*********************************************************
 FN: 
 PM: metn - open meth is the same as hard type
+    cmd - meth=OPEN_METH_TEMP_PW: temp_pw_creat_t, else: open_meth_creat_t
 */
-uint32_t lock_hard_save_in_local_flash(uint8_t meth)
+uint32_t lock_hard_save_in_local_flash(uint8_t meth, void* cmd)
 {
+    open_meth_creat_t* creat = cmd;
     lock_hard_t hard;
     hard.hard_type = meth;
-    hard.admin_flag = g_cmd.open_meth_creat.admin_falg;
-    hard.member_id = g_cmd.open_meth_creat.memberid;
+    hard.admin_flag = creat->admin_falg;
+    hard.member_id = creat->memberid;
     hard.hard_id = lock_get_hardid(meth);
-    memcpy(hard.time, g_cmd.open_meth_creat.time, HARD_TIME_MAX_LEN);
-    hard.valid_num = g_cmd.open_meth_creat.valid_num;
+    memcpy(hard.time, creat->time, HARD_TIME_MAX_LEN);
+    hard.valid_num = creat->valid_num;
     hard.password_len = 0;
     memset(hard.password, 0, HARD_PASSWORD_MAX_LEN);
     if(meth == OPEN_METH_PASSWORD)
     {
-        hard.password_len = g_cmd.open_meth_creat.password_len;
-        memcpy(hard.password, g_cmd.open_meth_creat.password, g_cmd.open_meth_creat.password_len);
+        hard.password_len = HARD_PASSWORD_LEN_LIMIT(creat->password_len);
+        memcpy(hard.password, creat->password, hard.password_len);
     }
     if(meth == OPEN_METH_TEMP_PW)
     {
+        temp_pw_creat_t* temp_pw = cmd;
         hard.admin_flag = 0x00;
         hard.member_id = 0x00;
         hard.hard_id = lock_get_hardid(meth);
-        hard.temp_pw_type = g_cmd.temp_pw_creat.type;
-        memcpy(hard.time, g_cmd.temp_pw_creat.time, HARD_TIME_MAX_LEN);
-        hard.valid_num = g_cmd.temp_pw_creat.valid_num;
-        hard.password_len = g_cmd.temp_pw_creat.password_len;
-        memcpy(hard.password, g_cmd.temp_pw_creat.password, g_cmd.temp_pw_creat.password_len);
+        hard.temp_pw_type = temp_pw->type;
+        memcpy(hard.time, temp_pw->time, HARD_TIME_MAX_LEN);
+        hard.valid_num = temp_pw->valid_num;
+        hard.password_len = HARD_PASSWORD_LEN_LIMIT(temp_pw->password_len);
+        memcpy(hard.password, temp_pw->password, hard.password_len);
     }
     hard.freeze_state = FREEZE_OFF; //default unfreeze
     uint32_t ret = lock_hard_save(&hard);
@@ -402,35 +446,38 @@ uint32_t lock_hard_save_in_local_flash(uint8_t meth)
 /*********************************************************
 FN: 
 PM: metn - open meth is the same as hard type
+    cmd - meth=OPEN_METH_TEMP_PW: temp_pw_modify_t, else: open_meth_modify_t
 */
-uint32_t lock_hard_modify_in_local_flash(uint8_t meth)
+uint32_t lock_hard_modify_in_local_flash(uint8_t meth, void* cmd)
 {
     uint8_t ret = APP_PORT_SUCCESS;
     if(meth == OPEN_METH_TEMP_PW) {
+        temp_pw_modify_t* modify = cmd;
         //load
         lock_hard_t hard;
-        ret += lock_hard_load(g_cmd.temp_pw_modify.hardid, &hard);
+        ret += lock_hard_load(modify->hardid, &hard);
         //update
-        hard.temp_pw_type = g_cmd.temp_pw_modify.type;
-        memcpy(hard.time, g_cmd.temp_pw_modify.time, HARD_TIME_MAX_LEN);
-        hard.valid_num = g_cmd.temp_pw_modify.valid_num;
-        hard.password_len = g_cmd.temp_pw_modify.password_len;
-        memcpy(hard.password, g_cmd.temp_pw_modify.password, g_cmd.temp_pw_modify.password_len);
+        hard.temp_pw_type = modify->type;
+        memcpy(hard.time, modify->time, HARD_TIME_MAX_LEN);
+        hard.valid_num = modify->valid_num;
+        hard.password_len = HARD_PASSWORD_LEN_LIMIT(modify->password_len);
+        memcpy(hard.password, modify->password, hard.password_len);
         //save
         ret += lock_hard_save(&hard);
     } else {
+        open_meth_modify_t* modify = cmd;
         //load
         lock_hard_t hard;
-        ret += lock_hard_load(g_cmd.open_meth_modify.hardid, &hard);
+        ret += lock_hard_load(modify->hardid, &hard);
         //update
-        hard.admin_flag = g_cmd.open_meth_modify.admin_falg;
-        hard.member_id = g_cmd.open_meth_modify.memberid;
-        memcpy(hard.time, g_cmd.open_meth_modify.time, HARD_TIME_MAX_LEN);
-        hard.valid_num = g_cmd.open_meth_modify.cycle;
+        hard.admin_flag = modify->admin_falg;
+        hard.member_id = modify->memberid;
+        memcpy(hard.time, modify->time, HARD_TIME_MAX_LEN);
+        hard.valid_num = modify->cycle;
         if(meth == OPEN_METH_PASSWORD)
         {
-            hard.password_len = g_cmd.open_meth_modify.password_len;
-            memcpy(hard.password, g_cmd.open_meth_modify.password, g_cmd.open_meth_modify.password_len);
+            hard.password_len = HARD_PASSWORD_LEN_LIMIT(modify->password_len);
+            memcpy(hard.password, modify->password, hard.password_len);
         }
         //save
         ret += lock_hard_save(&hard);
@@ -602,6 +649,7 @@ FN:
 uint32_t lock_flash_erease_all(bool is_delete_app_test_data)
 {
     app_port_nv_set_default();
+    lock_offline_pwd_init();
     return 0;
 }
 
@@ -617,6 +665,7 @@ uint32_t lock_flash_init(void)
         lock_hard_t hard;
 		if(lock_hard_load(hardid, &hard) == APP_PORT_SUCCESS)
 		{
+            lock_hard_digest_update(hardid, &hard);
             SETBIT(hardid);
 		}
 		else
@@ -628,6 +677,9 @@ uint32_t lock_flash_init(void)
     //init s_evt_id
     lock_evtid_load();
     
+    //offline pwd table stays in ram
+    lock_offline_pwd_init();
+    
     //if no lock_settings, set default settings
 	if(lock_settings_load() != 0)
 	{
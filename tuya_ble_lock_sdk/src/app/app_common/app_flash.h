@@ -58,6 +58,8 @@ enum {
     NV_ID_OTA_FILE_MD5,
     NV_ID_OTA_DATA_LEN,
     NV_ID_OTA_DATA_CRC,
+    NV_ID_OFFLINE_PWD_EPOCH,
+    NV_ID_OTA_CHECKPOINT,
 };
 
 /*********************************************************************
@@ -78,6 +80,15 @@ typedef struct
 	uint8_t temp_pw_type;
 } lock_hard_t;
 
+//hard digest cached in ram, used by open method sync
+typedef struct
+{
+	uint8_t hard_type;
+	uint8_t member_id;
+	uint8_t freeze_state;
+	uint8_t crc8;         //low byte of crc16 over (hard_type, member_id, freeze_state)
+} lock_hard_digest_t;
+
 typedef struct
 {
     uint8_t  message_switch;
@@ -115,6 +126,8 @@ uint32_t lock_hardid_is_valid(uint32_t hardid);
 uint32_t lock_get_vaild_hardid_num(uint8_t hard_type);
 uint32_t lock_hard_save(lock_hard_t* hard);
 uint32_t lock_hard_load(uint8_t hardid, lock_hard_t* hard);
+uint32_t lock_hard_digest_get(uint8_t hardid, lock_hard_digest_t* digest);
+uint32_t lock_hard_generation_get(void);
 uint32_t lock_hard_load_by_password(uint8_t password_len, uint8_t* password, lock_hard_t* hard);
 uint32_t lock_hardid_load_by_memberid(uint8_t memberid, uint8_t* hardtype_array, uint8_t* hradid_array, uint8_t *hradid_num);
 uint32_t lock_hard_delete(uint8_t hardid);
@@ -123,8 +136,8 @@ uint32_t lock_hard_delete_all_by_memberid(uint8_t memberid);
 uint32_t lock_hard_modify_all_by_memberid(uint8_t memberid, uint8_t* time);
 uint32_t lock_hard_freezeorunfreeze(uint8_t hardid, uint8_t freeze_state);
 uint32_t lock_hard_freezeorunfreeze_all_by_memberid(uint8_t memberid, uint8_t freeze_state);
-uint32_t lock_hard_save_in_local_flash(uint8_t meth);
-uint32_t lock_hard_modify_in_local_flash(uint8_t meth);
+uint32_t lock_hard_save_in_local_flash(uint8_t meth, void* cmd);
+uint32_t lock_hard_modify_in_local_flash(uint8_t meth, void* cmd);
 
 /*********************************************************  event  *********************************************************/
 uint32_t lock_next_evtid(uint32_t index);
@@ -6,6 +6,14 @@
 /*********************************************************************
  * LOCAL CONSTANTS
  */
+#define APP_OTA_SECTOR_SIZE         TUYA_NV_ERASE_MIN_SIZE
+#define APP_OTA_ERASE_AHEAD         1   //后台预擦除比写指针超前的扇区数
+#define APP_OTA_ERASE_STEP_US       60000   //扇区擦除时间, 后台擦除第一步就按它等待射频间隙
+#define APP_OTA_PAGE_SIZE           256 //flash 编程页, 按页合并写入
+#define APP_OTA_STEP_OUT_LEN        (2*APP_OTA_PAGE_SIZE) //数据包每步最多写出的长度, 编程时间小于一次扇区擦除
+//压缩差分包一个压缩字节最多解出一个回溯引用 (256 B) 加 flash crc, 按 APP_OTA_UNPACK_OUT_LEN 成块输出
+#define APP_OTA_STAGE_LEN           (5*APP_OTA_UNPACK_OUT_LEN)
+#define APP_OTA_SECTOR_CEIL(len)    ((((len) + APP_OTA_SECTOR_SIZE - 1)/APP_OTA_SECTOR_SIZE)*APP_OTA_SECTOR_SIZE)
 
 /*********************************************************************
  * LOCAL STRUCT
@@ -16,19 +24,69 @@
  */
 static volatile uint8_t  s_ota_state = TUYA_BLE_OTA_REQ;
 static volatile int32_t  s_pkg_id;
-static uint32_t s_data_len;
+static uint32_t s_data_len;     //收到的文件长度
+static uint32_t s_image_len;    //写入 ota 区的固件长度, 差分升级时与 s_data_len 不同
 static uint32_t s_data_crc;
+static cpt_md5_ctx_t s_data_md5; //随数据包累加, 结束时与 file info 中的 md5 比较, 不回读 flash
+//erase, [APP_OTA_START_ADDR, APP_OTA_START_ADDR+s_erase_len) 已擦除
+static uint32_t s_erase_len;
+static uint32_t s_erase_target;
+static bool s_erase_busy;
+static struct co_job s_erase_job;
+//断点续传, 后台重新计算已写入部分的 crc 和 md5, 完成后才回复 offset
+static uint32_t s_resume_len;
+static uint32_t s_resume_crc;
+static bool s_resume_busy;
+static struct co_job s_resume_job;
+//数据包缓存, 解码/写入分步进行, 写完后才回复
+static uint8_t  s_pkg_buf[APP_OTA_PKG_LEN];
+static uint32_t s_pkg_len;
+static uint32_t s_pkg_pos;
+static uint32_t s_pkg_ret;
+static bool s_data_busy;
+static struct co_job s_data_job;
+//压缩差分包解压出的数据, 逐字节交给差分还原, 一个字节最多还原出 APP_OTA_DELTA_ZERO_MAX
+static uint8_t  s_stage_buf[APP_OTA_STAGE_LEN];
+static uint32_t s_stage_len;
+static uint32_t s_stage_pos;
+//write, 数据包先合并到页缓存, 写满一页(或结束/中断)才编程, s_page_offset 为缓存首字节的文件偏移
+static uint8_t  s_page_buf[APP_OTA_PAGE_SIZE];
+static uint32_t s_page_offset;
+static uint32_t s_page_len;
 static volatile bool s_ota_success = false;
 //file info
+static uint8_t  s_file_type;
+static uint32_t s_file_version;
 static app_ota_file_info_storage_t s_file;
-static app_ota_file_info_storage_t s_old_file;
+//断点, 写指针每跨过一个扇区保存一次, 重连后从该处续传
+static app_ota_checkpoint_t s_ckpt;
 
 /*********************************************************************
  * LOCAL FUNCTION
  */
 static uint32_t app_ota_enter(void);
 static uint32_t app_ota_exit(void);
-static uint32_t app_ota_get_crc32_in_flash(uint32_t len);
+static uint32_t app_ota_get_crc32_in_flash(uint32_t offset, uint32_t len, uint32_t crc, cpt_md5_ctx_t* md5);
+static bool app_ota_checkpoint_valid(uint32_t offset);
+static bool app_ota_resume_step(void* p_env);
+static void app_ota_resume_done(void* p_env);
+static void app_ota_checkpoint_save(uint32_t len, uint32_t crc);
+static void app_ota_file_offset_restart(void);
+static uint32_t app_ota_file_offset_rsp(void);
+static bool app_ota_data_step(void* p_env);
+static void app_ota_data_done(void* p_env);
+static void app_ota_data_rsp(uint8_t state);
+static bool app_ota_erase_step(void* p_env);
+static void app_ota_erase_done(void* p_env);
+static void app_ota_erase_ahead(uint32_t len);
+static void app_ota_erase_to(uint32_t len);
+static uint32_t app_ota_write(uint32_t offset, const uint8_t* buf, uint32_t len);
+static uint32_t app_ota_write_flush(void);
+static uint32_t app_ota_image_max_len(void);
+static uint32_t app_ota_image_write(const uint8_t* buf, uint32_t size);
+static uint32_t app_ota_file_write(const uint8_t* buf, uint32_t size);
+static uint32_t app_ota_stage_write(const uint8_t* buf, uint32_t size);
+static uint32_t app_ota_running_read(uint32_t offset, uint8_t* buf, uint32_t size);
 //static void app_ota_setting_write_complete_cb(nrf_fstorage_evt_t* p_evt);
 static uint32_t app_ota_req_handler(uint8_t* cmd, uint16_t cmd_size, tuya_ble_ota_data_response_t* rsp);
 static uint32_t app_ota_file_info_handler(uint8_t* cmd, uint16_t cmd_size, tuya_ble_ota_data_response_t* rsp);
@@ -102,17 +160,24 @@ static uint32_t app_ota_enter(void)
 {
     s_pkg_id = -1;
     s_data_len = 0;
+    s_image_len = 0;
     s_data_crc = 0;
+    s_page_offset = 0;
+    s_page_len = 0;
+    cpt_md5_init(&s_data_md5);
+    cpt_md5_starts(&s_data_md5);
     s_ota_success = false;
+    s_file_type = APP_OTA_FILE_TYPE_FULL;
+    s_file_version = 0;
     memset(&s_file, 0x00, sizeof(app_ota_file_info_storage_t));
-    memset(&s_old_file, 0x00, sizeof(app_ota_file_info_storage_t));
+    memset(&s_ckpt, 0x00, sizeof(app_ota_checkpoint_t));
     
     app_port_conn_param_update(20, 24, 0, 5000);
     app_port_ble_conn_evt_ext();
     
-    tuya_ble_device_enter_critical();
-    app_port_nv_erase(APP_OTA_START_ADDR, APP_OTA_FILE_MAX_LEN);
-    tuya_ble_device_exit_critical();
+    //不再整片擦除, 扇区在第一次写入前擦除
+    s_erase_len = 0;
+    s_erase_target = 0;
     
     return APP_PORT_SUCCESS;
 }
@@ -126,6 +191,18 @@ static uint32_t app_ota_exit(void)
     {
 //        memset(&s_dfu_settings, 0, sizeof(nrf_dfu_settings_t));
     }
+    cpt_md5_free(&s_data_md5);
+    
+    //已收到的数据写入 flash
+    app_ota_write_flush();
+    
+    //停止后台擦除, 下次 ota 从断点处重新擦除, 断点保留在 nv 中
+    co_job_abort(&s_erase_job);
+    s_erase_busy = false;
+    co_job_abort(&s_resume_job);
+    s_resume_busy = false;
+    co_job_abort(&s_data_job);
+    s_data_busy = false;
     
     s_ota_state = TUYA_BLE_OTA_REQ;
     lock_timer_start(LOCK_TIMER_RESET_WITH_DISCONN);
@@ -153,39 +230,285 @@ uint32_t app_ota_disconn_handler(void)
 }
 
 /*********************************************************
-FN: 
+FN: 从 offset 开始 len 字节的 crc, 接在 crc 之后累加, md5 不为 NULL 时同时累加 md5
 */
-static uint32_t app_ota_get_crc32_in_flash(uint32_t len)
+static uint32_t app_ota_get_crc32_in_flash(uint32_t offset, uint32_t len, uint32_t crc, cpt_md5_ctx_t* md5)
 {
     static uint8_t buf[APP_OTA_PKG_LEN];
     
-    if(len == 0)
-    {
-        return 0;
-    }
-    
-    uint32_t crc_temp = 0;
-    uint32_t read_addr = APP_OTA_START_ADDR;
+    uint32_t crc_temp = crc;
+    uint32_t read_addr = APP_OTA_START_ADDR + offset;
     uint32_t cnt = len/APP_OTA_PKG_LEN;
     uint32_t remainder = len%APP_OTA_PKG_LEN;
     
     for(uint32_t idx=0; idx<cnt; idx++)
     {
         tuya_ble_nv_read(read_addr, buf, APP_OTA_PKG_LEN);
-        crc_temp = app_port_crc32_compute(buf, APP_OTA_PKG_LEN, &crc_temp);
+        crc_temp = cpt_crc32_compute(buf, APP_OTA_PKG_LEN, &crc_temp);
+        if(md5 != NULL) {
+            cpt_md5_update(md5, buf, APP_OTA_PKG_LEN);
+        }
         read_addr += APP_OTA_PKG_LEN;
     }
 
     if(remainder > 0)
     {
         tuya_ble_nv_read(read_addr, buf, APP_OTA_PKG_LEN);
-        crc_temp = app_port_crc32_compute(buf, remainder, &crc_temp);
+        crc_temp = cpt_crc32_compute(buf, remainder, &crc_temp);
+        if(md5 != NULL) {
+            cpt_md5_update(md5, buf, remainder);
+        }
         read_addr += remainder;
     }
     
     return crc_temp;
 }
 
+/*********************************************************
+FN: 断点与当前文件一致时可以续传, flash 中的数据由 app_ota_resume_step() 在后台校验
+*/
+static bool app_ota_checkpoint_valid(uint32_t offset)
+{
+    //差分/压缩升级的解码状态不保存, 总是从头开始
+    if((s_file_type != APP_OTA_FILE_TYPE_FULL)
+        || (s_ckpt.version != s_file_version)
+        || (memcmp(&s_ckpt.file, &s_file, sizeof(app_ota_file_info_storage_t)) != 0)
+        || (s_ckpt.data_len == 0)
+        || (s_ckpt.data_len >= s_file.len)
+        || (s_ckpt.data_len%APP_OTA_SECTOR_SIZE != 0)
+        || (offset < s_ckpt.data_len)) {
+        return false;
+    }
+    return true;
+}
+
+/*********************************************************
+FN: 重新计算已写入部分的 crc, 同时恢复 md5, 每步一个扇区
+*/
+static bool app_ota_resume_step(void* p_env)
+{
+    if(s_resume_len < s_ckpt.data_len)
+    {
+        s_resume_crc = app_ota_get_crc32_in_flash(s_resume_len, APP_OTA_SECTOR_SIZE, s_resume_crc, &s_data_md5);
+        s_resume_len += APP_OTA_SECTOR_SIZE;
+    }
+    return (s_resume_len >= s_ckpt.data_len);
+}
+
+/*********************************************************
+FN: flash 中的数据仍然正确时从断点续传, 否则从头开始, 然后回复 offset
+*/
+static void app_ota_resume_done(void* p_env)
+{
+    s_resume_busy = false;
+    
+    if(s_resume_crc == s_ckpt.data_crc)
+    {
+        s_data_len = s_ckpt.data_len;
+        s_image_len = s_ckpt.data_len;
+        s_data_crc = s_ckpt.data_crc;
+        //断点之前的扇区已写满, 之后的扇区可能写了一半, 需要重新擦除
+        co_job_abort(&s_erase_job);
+        s_erase_busy = false;
+        s_erase_len = s_data_len;
+        s_erase_target = s_data_len;
+        APP_DEBUG_PRINTF("ota resume from: %d", s_data_len);
+        //s_pkg_id every time from zero
+    }
+    else
+    {
+        APP_DEBUG_PRINTF("ota checkpoint crc error");
+        app_ota_file_offset_restart();
+    }
+    
+    app_ota_file_offset_rsp();
+}
+
+/*********************************************************
+FN: 
+*/
+static void app_ota_checkpoint_save(uint32_t len, uint32_t crc)
+{
+    s_ckpt.version = s_file_version;
+    memcpy(&s_ckpt.file, &s_file, sizeof(app_ota_file_info_storage_t));
+    s_ckpt.data_len = len;
+    s_ckpt.data_crc = crc;
+    app_port_nv_set(SF_AREA_0, NV_ID_OTA_CHECKPOINT, &s_ckpt, sizeof(app_ota_checkpoint_t));
+}
+
+/*********************************************************
+FN: 后台擦除, 每步一个扇区
+*/
+static bool app_ota_erase_step(void* p_env)
+{
+    if(s_erase_len < s_erase_target)
+    {
+        tuya_ble_device_enter_critical();
+        app_port_nv_erase(APP_OTA_START_ADDR + s_erase_len, APP_OTA_SECTOR_SIZE);
+        tuya_ble_device_exit_critical();
+        s_erase_len += APP_OTA_SECTOR_SIZE;
+    }
+    return (s_erase_len >= s_erase_target);
+}
+
+/*********************************************************
+FN: 
+*/
+static void app_ota_erase_done(void* p_env)
+{
+    s_erase_busy = false;
+}
+
+/*********************************************************
+FN: 在空闲时间擦除到 len 之后 APP_OTA_ERASE_AHEAD 个扇区
+*/
+static void app_ota_erase_ahead(uint32_t len)
+{
+    uint32_t target = APP_OTA_SECTOR_CEIL(len) + APP_OTA_ERASE_AHEAD*APP_OTA_SECTOR_SIZE;
+    
+    if(target > APP_OTA_SECTOR_CEIL(app_ota_image_max_len())) {
+        target = APP_OTA_SECTOR_CEIL(app_ota_image_max_len());
+    }
+    if(target > s_erase_target) {
+        s_erase_target = target;
+    }
+    
+    if((s_erase_len < s_erase_target) && (!s_erase_busy))
+    {
+        s_erase_busy = true;
+        //擦除期间 cpu 停顿, 不与射频事件重叠
+        co_job_start(&s_erase_job, app_ota_erase_step, app_ota_erase_done, NULL, 0, APP_OTA_ERASE_STEP_US, CO_JOB_FLAG_NO_OVERLAP);
+    }
+}
+
+/*********************************************************
+FN: 写入 [0, len) 之前调用, 后台擦除未跟上时同步擦除
+*/
+static void app_ota_erase_to(uint32_t len)
+{
+    while(s_erase_len < len)
+    {
+        tuya_ble_device_enter_critical();
+        app_port_nv_erase(APP_OTA_START_ADDR + s_erase_len, APP_OTA_SECTOR_SIZE);
+        tuya_ble_device_exit_critical();
+        s_erase_len += APP_OTA_SECTOR_SIZE;
+    }
+}
+
+/*********************************************************
+FN: 顺序写入, 页内数据合并后一次编程, 每页只解除/恢复一次写保护
+*/
+static uint32_t app_ota_write(uint32_t offset, const uint8_t* buf, uint32_t len)
+{
+    uint32_t ret = APP_PORT_SUCCESS;
+    
+    if(s_page_len == 0) {
+        s_page_offset = offset;
+    }
+    
+    while(len > 0)
+    {
+        //缓存只到当前页的末尾, 写入地址不跨页
+        uint32_t room = APP_OTA_PAGE_SIZE - ((s_page_offset + s_page_len)%APP_OTA_PAGE_SIZE);
+        uint32_t size = (len < room) ? len : room;
+        
+        memcpy(&s_page_buf[(s_page_offset%APP_OTA_PAGE_SIZE) + s_page_len], buf, size);
+        s_page_len += size;
+        buf += size;
+        len -= size;
+        
+        if(size == room) {
+            ret = app_ota_write_flush();
+            if(ret != APP_PORT_SUCCESS) {
+                break;
+            }
+        }
+    }
+    return ret;
+}
+
+/*********************************************************
+FN: 
+*/
+static uint32_t app_ota_write_flush(void)
+{
+    uint32_t ret = APP_PORT_SUCCESS;
+    
+    if(s_page_len > 0)
+    {
+        ret = app_port_nv_write(APP_OTA_START_ADDR + s_page_offset, &s_page_buf[s_page_offset%APP_OTA_PAGE_SIZE], s_page_len);
+        s_page_offset += s_page_len;
+        s_page_len = 0;
+    }
+    return ret;
+}
+
+/*********************************************************
+FN: 写入 ota 区的固件长度上限, 差分包头/压缩包头收到之前按 ota 区大小
+*/
+static uint32_t app_ota_image_max_len(void)
+{
+    if(s_file_type & APP_OTA_FILE_TYPE_DELTA) {
+        return (app_ota_delta_get_new_len() > 0) ? app_ota_delta_get_new_len() : APP_OTA_FILE_MAX_LEN;
+    }
+    if(s_file_type & APP_OTA_FILE_TYPE_COMPRESSED) {
+        return (app_ota_unpack_get_file_len() > 0) ? app_ota_unpack_get_file_len() : APP_OTA_FILE_MAX_LEN;
+    }
+    return s_file.len;
+}
+
+/*********************************************************
+FN: 固件顺序写入 ota 区, 整包升级时为收到的数据, 差分升级时为还原出的数据
+*/
+static uint32_t app_ota_image_write(const uint8_t* buf, uint32_t size)
+{
+    uint32_t ret;
+    
+    if(size > APP_OTA_FILE_MAX_LEN - s_image_len) {
+        return APP_PORT_ERROR_COMMON;
+    }
+    
+    app_ota_erase_to(s_image_len + size);
+    ret = app_ota_write(s_image_len, buf, size);
+    if(ret == APP_PORT_SUCCESS) {
+        s_image_len += size;
+        app_ota_erase_ahead(s_image_len);
+    }
+    return ret;
+}
+
+/*********************************************************
+FN: 解压后的文件, 差分包还原后写入, 整包直接写入
+*/
+static uint32_t app_ota_file_write(const uint8_t* buf, uint32_t size)
+{
+    if(s_file_type & APP_OTA_FILE_TYPE_DELTA) {
+        return (app_ota_delta_apply(buf, size) == APP_OTA_DELTA_SUCCESS) ? APP_PORT_SUCCESS : APP_PORT_ERROR_COMMON;
+    }
+    return app_ota_image_write(buf, size);
+}
+
+/*********************************************************
+FN: 压缩差分包的解压输出先缓存, 由 app_ota_data_step 分步交给差分还原
+*/
+static uint32_t app_ota_stage_write(const uint8_t* buf, uint32_t size)
+{
+    if(s_stage_len + size > APP_OTA_STAGE_LEN) {
+        return APP_PORT_ERROR_COMMON;
+    }
+    memcpy(&s_stage_buf[s_stage_len], buf, size);
+    s_stage_len += size;
+    return APP_PORT_SUCCESS;
+}
+
+/*********************************************************
+FN: 差分升级的旧固件, 即当前运行的固件
+*/
+static uint32_t app_ota_running_read(uint32_t offset, uint8_t* buf, uint32_t size)
+{
+    return app_port_nv_read(APP_OTA_RUNNING_ADDR + offset, buf, size);
+}
+
 /*********************************************************
 FN: 
 */
@@ -265,7 +588,7 @@ static uint32_t app_ota_file_info_handler(uint8_t* cmd, uint16_t cmd_size, tuya_
 
     //param check
     app_ota_file_info_t* file_info = (void*)cmd;
-    if(file_info->type != 0x00)
+    if(file_info->type & ~APP_OTA_FILE_TYPE_ALL)
     {
         APP_DEBUG_PRINTF("Error: TUYA_BLE_OTA_FILE_INFO- file_info->type error");
         //rsp none
@@ -278,6 +601,8 @@ static uint32_t app_ota_file_info_handler(uint8_t* cmd, uint16_t cmd_size, tuya_
         app_port_reverse_byte(&file_info->version, sizeof(uint32_t));
         app_port_reverse_byte(&file_info->file_len, sizeof(uint32_t));
         app_port_reverse_byte(&file_info->crc32, sizeof(uint32_t));
+        s_file_type = file_info->type;
+        s_file_version = file_info->version;
         s_file.len = file_info->file_len;
         s_file.crc32 = file_info->crc32;
         memcpy(s_file.md5, file_info->md5, APP_OTA_FILE_MD5_LEN);
@@ -285,7 +610,7 @@ static uint32_t app_ota_file_info_handler(uint8_t* cmd, uint16_t cmd_size, tuya_
         //rsp
         app_ota_file_info_rsp_t file_info_rsp;
         memset(&file_info_rsp, 0x00, sizeof(app_ota_file_info_rsp_t));
-        file_info_rsp.type = 0x00; //firmware info
+        file_info_rsp.type = s_file_type;
         if(memcmp(file_info->pid, TUYA_DEVICE_PID, APP_PORT_PID_LEN)) {
             file_info_rsp.state = 0x01; //pid error
         }
@@ -299,11 +624,13 @@ static uint32_t app_ota_file_info_handler(uint8_t* cmd, uint16_t cmd_size, tuya_
             s_ota_state = TUYA_BLE_OTA_FILE_OFFSET_REQ;
         }
         
-        app_port_nv_get(SF_AREA_0, NV_ID_OTA_DATA_LEN, &s_old_file.len, sizeof(uint32_t));
-        app_port_nv_get(SF_AREA_0, NV_ID_OTA_DATA_CRC, &s_old_file.crc32, sizeof(uint32_t));
-        file_info_rsp.old_file_len = s_old_file.len;
+        //上次中断的进度
+        if(app_port_nv_get(SF_AREA_0, NV_ID_OTA_CHECKPOINT, &s_ckpt, sizeof(app_ota_checkpoint_t)) != APP_PORT_SUCCESS) {
+            memset(&s_ckpt, 0x00, sizeof(app_ota_checkpoint_t));
+        }
+        file_info_rsp.old_file_len = s_ckpt.data_len;
         app_port_reverse_byte(&file_info_rsp.old_file_len, sizeof(uint32_t));
-        file_info_rsp.old_crc32 = s_old_file.crc32;
+        file_info_rsp.old_crc32 = s_ckpt.data_crc;
         app_port_reverse_byte(&file_info_rsp.old_crc32, sizeof(uint32_t));
         memset(file_info_rsp.old_md5, 0x00, APP_OTA_FILE_MD5_LEN);
         app_ota_rsp(rsp, &file_info_rsp, sizeof(app_ota_file_info_rsp_t));
@@ -332,7 +659,7 @@ static uint32_t app_ota_file_offset_handler(uint8_t* cmd, uint16_t cmd_size, tuy
 
     //param check
     app_ota_file_offset_t* file_offset = (void*)cmd;
-    if(file_offset->type != 0x00)
+    if(file_offset->type != s_file_type)
     {
         APP_DEBUG_PRINTF("Error: TUYA_BLE_OTA_FILE_OFFSET_REQ- file_offset->type error");
         //rsp none
@@ -340,37 +667,68 @@ static uint32_t app_ota_file_offset_handler(uint8_t* cmd, uint16_t cmd_size, tuy
         return APP_PORT_ERROR_COMMON;
     }
     
+    app_port_reverse_byte(&file_offset->offset, sizeof(uint32_t));
+    
+    //重发的请求, 上一个请求的断点校验完成后回复
+    if(s_resume_busy)
     {
-        app_port_reverse_byte(&file_offset->offset, sizeof(uint32_t));
-        
-        //rsp
-        app_ota_file_offset_rsp_t file_offset_rsp;
-        memset(&file_offset_rsp, 0x00, sizeof(app_ota_file_offset_rsp_t));
-        file_offset_rsp.type = 0x00;
-        {
-            if(file_offset->offset > 0)
-            {
-                uint8_t md5[APP_OTA_FILE_MD5_LEN];
-                app_port_nv_get(SF_AREA_0, NV_ID_OTA_DATA_LEN, &s_old_file.len, sizeof(uint32_t));
-                app_port_nv_get(SF_AREA_0, NV_ID_OTA_DATA_CRC, &s_old_file.crc32, sizeof(uint32_t));
-                app_port_nv_get(SF_AREA_0, NV_ID_OTA_FILE_MD5, md5, APP_OTA_FILE_MD5_LEN);
-                if((memcmp(md5, s_file.md5, APP_OTA_FILE_MD5_LEN) == 0) && (app_ota_get_crc32_in_flash(s_data_len) == s_data_crc) && (file_offset->offset >= s_data_len)) {
-                    file_offset_rsp.offset = s_data_len;
-//                    s_pkg_id = s_data_len/APP_OTA_PKG_LEN;//every time from zero
-                } else {
-                    file_offset_rsp.offset = 0;
-                    s_data_len = 0;
-                    s_data_crc = 0;
-                }
-            }
-            app_port_nv_set(SF_AREA_0, NV_ID_OTA_FILE_MD5, &s_file.md5, APP_OTA_FILE_MD5_LEN);
-        }
-        app_port_reverse_byte(&file_offset_rsp.offset, sizeof(uint32_t));
-        
-        app_ota_rsp(rsp, &file_offset_rsp, sizeof(app_ota_file_offset_rsp_t));
-        s_ota_state = TUYA_BLE_OTA_DATA;
+        APP_DEBUG_PRINTF("TUYA_BLE_OTA_FILE_OFFSET_REQ- checkpoint check pending");
+        return APP_PORT_SUCCESS;
     }
-    return APP_PORT_SUCCESS;
+    
+    if((file_offset->offset > 0) && app_ota_checkpoint_valid(file_offset->offset))
+    {
+        //已写入部分可能有上百 KB, 分步校验, 不在回调中占用 cpu
+        s_resume_len = 0;
+        s_resume_crc = 0;
+        cpt_md5_starts(&s_data_md5);
+        s_resume_busy = true;
+        co_job_start(&s_resume_job, app_ota_resume_step, app_ota_resume_done, NULL, 0, 0, 0);
+        return APP_PORT_SUCCESS;
+    }
+    
+    app_ota_file_offset_restart();
+    return app_ota_file_offset_rsp();
+}
+
+/*********************************************************
+FN: 不续传, 从文件头开始接收
+*/
+static void app_ota_file_offset_restart(void)
+{
+    s_data_len = 0;
+    s_image_len = 0;
+    s_data_crc = 0;
+    cpt_md5_starts(&s_data_md5);
+    if(s_file_type & APP_OTA_FILE_TYPE_DELTA) {
+        app_ota_delta_start(APP_OTA_RUNNING_MAX_LEN, APP_OTA_FILE_MAX_LEN, app_ota_running_read, app_ota_image_write);
+    }
+    if(s_file_type & APP_OTA_FILE_TYPE_COMPRESSED) {
+        app_ota_unpack_start(APP_OTA_FILE_MAX_LEN, (s_file_type & APP_OTA_FILE_TYPE_DELTA) ? app_ota_stage_write : app_ota_file_write);
+    }
+    s_stage_len = 0;
+    s_stage_pos = 0;
+}
+
+/*********************************************************
+FN: 续传与否确定后回复 offset, 开始接收数据
+*/
+static uint32_t app_ota_file_offset_rsp(void)
+{
+    tuya_ble_ota_data_response_t rsp;
+    app_ota_file_offset_rsp_t file_offset_rsp;
+    
+    rsp.type = TUYA_BLE_OTA_FILE_OFFSET_REQ;
+    memset(&file_offset_rsp, 0x00, sizeof(app_ota_file_offset_rsp_t));
+    file_offset_rsp.type = s_file_type;
+    file_offset_rsp.offset = s_data_len;
+    app_ota_checkpoint_save(s_data_len, s_data_crc);
+    //续传与否确定后才能开始擦除
+    app_ota_erase_ahead(s_image_len);
+    app_port_reverse_byte(&file_offset_rsp.offset, sizeof(uint32_t));
+    
+    s_ota_state = TUYA_BLE_OTA_DATA;
+    return app_ota_rsp(&rsp, &file_offset_rsp, sizeof(app_ota_file_offset_rsp_t));
 }
 
 /*********************************************************
@@ -394,7 +752,7 @@ static uint32_t app_ota_data_handler(uint8_t* cmd, uint16_t cmd_size, tuya_ble_o
 
     //param check
     app_ota_data_t* ota_data = (void*)cmd;
-    if(ota_data->type != 0x00)
+    if(ota_data->type != s_file_type)
     {
         APP_DEBUG_PRINTF("Error: TUYA_BLE_OTA_DATA- ota_data->type error");
         //rsp
@@ -407,85 +765,169 @@ static uint32_t app_ota_data_handler(uint8_t* cmd, uint16_t cmd_size, tuya_ble_o
         return APP_PORT_ERROR_COMMON;
     }
     
+    //重发的包, 上一包写完后回复
+    if(s_data_busy)
+    {
+        APP_DEBUG_PRINTF("TUYA_BLE_OTA_DATA- previous package pending");
+        return APP_PORT_SUCCESS;
+    }
+    
+    app_port_reverse_byte(&ota_data->pkg_id, sizeof(uint16_t));
+    app_port_reverse_byte(&ota_data->len, sizeof(uint16_t));
+    app_port_reverse_byte(&ota_data->crc16, sizeof(uint16_t));
+    
+    if(s_pkg_id+1 != ota_data->pkg_id) {
+        app_ota_data_rsp(0x01); //package id error
+        return APP_PORT_SUCCESS;
+    }
+    else if((cmd_size-7 != ota_data->len) || (ota_data->len > APP_OTA_PKG_LEN)) {
+        app_ota_data_rsp(0x02); //size error, 超过 package_maxlen 的包放不进 s_pkg_buf
+        return APP_PORT_SUCCESS;
+    }
+    else if(cpt_crc16_compute(ota_data->data, ota_data->len, NULL) != ota_data->crc16) {
+        app_ota_data_rsp(0x03); //crc error
+        return APP_PORT_SUCCESS;
+    }
+    
+    memcpy(s_pkg_buf, ota_data->data, ota_data->len);
+    s_pkg_len = ota_data->len;
+    s_pkg_pos = 0;
+    s_pkg_ret = APP_PORT_SUCCESS;
+    if(app_ota_data_step(NULL))
     {
-        app_port_reverse_byte(&ota_data->pkg_id, sizeof(uint16_t));
-        app_port_reverse_byte(&ota_data->len, sizeof(uint16_t));
-        app_port_reverse_byte(&ota_data->crc16, sizeof(uint16_t));
+        app_ota_data_done(NULL);
+    }
+    else
+    {
+        //差分/压缩包一包可能还原出几 KB, 或者擦除没跟上, 剩下的在空闲时间写入
+        s_data_busy = true;
+        co_job_start(&s_data_job, app_ota_data_step, app_ota_data_done, NULL, 0, 0, CO_JOB_FLAG_NO_OVERLAP);
+    }
+    return APP_PORT_SUCCESS;
+}
+
+/*********************************************************
+FN: 包缓存分步写入, 每步输出约 APP_OTA_STEP_OUT_LEN; 擦除没跟上时等后台擦除, 不在回调中同步擦除
+*/
+static bool app_ota_data_step(void* p_env)
+{
+    uint32_t image_len = s_image_len;
+    uint32_t erase_max = APP_OTA_SECTOR_CEIL(app_ota_image_max_len());
+    
+    while(((s_pkg_pos < s_pkg_len) || (s_stage_pos < s_stage_len)) && (s_pkg_ret == APP_PORT_SUCCESS))
+    {
+        uint32_t size = s_pkg_len - s_pkg_pos;
+        uint32_t need = s_image_len + APP_OTA_STAGE_LEN; //一次写入最多输出 APP_OTA_STAGE_LEN
         
-        //rsp
-        app_ota_data_rsp_t ota_data_rsp;
-        memset(&ota_data_rsp, 0x00, sizeof(app_ota_data_rsp_t));
-        ota_data_rsp.type = 0x00;
-        if(s_pkg_id+1 != ota_data->pkg_id) {
-            ota_data_rsp.state = 0x01; //package id error
+        //差分包头之后先校验运行中固件的 crc, 每步一个读窗口, 校验完才继续还原
+        if((s_file_type & APP_OTA_FILE_TYPE_DELTA) && app_ota_delta_base_busy()) {
+            if(app_ota_delta_base_step() != APP_OTA_DELTA_SUCCESS) {
+                s_pkg_ret = APP_PORT_ERROR_COMMON;
+                return true;
+            }
+            return false;
         }
-        else if(cmd_size-7 != ota_data->len) {
-            ota_data_rsp.state = 0x02; //size error
+        if(s_image_len - image_len >= APP_OTA_STEP_OUT_LEN) {
+            return false;
         }
-        else if(app_port_crc16_compute(ota_data->data, ota_data->len, NULL) != ota_data->crc16) {
-            ota_data_rsp.state = 0x03; //crc error
-        } else {
-            ota_data_rsp.state = 0x00;
-            
-            //erase
-//            bool flag_4k = false;
-//            if((s_data_len == 0) || ((s_data_len + ota_data->len) >= (((s_data_len/TUYA_NV_ERASE_MIN_SIZE) + 1)*TUYA_NV_ERASE_MIN_SIZE)))
-//            {
-//                if(s_data_len == 0)
-//                {
-//                    app_port_nv_erase(APP_OTA_START_ADDR, TUYA_NV_ERASE_MIN_SIZE);
-//                }
-//                uint32_t erase_addr = APP_OTA_START_ADDR + (((s_data_len/TUYA_NV_ERASE_MIN_SIZE) + 1)*TUYA_NV_ERASE_MIN_SIZE);
-//                app_port_nv_erase(erase_addr, TUYA_NV_ERASE_MIN_SIZE);
-//                if(s_data_len + ota_data->len == s_file.len)
-//                {
-//                    for(uint32_t idx=0; idx<(APP_OTA_END_ADDR - erase_addr)/TUYA_NV_ERASE_MIN_SIZE; idx++)
-//                    {
-//                        app_port_nv_erase(erase_addr + idx*TUYA_NV_ERASE_MIN_SIZE, TUYA_NV_ERASE_MIN_SIZE);
-//                    }
-//                }
-//                
-//                flag_4k = true;
-//            }
-            
-            if(APP_PORT_SUCCESS != app_port_nv_write(APP_OTA_START_ADDR + s_data_len, ota_data->data, ota_data->len))
-            {
-                ota_data_rsp.state = 0x04; //write error
-            }
-            else
-            {
-                s_data_len += ota_data->len;
-                if(s_data_len < s_file.len)
-                {
-                    APP_DEBUG_PRINTF("s_pkg_id: %d", s_pkg_id);
-                    s_ota_state = TUYA_BLE_OTA_DATA;
-                }
-                else if(s_data_len == s_file.len)
-                {
-                    s_ota_state = TUYA_BLE_OTA_END;
-                }
-                else
-                {
-                    ota_data_rsp.state = 0x04;
-                }
-                s_pkg_id++;
-                
-                s_data_crc = app_port_crc32_compute(ota_data->data, ota_data->len, &s_data_crc);
-//                if(flag_4k)
-//                {
-//                    app_port_nv_set(SF_AREA_0, NV_ID_OTA_DATA_LEN, &s_data_len, sizeof(uint32_t));
-//                    app_port_nv_set(SF_AREA_0, NV_ID_OTA_DATA_CRC, &s_data_crc, sizeof(uint32_t));
-//                }
+        if(need > erase_max) {
+            need = erase_max;
+        }
+        if(s_erase_len < need) {
+            app_ota_erase_ahead(s_image_len);
+            return false;
+        }
+        
+        //压缩差分包: 上一个压缩字节解出的数据还原完, 才解压下一个字节
+        if(s_stage_pos < s_stage_len) {
+            s_pkg_ret = app_ota_file_write(&s_stage_buf[s_stage_pos], 1);
+            if(++s_stage_pos == s_stage_len) {
+                s_stage_pos = 0;
+                s_stage_len = 0;
             }
+            continue;
         }
-        app_ota_rsp(rsp, &ota_data_rsp, sizeof(app_ota_data_rsp_t));
         
-        if(ota_data_rsp.state != 0x00) {
-            APP_DEBUG_PRINTF("Error: TUYA_BLE_OTA_DATA- errorid: %d", ota_data_rsp.state);
-            app_ota_exit();
+        //差分/压缩包逐字节解码, 一个字节的输出有上限 (APP_OTA_DELTA_ZERO_MAX, 一个回溯引用)
+        if(s_file_type != APP_OTA_FILE_TYPE_FULL) {
+            size = 1;
+        }
+        //压缩包边收边解压, 解压后文件的 crc/md5 由 app_ota_unpack 校验
+        if(s_file_type & APP_OTA_FILE_TYPE_COMPRESSED) {
+            s_pkg_ret = (app_ota_unpack_apply(&s_pkg_buf[s_pkg_pos], size) == APP_OTA_UNPACK_SUCCESS) ? APP_PORT_SUCCESS : APP_PORT_ERROR_COMMON;
+        } else {
+            s_pkg_ret = app_ota_file_write(&s_pkg_buf[s_pkg_pos], size);
         }
+        s_pkg_pos += size;
+    }
+    return true;
+}
+
+/*********************************************************
+FN: 一包写完, 累加 crc/md5, 保存断点, 回复
+*/
+static void app_ota_data_done(void* p_env)
+{
+    s_data_busy = false;
+    
+    if(s_pkg_ret != APP_PORT_SUCCESS)
+    {
+        app_ota_data_rsp(0x04); //write error
+        return;
+    }
+    
+    //跨过扇区边界时保存断点, 断点处的 crc 只包含边界之前的数据
+    //扇区边界也是页边界, 断点之前的页缓存已经写入 flash; 差分/压缩升级不保存断点
+    uint32_t ckpt_len = 0;
+    if(s_file_type == APP_OTA_FILE_TYPE_FULL) {
+        ckpt_len = ((s_data_len + s_pkg_len)/APP_OTA_SECTOR_SIZE)*APP_OTA_SECTOR_SIZE;
+    }
+    uint32_t head_len = 0;
+    if(ckpt_len > s_data_len) {
+        head_len = ckpt_len - s_data_len;
+        s_data_crc = cpt_crc32_compute(s_pkg_buf, head_len, &s_data_crc);
+        app_ota_checkpoint_save(ckpt_len, s_data_crc);
+    }
+    s_data_crc = cpt_crc32_compute(s_pkg_buf + head_len, s_pkg_len - head_len, &s_data_crc);
+    cpt_md5_update(&s_data_md5, s_pkg_buf, s_pkg_len);
+    
+    s_data_len += s_pkg_len;
+    s_pkg_id++;
+    if(s_data_len < s_file.len)
+    {
+        APP_DEBUG_PRINTF("s_pkg_id: %d", s_pkg_id);
+        s_ota_state = TUYA_BLE_OTA_DATA;
+    }
+    else if(s_data_len == s_file.len)
+    {
+        s_ota_state = TUYA_BLE_OTA_END;
+    }
+    else
+    {
+        app_ota_data_rsp(0x04);
+        return;
+    }
+    app_ota_data_rsp(0x00);
+}
+
+/*********************************************************
+FN: 
+*/
+static void app_ota_data_rsp(uint8_t state)
+{
+    tuya_ble_ota_data_response_t rsp;
+    app_ota_data_rsp_t ota_data_rsp;
+    
+    rsp.type = TUYA_BLE_OTA_DATA;
+    memset(&ota_data_rsp, 0x00, sizeof(app_ota_data_rsp_t));
+    ota_data_rsp.type = s_file_type;
+    ota_data_rsp.state = state;
+    app_ota_rsp(&rsp, &ota_data_rsp, sizeof(app_ota_data_rsp_t));
+    
+    if(state != 0x00) {
+        APP_DEBUG_PRINTF("Error: TUYA_BLE_OTA_DATA- errorid: %d", state);
+        app_ota_exit();
     }
-    return APP_PORT_SUCCESS;
 }
 
 /*********************************************************
@@ -508,7 +950,7 @@ static uint32_t app_ota_end_handler(uint8_t* cmd, uint16_t cmd_size, tuya_ble_ot
     }
 
     //param check
-    if((cmd_size != 0x0001) || (*cmd != 0x00))
+    if((cmd_size != 0x0001) || (*cmd != s_file_type))
     {
         APP_DEBUG_PRINTF("Error: TUYA_BLE_OTA_END- type error");
         //rsp
@@ -522,32 +964,62 @@ static uint32_t app_ota_end_handler(uint8_t* cmd, uint16_t cmd_size, tuya_ble_ot
     }
     
     {
+        uint8_t md5[APP_OTA_FILE_MD5_LEN];
+        uint32_t unpack_ret = APP_OTA_UNPACK_SUCCESS;
+        uint32_t delta_ret = APP_OTA_DELTA_SUCCESS;
+        cpt_md5_finish(&s_data_md5, md5);
+        //解压出的最后数据先交给差分还原
+        if(s_file_type & APP_OTA_FILE_TYPE_COMPRESSED) {
+            unpack_ret = app_ota_unpack_finish();
+        }
+        if((s_file_type & APP_OTA_FILE_TYPE_DELTA) && (unpack_ret == APP_OTA_UNPACK_SUCCESS)) {
+            delta_ret = app_ota_delta_finish();
+        }
+        //最后不满一页的数据, image_len 的检查需要从 flash 读取
+        app_ota_write_flush();
+        
         app_port_nv_del(SF_AREA_0, NV_ID_OTA_DATA_LEN);
         app_port_nv_del(SF_AREA_0, NV_ID_OTA_DATA_CRC);
         app_port_nv_del(SF_AREA_0, NV_ID_OTA_FILE_MD5);
+        app_port_nv_del(SF_AREA_0, NV_ID_OTA_CHECKPOINT);
         
         //rsp
         app_ota_end_rsp_t end_rsp;
         memset(&end_rsp, 0x00, sizeof(app_ota_end_rsp_t));
-        end_rsp.type = 0x00;
+        end_rsp.type = s_file_type;
         if(s_data_len != s_file.len)
         {
             end_rsp.state = 0x01; //total size error
         }
-        else if(s_file.crc32 != app_ota_get_crc32_in_flash(s_data_len))
+        else if(s_file.crc32 != s_data_crc)
         {
             end_rsp.state = 0x02; //crc error
         }
+        else if(memcmp(md5, s_file.md5, APP_OTA_FILE_MD5_LEN) != 0)
+        {
+            APP_DEBUG_HEXDUMP("md5 error, calc", md5, APP_OTA_FILE_MD5_LEN);
+            end_rsp.state = 0x02; //md5 error, 协议中无单独的状态码
+        }
+        else if(unpack_ret != APP_OTA_UNPACK_SUCCESS)
+        {
+            APP_DEBUG_PRINTF("unpack error: %d", unpack_ret);
+            end_rsp.state = 0x02; //压缩数据格式错误或解压后的文件 crc/md5 错误
+        }
+        else if(delta_ret != APP_OTA_DELTA_SUCCESS)
+        {
+            APP_DEBUG_PRINTF("delta error: %d", delta_ret);
+            end_rsp.state = 0x02; //差分还原的固件 crc 错误或补丁与当前固件不匹配
+        }
         else
         {
             {
-                uint16_t image_len; //ֵbkĹ̼бʶ̼ȣλ4ֽڣ飬ֹԽ
+                uint16_t image_len; //该值在bk的固件中标识固件长度（单位：4字节），在这里做检查，防止越界
                 app_port_nv_read(APP_OTA_START_ADDR+6, (void*)&image_len, sizeof(uint16_t));
                 APP_DEBUG_PRINTF("image_len: %dbyte", image_len*4);
                 if(image_len > (APP_OTA_FILE_MAX_LEN/4))
                 {
                     tuya_ble_device_enter_critical();
-                    app_port_nv_erase(APP_OTA_START_ADDR, APP_OTA_FILE_MAX_LEN);
+                    app_port_nv_erase(APP_OTA_START_ADDR, s_erase_len);
                     tuya_ble_device_exit_critical();
                     end_rsp.state = 0x01;
                 }
@@ -35,6 +35,14 @@ extern "C"
 #define APP_OTA_START_ADDR      BK_FLASH_OTA_START_ADDR
 #define APP_OTA_END_ADDR        BK_FLASH_OTA_END_ADDR
 #define APP_OTA_FILE_MAX_LEN    (APP_OTA_END_ADDR-APP_OTA_START_ADDR)
+#define APP_OTA_RUNNING_ADDR    BK_FLASH_APP_IMAGE_ADDR
+#define APP_OTA_RUNNING_MAX_LEN (BK_FLASH_APP_END_ADDR-BK_FLASH_APP_IMAGE_ADDR)
+
+//file type, negotiated in file info and repeated in every following command
+#define APP_OTA_FILE_TYPE_FULL          0x00 //firmware
+#define APP_OTA_FILE_TYPE_DELTA         0x01 //flag, patch against the running firmware, see app_ota_delta.h
+#define APP_OTA_FILE_TYPE_COMPRESSED    0x02 //flag, firmware or patch packed, see app_ota_unpack.h
+#define APP_OTA_FILE_TYPE_ALL           (APP_OTA_FILE_TYPE_DELTA | APP_OTA_FILE_TYPE_COMPRESSED)
 
 /*********************************************************************
  * STRUCT
@@ -98,6 +106,14 @@ typedef struct{
     uint32_t crc32;
     uint8_t  md5[APP_OTA_FILE_MD5_LEN];
 } app_ota_file_info_storage_t;
+
+//resume point, saved each time the write pointer crosses a sector boundary
+typedef struct{
+	uint32_t version;
+    app_ota_file_info_storage_t file;
+    uint32_t data_len; //sector aligned, [0, data_len) written
+    uint32_t data_crc; //crc32 of [0, data_len)
+} app_ota_checkpoint_t;
 #pragma pack()
 
 /*********************************************************************
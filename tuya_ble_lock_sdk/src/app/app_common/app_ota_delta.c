@@ -0,0 +1,424 @@
+#include "app_ota_delta.h"
+
+
+
+
+/*********************************************************************
+ * LOCAL CONSTANTS
+ */
+enum {
+    APP_OTA_DELTA_STATE_HEAD = 0,
+    APP_OTA_DELTA_STATE_BASE,       //running image crc being checked, app_ota_delta_base_step()
+    APP_OTA_DELTA_STATE_DIFF_LEN,
+    APP_OTA_DELTA_STATE_ZERO_LEN,
+    APP_OTA_DELTA_STATE_LIT_LEN,
+    APP_OTA_DELTA_STATE_LIT,
+    APP_OTA_DELTA_STATE_EXTRA_LEN,
+    APP_OTA_DELTA_STATE_EXTRA,
+    APP_OTA_DELTA_STATE_SEEK,
+    APP_OTA_DELTA_STATE_DONE,
+    APP_OTA_DELTA_STATE_ERROR,
+};
+
+/*********************************************************************
+ * LOCAL STRUCT
+ */
+
+/*********************************************************************
+ * LOCAL VARIABLES
+ */
+static app_ota_delta_read_t  s_read;
+static app_ota_delta_write_t s_write;
+static uint32_t s_old_max_len;
+static uint32_t s_new_max_len;
+static uint8_t  s_state;
+static uint32_t s_error;
+//header
+static uint8_t  s_head[APP_OTA_DELTA_HEAD_LEN];
+static uint32_t s_head_len;
+static uint32_t s_old_len;
+static uint32_t s_new_len;
+static uint32_t s_new_crc;
+//running image crc, checked one window at a time
+static uint32_t s_base_pos;
+static uint32_t s_base_crc;
+//varint being decoded, may span several packets
+static uint32_t s_varint;
+static uint8_t  s_varint_shift;
+//position
+static uint32_t s_old_pos;
+static uint32_t s_new_pos;      //new bytes produced, s_out included
+static uint32_t s_diff_left;    //bytes left in the current diff block
+static uint32_t s_count;        //bytes left in the current literal/extra run
+static uint32_t s_crc;
+//old image cache, [s_old_buf_pos, s_old_buf_pos+s_old_buf_len)
+static uint8_t  s_old_buf[APP_OTA_DELTA_OLD_WINDOW];
+static uint32_t s_old_buf_pos;
+static uint32_t s_old_buf_len;
+//new image bytes not yet written
+static uint8_t  s_out[APP_OTA_DELTA_OUT_LEN];
+static uint32_t s_out_len;
+
+/*********************************************************************
+ * LOCAL FUNCTION
+ */
+static uint32_t app_ota_delta_fail(uint32_t error);
+static uint32_t app_ota_delta_get_u32(const uint8_t* buf);
+static uint32_t app_ota_delta_head(void);
+static bool app_ota_delta_varint(uint8_t byte);
+static uint32_t app_ota_delta_length(uint32_t len);
+static uint8_t app_ota_delta_old_byte(void);
+static uint32_t app_ota_delta_out(uint8_t byte);
+static uint32_t app_ota_delta_flush(void);
+
+/*********************************************************************
+ * VARIABLES
+ */
+
+
+
+
+/*********************************************************
+FN: old_max_len/new_max_len: size of the running image area and of the ota area
+*/
+void app_ota_delta_start(uint32_t old_max_len, uint32_t new_max_len, app_ota_delta_read_t read, app_ota_delta_write_t write)
+{
+    s_read = read;
+    s_write = write;
+    s_old_max_len = old_max_len;
+    s_new_max_len = new_max_len;
+    s_state = APP_OTA_DELTA_STATE_HEAD;
+    s_error = APP_OTA_DELTA_SUCCESS;
+
+    s_head_len = 0;
+    s_old_len = 0;
+    s_new_len = 0;
+    s_new_crc = 0;
+    s_base_pos = 0;
+    s_base_crc = 0;
+    s_varint = 0;
+    s_varint_shift = 0;
+    s_old_pos = 0;
+    s_new_pos = 0;
+    s_diff_left = 0;
+    s_count = 0;
+    s_crc = 0;
+    s_old_buf_pos = 0;
+    s_old_buf_len = 0;
+    s_out_len = 0;
+}
+
+/*********************************************************
+FN: feed the next patch bytes, any split of the patch gives the same image
+*/
+uint32_t app_ota_delta_apply(const uint8_t* buf, uint32_t size)
+{
+    for(; size > 0; buf++, size--)
+    {
+        uint8_t byte = *buf;
+        uint32_t ret = APP_OTA_DELTA_SUCCESS;
+
+        //a caller that does not step the base check gets it done here, in one go
+        while(s_state == APP_OTA_DELTA_STATE_BASE) {
+            app_ota_delta_base_step();
+        }
+
+        switch(s_state)
+        {
+            case APP_OTA_DELTA_STATE_HEAD: {
+                s_head[s_head_len++] = byte;
+                if(s_head_len == APP_OTA_DELTA_HEAD_LEN) {
+                    ret = app_ota_delta_head();
+                }
+            } break;
+
+            case APP_OTA_DELTA_STATE_DIFF_LEN: {
+                if(app_ota_delta_varint(byte)) {
+                    ret = app_ota_delta_length(s_varint);
+                    if((ret == APP_OTA_DELTA_SUCCESS) && (s_varint > s_old_len - s_old_pos)) {
+                        ret = APP_OTA_DELTA_ERROR_FORMAT;
+                    }
+                    s_diff_left = s_varint;
+                    s_state = (s_diff_left > 0) ? APP_OTA_DELTA_STATE_ZERO_LEN : APP_OTA_DELTA_STATE_EXTRA_LEN;
+                }
+            } break;
+
+            case APP_OTA_DELTA_STATE_ZERO_LEN: {
+                if(app_ota_delta_varint(byte)) {
+                    if((s_varint > s_diff_left) || (s_varint > APP_OTA_DELTA_ZERO_MAX)) {
+                        ret = APP_OTA_DELTA_ERROR_FORMAT;
+                        break;
+                    }
+                    //unchanged bytes, copied from the old image
+                    s_diff_left -= s_varint;
+                    for(; (s_varint > 0) && (ret == APP_OTA_DELTA_SUCCESS); s_varint--) {
+                        ret = app_ota_delta_out(app_ota_delta_old_byte());
+                    }
+                    s_state = APP_OTA_DELTA_STATE_LIT_LEN;
+                }
+            } break;
+
+            case APP_OTA_DELTA_STATE_LIT_LEN: {
+                if(app_ota_delta_varint(byte)) {
+                    if(s_varint > s_diff_left) {
+                        ret = APP_OTA_DELTA_ERROR_FORMAT;
+                        break;
+                    }
+                    s_count = s_varint;
+                    s_diff_left -= s_count;
+                    if(s_count > 0) {
+                        s_state = APP_OTA_DELTA_STATE_LIT;
+                    } else {
+                        s_state = (s_diff_left > 0) ? APP_OTA_DELTA_STATE_ZERO_LEN : APP_OTA_DELTA_STATE_EXTRA_LEN;
+                    }
+                }
+            } break;
+
+            case APP_OTA_DELTA_STATE_LIT: {
+                ret = app_ota_delta_out(app_ota_delta_old_byte() + byte);
+                if(--s_count == 0) {
+                    s_state = (s_diff_left > 0) ? APP_OTA_DELTA_STATE_ZERO_LEN : APP_OTA_DELTA_STATE_EXTRA_LEN;
+                }
+            } break;
+
+            case APP_OTA_DELTA_STATE_EXTRA_LEN: {
+                if(app_ota_delta_varint(byte)) {
+                    ret = app_ota_delta_length(s_varint);
+                    s_count = s_varint;
+                    s_state = (s_count > 0) ? APP_OTA_DELTA_STATE_EXTRA : APP_OTA_DELTA_STATE_SEEK;
+                }
+            } break;
+
+            case APP_OTA_DELTA_STATE_EXTRA: {
+                ret = app_ota_delta_out(byte);
+                if(--s_count == 0) {
+                    s_state = APP_OTA_DELTA_STATE_SEEK;
+                }
+            } break;
+
+            case APP_OTA_DELTA_STATE_SEEK: {
+                if(app_ota_delta_varint(byte)) {
+                    //zigzag
+                    uint32_t dist = (s_varint >> 1) + (s_varint & 0x01);
+                    if(s_varint & 0x01) {
+                        if(dist > s_old_pos) {
+                            ret = APP_OTA_DELTA_ERROR_FORMAT;
+                            break;
+                        }
+                        s_old_pos -= dist;
+                    } else {
+                        if(dist > s_old_len - s_old_pos) {
+                            ret = APP_OTA_DELTA_ERROR_FORMAT;
+                            break;
+                        }
+                        s_old_pos += dist;
+                    }
+                    s_state = (s_new_pos == s_new_len) ? APP_OTA_DELTA_STATE_DONE : APP_OTA_DELTA_STATE_DIFF_LEN;
+                }
+            } break;
+
+            case APP_OTA_DELTA_STATE_DONE: {
+                ret = APP_OTA_DELTA_ERROR_FORMAT; //trailing bytes
+            } break;
+
+            default: {
+                return s_error;
+            } break;
+        }
+
+        if(ret != APP_OTA_DELTA_SUCCESS) {
+            return app_ota_delta_fail(ret);
+        }
+    }
+    return APP_OTA_DELTA_SUCCESS;
+}
+
+/*********************************************************
+FN: true from the end of the header until the running image crc is checked
+*/
+bool app_ota_delta_base_busy(void)
+{
+    return (s_state == APP_OTA_DELTA_STATE_BASE);
+}
+
+/*********************************************************
+FN: crc of the next APP_OTA_DELTA_OLD_WINDOW bytes of the running image, the patch goes on
+    once the whole old_len is checked against the header
+*/
+uint32_t app_ota_delta_base_step(void)
+{
+    uint32_t size = s_old_len - s_base_pos;
+
+    if(s_state != APP_OTA_DELTA_STATE_BASE) {
+        return (s_state == APP_OTA_DELTA_STATE_ERROR) ? s_error : APP_OTA_DELTA_SUCCESS;
+    }
+
+    if(size > APP_OTA_DELTA_OLD_WINDOW) {
+        size = APP_OTA_DELTA_OLD_WINDOW;
+    }
+    if(size > 0) {
+        s_read(s_base_pos, s_old_buf, size);
+        s_base_crc = app_port_crc32_compute(s_old_buf, size, &s_base_crc);
+        s_base_pos += size;
+    }
+    if(s_base_pos < s_old_len) {
+        return APP_OTA_DELTA_SUCCESS;
+    }
+
+    s_old_buf_len = 0;
+    if(s_base_crc != app_ota_delta_get_u32(&s_head[8])) {
+        s_new_len = 0;
+        return app_ota_delta_fail(APP_OTA_DELTA_ERROR_BASE);
+    }
+    s_state = APP_OTA_DELTA_STATE_DIFF_LEN;
+    return APP_OTA_DELTA_SUCCESS;
+}
+
+/*********************************************************
+FN: write the last bytes and check the rebuilt image
+*/
+uint32_t app_ota_delta_finish(void)
+{
+    if(s_state == APP_OTA_DELTA_STATE_ERROR) {
+        return s_error;
+    }
+    if(s_state != APP_OTA_DELTA_STATE_DONE) {
+        return app_ota_delta_fail(APP_OTA_DELTA_ERROR_FORMAT);
+    }
+    if(app_ota_delta_flush() != APP_OTA_DELTA_SUCCESS) {
+        return app_ota_delta_fail(APP_OTA_DELTA_ERROR_WRITE);
+    }
+    if(s_crc != s_new_crc) {
+        return app_ota_delta_fail(APP_OTA_DELTA_ERROR_CRC);
+    }
+    return APP_OTA_DELTA_SUCCESS;
+}
+
+/*********************************************************
+FN: 0 until the patch header is received
+*/
+uint32_t app_ota_delta_get_new_len(void)
+{
+    return s_new_len;
+}
+
+/*********************************************************
+FN:
+*/
+static uint32_t app_ota_delta_fail(uint32_t error)
+{
+    s_state = APP_OTA_DELTA_STATE_ERROR;
+    s_error = error;
+    return error;
+}
+
+/*********************************************************
+FN:
+*/
+static uint32_t app_ota_delta_get_u32(const uint8_t* buf)
+{
+    return ((uint32_t)buf[0]) | ((uint32_t)buf[1] << 8) | ((uint32_t)buf[2] << 16) | ((uint32_t)buf[3] << 24);
+}
+
+/*********************************************************
+FN: check the header, the running image crc follows in app_ota_delta_base_step()
+*/
+static uint32_t app_ota_delta_head(void)
+{
+    if(app_ota_delta_get_u32(&s_head[0]) != APP_OTA_DELTA_MAGIC) {
+        return APP_OTA_DELTA_ERROR_FORMAT;
+    }
+    s_old_len = app_ota_delta_get_u32(&s_head[4]);
+    s_new_len = app_ota_delta_get_u32(&s_head[12]);
+    s_new_crc = app_ota_delta_get_u32(&s_head[16]);
+    if((s_old_len > s_old_max_len) || (s_new_len == 0) || (s_new_len > s_new_max_len)) {
+        s_new_len = 0;
+        return APP_OTA_DELTA_ERROR_FORMAT;
+    }
+
+    s_state = APP_OTA_DELTA_STATE_BASE;
+    return APP_OTA_DELTA_SUCCESS;
+}
+
+/*********************************************************
+FN: LEB128, true when the last byte is received (value in s_varint)
+*/
+static bool app_ota_delta_varint(uint8_t byte)
+{
+    if(s_varint_shift == 0) {
+        s_varint = 0;
+    }
+    if(s_varint_shift > 28) {
+        //more than 32 bits, the length check that follows fails
+        s_varint = 0xFFFFFFFF;
+        s_varint_shift = 0;
+        return true;
+    }
+
+    s_varint |= (uint32_t)(byte & 0x7F) << s_varint_shift;
+    if(byte & 0x80) {
+        s_varint_shift += 7;
+        return false;
+    }
+    s_varint_shift = 0;
+    return true;
+}
+
+/*********************************************************
+FN: a run of len new bytes fits in the image
+*/
+static uint32_t app_ota_delta_length(uint32_t len)
+{
+    if(len > s_new_len - s_new_pos) {
+        return APP_OTA_DELTA_ERROR_FORMAT;
+    }
+    return APP_OTA_DELTA_SUCCESS;
+}
+
+/*********************************************************
+FN: next old byte, bounds checked by the diff length
+*/
+static uint8_t app_ota_delta_old_byte(void)
+{
+    if((s_old_pos < s_old_buf_pos) || (s_old_pos >= s_old_buf_pos + s_old_buf_len))
+    {
+        s_old_buf_pos = s_old_pos;
+        s_old_buf_len = s_old_len - s_old_pos;
+        if(s_old_buf_len > APP_OTA_DELTA_OLD_WINDOW) {
+            s_old_buf_len = APP_OTA_DELTA_OLD_WINDOW;
+        }
+        s_read(s_old_buf_pos, s_old_buf, s_old_buf_len);
+    }
+    return s_old_buf[s_old_pos++ - s_old_buf_pos];
+}
+
+/*********************************************************
+FN:
+*/
+static uint32_t app_ota_delta_out(uint8_t byte)
+{
+    s_out[s_out_len++] = byte;
+    s_new_pos++;
+    if(s_out_len == APP_OTA_DELTA_OUT_LEN) {
+        return app_ota_delta_flush();
+    }
+    return APP_OTA_DELTA_SUCCESS;
+}
+
+/*********************************************************
+FN:
+*/
+static uint32_t app_ota_delta_flush(void)
+{
+    uint32_t size = s_out_len;
+
+    if(size == 0) {
+        return APP_OTA_DELTA_SUCCESS;
+    }
+    s_out_len = 0;
+    s_crc = app_port_crc32_compute(s_out, size, &s_crc);
+    if(s_write(s_out, size) != APP_PORT_SUCCESS) {
+        return APP_OTA_DELTA_ERROR_WRITE;
+    }
+    return APP_OTA_DELTA_SUCCESS;
+}
@@ -0,0 +1,87 @@
+/**
+****************************************************************************
+* @file      app_ota_delta.h
+* @brief     app_ota_delta, streaming patch applier for delta ota
+* @author    suding
+* @version   V1.0.0
+* @date      2020-05-11
+* @note      patch generator: tuya_ble_lock_sdk/tools/ota_delta/ota_delta.py
+******************************************************************************
+* @attention
+*
+* <h2><center>&copy; COPYRIGHT 2020 Tuya </center></h2>
+*/
+
+
+#ifndef __APP_OTA_DELTA_H__
+#define __APP_OTA_DELTA_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*********************************************************************
+ * INCLUDES
+ */
+#include "app_common.h"
+
+/*********************************************************************
+ * CONSTANTS
+ */
+/*
+ * patch = header + blocks, little endian, bsdiff control/diff/extra without compression:
+ *   header: magic "TYDP", old_len, old_crc32, new_len, new_crc32 (crc32 as cpt_crc32_compute)
+ *   block:  varint diff_len,  diff_len new bytes = old bytes + diff, diff coded as
+ *                             pairs of (varint zero_run, varint lit_len, lit_len bytes),
+ *                             zero_run at most APP_OTA_DELTA_ZERO_MAX
+ *           varint extra_len, extra_len new bytes copied from the patch
+ *           zigzag varint seek, old position moved after the block
+ * blocks follow each other until new_len bytes are produced
+ * every patch byte thus produces at most APP_OTA_DELTA_ZERO_MAX new bytes, which bounds
+ * the flash work app_ota does per step
+ * old_crc32 is checked one APP_OTA_DELTA_OLD_WINDOW per app_ota_delta_base_step() after the
+ * header, the patch bytes that follow wait for it
+ */
+#define APP_OTA_DELTA_MAGIC         0x50445954  //"TYDP"
+#define APP_OTA_DELTA_HEAD_LEN      20
+#define APP_OTA_DELTA_OLD_WINDOW    256         //old image read cache
+#define APP_OTA_DELTA_OUT_LEN       64          //new image bytes handed to the writer at once
+#define APP_OTA_DELTA_ZERO_MAX      256         //longest zero run, longer ones are split
+
+enum {
+    APP_OTA_DELTA_SUCCESS = 0,
+    APP_OTA_DELTA_ERROR_FORMAT,     //bad magic, length out of range, truncated patch
+    APP_OTA_DELTA_ERROR_BASE,       //patch does not apply to the running image
+    APP_OTA_DELTA_ERROR_WRITE,
+    APP_OTA_DELTA_ERROR_CRC,        //rebuilt image crc error
+};
+
+/*********************************************************************
+ * STRUCT
+ */
+//old image reader, random access
+typedef uint32_t (*app_ota_delta_read_t)(uint32_t offset, uint8_t* buf, uint32_t size);
+//new image writer, sequential
+typedef uint32_t (*app_ota_delta_write_t)(const uint8_t* buf, uint32_t size);
+
+/*********************************************************************
+ * EXTERNAL VARIABLES
+ */
+
+/*********************************************************************
+ * EXTERNAL FUNCTIONS
+ */
+void app_ota_delta_start(uint32_t old_max_len, uint32_t new_max_len, app_ota_delta_read_t read, app_ota_delta_write_t write);
+uint32_t app_ota_delta_apply(const uint8_t* buf, uint32_t size);
+bool app_ota_delta_base_busy(void);
+uint32_t app_ota_delta_base_step(void);
+uint32_t app_ota_delta_finish(void);
+uint32_t app_ota_delta_get_new_len(void);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //__APP_OTA_DELTA_H__
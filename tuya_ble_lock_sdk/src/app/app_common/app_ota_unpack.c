@@ -0,0 +1,383 @@
+#include "app_ota_unpack.h"
+
+
+
+
+/*********************************************************************
+ * LOCAL CONSTANTS
+ */
+enum {
+    APP_OTA_UNPACK_STATE_HEAD = 0,
+    APP_OTA_UNPACK_STATE_TAG,
+    APP_OTA_UNPACK_STATE_LITERAL,
+    APP_OTA_UNPACK_STATE_INDEX,
+    APP_OTA_UNPACK_STATE_COUNT,
+    APP_OTA_UNPACK_STATE_DONE,
+    APP_OTA_UNPACK_STATE_ERROR,
+};
+
+#define APP_OTA_UNPACK_WINDOW_LEN       (1 << APP_OTA_UNPACK_WINDOW_BITS)
+#define APP_OTA_UNPACK_WINDOW_MASK      (APP_OTA_UNPACK_WINDOW_LEN - 1)
+#define APP_OTA_UNPACK_FLAG_ALL         (APP_OTA_UNPACK_FLAG_FLASH_CRC)
+//flash crc layout of the ota file: header, then 32 bytes of code + crc16 (big endian) repeated
+#define APP_OTA_UNPACK_FLASH_CRC_SKIP   16
+#define APP_OTA_UNPACK_FLASH_CRC_BLOCK  32
+
+/*********************************************************************
+ * LOCAL STRUCT
+ */
+
+/*********************************************************************
+ * LOCAL VARIABLES
+ */
+static app_ota_unpack_write_t s_write;
+static uint32_t s_max_len;
+static uint8_t  s_state;
+static uint32_t s_error;
+//header
+static uint8_t  s_head[APP_OTA_UNPACK_HEAD_LEN];
+static uint32_t s_head_len;
+static uint8_t  s_flags;
+static uint8_t  s_window_bits;
+static uint8_t  s_count_bits;
+static uint32_t s_lz_len;
+static uint32_t s_file_len;
+//bit field being decoded, may span several packets
+static uint32_t s_value;
+static uint8_t  s_value_bits;
+static uint8_t  s_value_need;
+static uint32_t s_dist;
+//decoded bytes, the last APP_OTA_UNPACK_WINDOW_LEN kept for back references
+static uint8_t  s_window[APP_OTA_UNPACK_WINDOW_LEN];
+static uint32_t s_lz_pos;
+//flash crc reinsertion
+static uint32_t s_skip_left;
+static uint32_t s_block_len;
+static uint16_t s_block_crc;
+static bool     s_block_erased;
+//unpacked file, s_out included
+static uint32_t s_file_pos;
+static uint32_t s_crc;
+static cpt_md5_ctx_t s_md5;
+static uint8_t  s_out[APP_OTA_UNPACK_OUT_LEN];
+static uint32_t s_out_len;
+
+/*********************************************************************
+ * LOCAL FUNCTION
+ */
+static uint32_t app_ota_unpack_fail(uint32_t error);
+static uint32_t app_ota_unpack_get_u32(const uint8_t* buf);
+static uint32_t app_ota_unpack_head(void);
+static uint32_t app_ota_unpack_field(void);
+static uint32_t app_ota_unpack_decoded(uint8_t byte);
+static uint16_t app_ota_unpack_crc16(uint16_t crc, uint8_t byte);
+static uint32_t app_ota_unpack_out(uint8_t byte);
+static uint32_t app_ota_unpack_flush(void);
+
+/*********************************************************************
+ * VARIABLES
+ */
+
+
+
+
+/*********************************************************
+FN: max_len: size of the ota area
+*/
+void app_ota_unpack_start(uint32_t max_len, app_ota_unpack_write_t write)
+{
+    s_write = write;
+    s_max_len = max_len;
+    s_state = APP_OTA_UNPACK_STATE_HEAD;
+    s_error = APP_OTA_UNPACK_SUCCESS;
+
+    s_head_len = 0;
+    s_flags = 0;
+    s_window_bits = 0;
+    s_count_bits = 0;
+    s_lz_len = 0;
+    s_file_len = 0;
+    s_value = 0;
+    s_value_bits = 0;
+    s_value_need = 1;
+    s_dist = 0;
+    s_lz_pos = 0;
+    s_skip_left = APP_OTA_UNPACK_FLASH_CRC_SKIP;
+    s_block_len = 0;
+    s_block_crc = 0xFFFF;
+    s_block_erased = true;
+    s_file_pos = 0;
+    s_crc = 0;
+    cpt_md5_free(&s_md5);
+    cpt_md5_init(&s_md5);
+    cpt_md5_starts(&s_md5);
+    s_out_len = 0;
+}
+
+/*********************************************************
+FN: feed the next packed bytes, any split of the packed file gives the same output
+*/
+uint32_t app_ota_unpack_apply(const uint8_t* buf, uint32_t size)
+{
+    for(; size > 0; buf++, size--)
+    {
+        uint8_t byte = *buf;
+        uint32_t ret = APP_OTA_UNPACK_SUCCESS;
+
+        if(s_state == APP_OTA_UNPACK_STATE_ERROR) {
+            return s_error;
+        }
+
+        if(s_state == APP_OTA_UNPACK_STATE_HEAD) {
+            s_head[s_head_len++] = byte;
+            if(s_head_len == APP_OTA_UNPACK_HEAD_LEN) {
+                ret = app_ota_unpack_head();
+            }
+        } else if(s_state == APP_OTA_UNPACK_STATE_DONE) {
+            //the padding bits of the last byte are dropped with it, nothing may follow
+            ret = APP_OTA_UNPACK_ERROR_FORMAT;
+        } else {
+            uint8_t mask;
+            for(mask = 0x80; (mask != 0) && (s_state != APP_OTA_UNPACK_STATE_DONE); mask >>= 1)
+            {
+                s_value = (s_value << 1) | ((byte & mask) ? 1 : 0);
+                if(++s_value_bits == s_value_need) {
+                    ret = app_ota_unpack_field();
+                    if(ret != APP_OTA_UNPACK_SUCCESS) {
+                        break;
+                    }
+                }
+            }
+        }
+
+        if(ret != APP_OTA_UNPACK_SUCCESS) {
+            return app_ota_unpack_fail(ret);
+        }
+    }
+    return APP_OTA_UNPACK_SUCCESS;
+}
+
+/*********************************************************
+FN: write the last bytes and check the unpacked file
+*/
+uint32_t app_ota_unpack_finish(void)
+{
+    uint8_t md5[16];
+
+    if(s_state == APP_OTA_UNPACK_STATE_ERROR) {
+        return s_error;
+    }
+    if((s_state != APP_OTA_UNPACK_STATE_DONE) || (s_file_pos != s_file_len)) {
+        return app_ota_unpack_fail(APP_OTA_UNPACK_ERROR_FORMAT);
+    }
+    if(app_ota_unpack_flush() != APP_OTA_UNPACK_SUCCESS) {
+        return app_ota_unpack_fail(APP_OTA_UNPACK_ERROR_WRITE);
+    }
+    cpt_md5_finish(&s_md5, md5);
+    if((s_crc != app_ota_unpack_get_u32(&s_head[16]))
+        || (memcmp(md5, &s_head[20], sizeof(md5)) != 0)) {
+        return app_ota_unpack_fail(APP_OTA_UNPACK_ERROR_CRC);
+    }
+    return APP_OTA_UNPACK_SUCCESS;
+}
+
+/*********************************************************
+FN: 0 until the header is received
+*/
+uint32_t app_ota_unpack_get_file_len(void)
+{
+    return s_file_len;
+}
+
+/*********************************************************
+FN:
+*/
+static uint32_t app_ota_unpack_fail(uint32_t error)
+{
+    s_state = APP_OTA_UNPACK_STATE_ERROR;
+    s_error = error;
+    return error;
+}
+
+/*********************************************************
+FN:
+*/
+static uint32_t app_ota_unpack_get_u32(const uint8_t* buf)
+{
+    return ((uint32_t)buf[0]) | ((uint32_t)buf[1] << 8) | ((uint32_t)buf[2] << 16) | ((uint32_t)buf[3] << 24);
+}
+
+/*********************************************************
+FN:
+*/
+static uint32_t app_ota_unpack_head(void)
+{
+    if(app_ota_unpack_get_u32(&s_head[0]) != APP_OTA_UNPACK_MAGIC) {
+        return APP_OTA_UNPACK_ERROR_FORMAT;
+    }
+    s_flags = s_head[4];
+    s_window_bits = s_head[5];
+    s_count_bits = s_head[6];
+    s_lz_len = app_ota_unpack_get_u32(&s_head[8]);
+    s_file_len = app_ota_unpack_get_u32(&s_head[12]);
+    if((s_flags & ~APP_OTA_UNPACK_FLAG_ALL)
+        || (s_window_bits == 0) || (s_window_bits > APP_OTA_UNPACK_WINDOW_BITS)
+        || (s_count_bits == 0) || (s_count_bits > 8)
+        || (s_lz_len == 0) || (s_file_len < s_lz_len) || (s_file_len > s_max_len)) {
+        s_file_len = 0;
+        return APP_OTA_UNPACK_ERROR_FORMAT;
+    }
+
+    s_state = APP_OTA_UNPACK_STATE_TAG;
+    s_value_bits = 0;
+    s_value_need = 1;
+    return APP_OTA_UNPACK_SUCCESS;
+}
+
+/*********************************************************
+FN: a complete bit field is in s_value
+*/
+static uint32_t app_ota_unpack_field(void)
+{
+    uint32_t value = s_value;
+    uint32_t ret = APP_OTA_UNPACK_SUCCESS;
+
+    s_value = 0;
+    s_value_bits = 0;
+
+    switch(s_state)
+    {
+        case APP_OTA_UNPACK_STATE_TAG: {
+            if(value) {
+                s_state = APP_OTA_UNPACK_STATE_LITERAL;
+                s_value_need = 8;
+            } else {
+                s_state = APP_OTA_UNPACK_STATE_INDEX;
+                s_value_need = s_window_bits;
+            }
+            return APP_OTA_UNPACK_SUCCESS;
+        }
+
+        case APP_OTA_UNPACK_STATE_LITERAL: {
+            ret = app_ota_unpack_decoded(value);
+        } break;
+
+        case APP_OTA_UNPACK_STATE_INDEX: {
+            s_dist = value + 1;
+            if(s_dist > s_lz_pos) {
+                return APP_OTA_UNPACK_ERROR_FORMAT;
+            }
+            s_state = APP_OTA_UNPACK_STATE_COUNT;
+            s_value_need = s_count_bits;
+            return APP_OTA_UNPACK_SUCCESS;
+        }
+
+        case APP_OTA_UNPACK_STATE_COUNT: {
+            uint32_t count = value + 1;
+            if(count > s_lz_len - s_lz_pos) {
+                return APP_OTA_UNPACK_ERROR_FORMAT;
+            }
+            //byte by byte, the reference may overlap the bytes it produces
+            for(; (count > 0) && (ret == APP_OTA_UNPACK_SUCCESS); count--) {
+                ret = app_ota_unpack_decoded(s_window[(s_lz_pos - s_dist) & APP_OTA_UNPACK_WINDOW_MASK]);
+            }
+        } break;
+
+        default: {
+        } break;
+    }
+
+    if(s_lz_pos == s_lz_len) {
+        //the last bytes are written with the packet that ends the stream, not at finish
+        s_state = APP_OTA_UNPACK_STATE_DONE;
+        if(ret == APP_OTA_UNPACK_SUCCESS) {
+            ret = app_ota_unpack_flush();
+        }
+    } else {
+        s_state = APP_OTA_UNPACK_STATE_TAG;
+        s_value_need = 1;
+    }
+    return ret;
+}
+
+/*********************************************************
+FN: decoded byte, flash crc inserted after it when enabled
+*/
+static uint32_t app_ota_unpack_decoded(uint8_t byte)
+{
+    uint32_t ret;
+
+    s_window[s_lz_pos++ & APP_OTA_UNPACK_WINDOW_MASK] = byte;
+    ret = app_ota_unpack_out(byte);
+    if((ret != APP_OTA_UNPACK_SUCCESS) || !(s_flags & APP_OTA_UNPACK_FLAG_FLASH_CRC)) {
+        return ret;
+    }
+
+    if(s_skip_left > 0) {
+        s_skip_left--;
+        return APP_OTA_UNPACK_SUCCESS;
+    }
+    s_block_crc = app_ota_unpack_crc16(s_block_crc, byte);
+    s_block_erased = s_block_erased && (byte == 0xFF);
+    if(++s_block_len == APP_OTA_UNPACK_FLASH_CRC_BLOCK) {
+        //erased blocks keep an erased crc
+        uint16_t crc = s_block_erased ? 0xFFFF : s_block_crc;
+        s_block_len = 0;
+        s_block_crc = 0xFFFF;
+        s_block_erased = true;
+        ret = app_ota_unpack_out(crc >> 8);
+        if(ret == APP_OTA_UNPACK_SUCCESS) {
+            ret = app_ota_unpack_out(crc & 0xFF);
+        }
+    }
+    return ret;
+}
+
+/*********************************************************
+FN: crc16, poly 0x8005, not reflected, as the flash controller
+*/
+static uint16_t app_ota_unpack_crc16(uint16_t crc, uint8_t byte)
+{
+    uint8_t idx;
+
+    crc ^= (uint16_t)byte << 8;
+    for(idx = 0; idx < 8; idx++) {
+        crc = (crc & 0x8000) ? ((crc << 1) ^ 0x8005) : (crc << 1);
+    }
+    return crc;
+}
+
+/*********************************************************
+FN:
+*/
+static uint32_t app_ota_unpack_out(uint8_t byte)
+{
+    if(s_file_pos == s_file_len) {
+        return APP_OTA_UNPACK_ERROR_FORMAT;
+    }
+    s_out[s_out_len++] = byte;
+    s_file_pos++;
+    if(s_out_len == APP_OTA_UNPACK_OUT_LEN) {
+        return app_ota_unpack_flush();
+    }
+    return APP_OTA_UNPACK_SUCCESS;
+}
+
+/*********************************************************
+FN:
+*/
+static uint32_t app_ota_unpack_flush(void)
+{
+    uint32_t size = s_out_len;
+
+    if(size == 0) {
+        return APP_OTA_UNPACK_SUCCESS;
+    }
+    s_out_len = 0;
+    s_crc = app_port_crc32_compute(s_out, size, &s_crc);
+    cpt_md5_update(&s_md5, s_out, size);
+    if(s_write(s_out, size) != APP_PORT_SUCCESS) {
+        return APP_OTA_UNPACK_ERROR_WRITE;
+    }
+    return APP_OTA_UNPACK_SUCCESS;
+}
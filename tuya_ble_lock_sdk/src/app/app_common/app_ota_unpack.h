@@ -0,0 +1,77 @@
+/**
+****************************************************************************
+* @file      app_ota_unpack.h
+* @brief     app_ota_unpack, streaming decompression of compressed ota files
+* @author    suding
+* @version   V1.0.0
+* @date      2020-05-11
+* @note      packer: tuya_ble_lock_sdk/tools/ota_pack/ota_pack.py
+******************************************************************************
+* @attention
+*
+* <h2><center>&copy; COPYRIGHT 2020 Tuya </center></h2>
+*/
+
+
+#ifndef __APP_OTA_UNPACK_H__
+#define __APP_OTA_UNPACK_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*********************************************************************
+ * INCLUDES
+ */
+#include "app_common.h"
+
+/*********************************************************************
+ * CONSTANTS
+ */
+/*
+ * packed file = header + lzss bit stream, little endian:
+ *   header: magic "TYHS", flags, window_bits, count_bits, reserved,
+ *           lz_len (decoded bytes), file_len, file_crc32, file_md5[16] (of the unpacked file)
+ *   stream: heatshrink layout, msb first: 1 + 8 bits literal,
+ *           0 + window_bits (distance-1) + count_bits (length-1) back reference
+ * APP_OTA_UNPACK_FLAG_FLASH_CRC: the crc16 the flash controller keeps after every 32 bytes
+ * of code (see ota_pack.py) was removed before packing and is computed again here
+ */
+#define APP_OTA_UNPACK_MAGIC            0x53485954  //"TYHS"
+#define APP_OTA_UNPACK_HEAD_LEN         36
+#define APP_OTA_UNPACK_FLAG_FLASH_CRC   0x01
+#define APP_OTA_UNPACK_WINDOW_BITS      10          //max window: 1KB ram
+#define APP_OTA_UNPACK_OUT_LEN          64          //unpacked bytes handed to the writer at once
+
+enum {
+    APP_OTA_UNPACK_SUCCESS = 0,
+    APP_OTA_UNPACK_ERROR_FORMAT,    //bad magic/parameters, bad reference, truncated or trailing data
+    APP_OTA_UNPACK_ERROR_WRITE,
+    APP_OTA_UNPACK_ERROR_CRC,       //unpacked file crc32/md5 error
+};
+
+/*********************************************************************
+ * STRUCT
+ */
+//unpacked file writer, sequential
+typedef uint32_t (*app_ota_unpack_write_t)(const uint8_t* buf, uint32_t size);
+
+/*********************************************************************
+ * EXTERNAL VARIABLES
+ */
+
+/*********************************************************************
+ * EXTERNAL FUNCTIONS
+ */
+void app_ota_unpack_start(uint32_t max_len, app_ota_unpack_write_t write);
+uint32_t app_ota_unpack_apply(const uint8_t* buf, uint32_t size);
+uint32_t app_ota_unpack_finish(void);
+uint32_t app_ota_unpack_get_file_len(void);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //__APP_OTA_UNPACK_H__
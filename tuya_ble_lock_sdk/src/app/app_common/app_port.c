@@ -6,6 +6,8 @@
 /*********************************************************************
  * LOCAL CONSTANTS
  */
+//bits in s_dp_report_marks, the sdk queue (MAX_NUMBER_OF_TUYA_MESSAGE) holds no more reports
+#define APP_PORT_DP_REPORT_INFLIGHT_MAX  32
 
 /*********************************************************************
  * LOCAL STRUCT
@@ -14,6 +16,13 @@
 /*********************************************************************
  * LOCAL VARIABLES
  */
+//dp reports waiting for TUYA_BLE_CB_EVT_DP_DATA_REPORT_RESPONSE, oldest in bit 0
+//the response carries no sn but comes back in sending order, a set bit marks a report
+//sent by app_port_dp_data_report_marked()
+static uint32_t s_dp_report_marks = 0;
+static uint8_t  s_dp_report_inflight = 0;
+//reports sent while all bits are in use, unmarked; each enters the record when the oldest leaves
+static uint16_t s_dp_report_overflow = 0;
 
 /*********************************************************************
  * LOCAL FUNCTION
@@ -198,13 +207,72 @@ uint32_t app_port_dp_data_report(uint8_t *buf, uint32_t size)
     if(app_port_get_connect_status() == BONDING_CONN)
     {
         APP_DEBUG_HEXDUMP("dp_rsp", buf, size);
-        return tuya_ble_dp_data_report(buf, size);
+        if(tuya_ble_dp_data_report(buf, size) != TUYA_BLE_SUCCESS) {
+            return APP_PORT_ERROR_COMMON;
+        }
+        if(s_dp_report_inflight < APP_PORT_DP_REPORT_INFLIGHT_MAX) {
+            s_dp_report_inflight++;
+        } else {
+            s_dp_report_overflow++;
+        }
+        return APP_PORT_SUCCESS;
     } else {
         APP_DEBUG_HEXDUMP("dp_rsp_unconn", buf, size);
         return APP_PORT_ERROR_COMMON;
     }
 }
 
+/*********************************************************
+FN: 
+PM: the response is recognized by app_port_dp_data_report_response_is_marked()
+*/
+uint32_t app_port_dp_data_report_marked(uint8_t *buf, uint32_t size)
+{
+    uint8_t pos = s_dp_report_inflight;
+    
+    //a full record could not tell this response apart
+    if(pos >= APP_PORT_DP_REPORT_INFLIGHT_MAX) {
+        return APP_PORT_ERROR_COMMON;
+    }
+    if(app_port_dp_data_report(buf, size) != APP_PORT_SUCCESS) {
+        return APP_PORT_ERROR_COMMON;
+    }
+    s_dp_report_marks |= (1UL << pos);
+    return APP_PORT_SUCCESS;
+}
+
+/*********************************************************
+FN: 
+PM: call once per TUYA_BLE_CB_EVT_DP_DATA_REPORT_RESPONSE
+RT: true - the response belongs to a report sent by app_port_dp_data_report_marked()
+*/
+bool app_port_dp_data_report_response_is_marked(void)
+{
+    bool marked = (s_dp_report_marks & 0x01) != 0;
+    
+    if(s_dp_report_inflight == 0) {
+        return false;
+    }
+    s_dp_report_marks >>= 1;
+    //the oldest overflowed report takes the freed top bit, unmarked
+    if(s_dp_report_overflow > 0) {
+        s_dp_report_overflow--;
+    } else {
+        s_dp_report_inflight--;
+    }
+    return marked;
+}
+
+/*********************************************************
+FN: no response arrives after a disconnect
+*/
+void app_port_dp_data_report_clear(void)
+{
+    s_dp_report_inflight = 0;
+    s_dp_report_marks = 0;
+    s_dp_report_overflow = 0;
+}
+
 /*********************************************************
 FN: 
 */
@@ -422,6 +490,14 @@ bool app_port_aes128_cbc_encrypt(uint8_t *key,uint8_t *iv,uint8_t *input,uint16_
     return tuya_ble_aes128_cbc_encrypt(key, iv, input, input_len, output);
 }
 
+/*********************************************************
+FN: 
+*/
+void app_port_aes128_ctx_cache_clear(void)
+{
+    tuya_ble_aes128_ctx_cache_clear();
+}
+
 
 
 
@@ -28,8 +28,7 @@ extern "C"
 #include "cpt_string_op.h"
 #include "sf_port.h"
 #include "elog.h"
-#include "sha1.h"
-#include "hmac-sha1.h"
+#include "cpt_crypto.h"
 #include "wdt.h"
 //tuya_ble_sdk
 #include "tuya_ble_api.h"
@@ -50,16 +49,16 @@ extern "C"
 #define TUYA_DEVICE_DID                  "tuya3c9983a10a0a"                 //16Byte
 #define TUYA_DEVICE_AUTH_KEY             "fYUftqd2K2mq1BuMs9dYr7tGWg4zloy5" //32Byte
 
-#define TUYA_DEVICE_FIR_NAME             "tuya_ble_lock_common_bk3431q"     //̼ʶ
-#define TUYA_DEVICE_FVER_NUM             0x00000108                         //̼汾
-#define TUYA_DEVICE_HVER_NUM             0x00000100                         //Ӳ汾
-#define TUYA_DEVICE_FVER_STR             "1.8"                              //̼汾str
-#define TUYA_DEVICE_HVER_STR             "1.0"                              //Ӳ汾str
+#define TUYA_DEVICE_FIR_NAME             "tuya_ble_lock_common_bk3431q"     //固件标识名
+#define TUYA_DEVICE_FVER_NUM             0x00000108                         //固件版本
+#define TUYA_DEVICE_HVER_NUM             0x00000100                         //硬件版本
+#define TUYA_DEVICE_FVER_STR             "1.8"                              //固件版本str
+#define TUYA_DEVICE_HVER_STR             "1.0"                              //硬件版本str
 
 /*********************************************************  ble  *********************************************************/
 #define APP_PORT_DEFAULT_MAC_ADDR_STR    "DC234D08C8EF"
 
-#define APP_PORT_ADV_INTERVAL            152.5 //152.5 //(1022.5) //ȡֵΧ20~10240 ms
+#define APP_PORT_ADV_INTERVAL            152.5 //152.5 //(1022.5) //取值范围：20~10240 ms
 #define APP_PORT_MIN_CONN_INTERVAL       BK_CONN_INTERVAL_MIN
 #define APP_PORT_MAX_CONN_INTERVAL       BK_CONN_INTERVAL_MAX
 #define APP_PORT_SLAVE_LATENCY           BK_SLAVE_LATENCY
@@ -146,6 +145,9 @@ uint32_t app_port_delay_ms(uint32_t ms);
 
 /*********************************************************  ble  *********************************************************/
 uint32_t app_port_dp_data_report(uint8_t *buf, uint32_t size);
+uint32_t app_port_dp_data_report_marked(uint8_t *buf, uint32_t size);
+bool app_port_dp_data_report_response_is_marked(void);
+void app_port_dp_data_report_clear(void);
 uint32_t app_port_dp_data_with_time_report(uint32_t timestamp, uint8_t *buf, uint32_t size);
 uint32_t app_port_ota_rsp(tuya_ble_ota_data_response_t *rsp);
 tuya_ble_connect_status_t app_port_get_connect_status(void);
@@ -173,6 +175,7 @@ uint32_t app_port_crc32_compute(uint8_t* buf, uint32_t size, uint32_t* p_crc);
 void app_port_reverse_byte(void* buf, uint32_t size);
 uint32_t app_port_num_array_2_int(uint8_t *num_array, uint32_t start_idx, uint32_t size);
 bool app_port_aes128_cbc_encrypt(uint8_t *key,uint8_t *iv,uint8_t *input,uint16_t input_len,uint8_t *output);
+void app_port_aes128_ctx_cache_clear(void);
 
 /*********************************************************  string  *********************************************************/
 uint8_t app_port_string_op_hexstr2hex(uint8_t *hexstr, int len, uint8_t* hex);
@@ -1,4 +1,5 @@
 #include "lock_common.h"
+#include "fpe_decrypt.h"
 
 
 
@@ -54,6 +55,10 @@ void lock_factory_handler(bool is_delete_app_test_data)
     
     //erase all lock falsh
     lock_flash_erease_all(is_delete_app_test_data);
+    
+    //login_key changes after unbind, drop the cached pwd keys
+    fpe_decrypt_key_wipe();
+    lock_dynamic_pwd_key_wipe();
 }
 
 
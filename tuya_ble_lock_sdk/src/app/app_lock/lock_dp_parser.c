@@ -6,6 +6,22 @@
 /*********************************************************************
  * LOCAL CONSTANTS
  */
+#define LOCK_DP_HEAD_LEN              3
+//聚合应答帧最大长度, 与sdk单次发送上限一致
+#define LOCK_DP_RSP_FRAME_MAX         TUYA_BLE_TRANSMISSION_MAX_DATA_LEN
+
+//应答方式
+#define LOCK_DP_RSP_NONE              0
+#define LOCK_DP_RSP_BUILT             1  //handler已填好应答
+#define LOCK_DP_RSP_ECHO              2  //原样回复命令
+
+//命令在sdk缓冲区中原地读取, 短于以下长度的dp不执行, 回复失败
+#define OPEN_METH_CMD_HEAD_LEN        5  //meth, stage, admin_falg, memberid, hardid
+//带变长密码的命令: password之前的定长部分, 其后至少password_len字节
+#define LOCK_DP_PWD_CMD_FIXED_LEN(type)  (sizeof(type) - HARD_PASSWORD_MAX_LEN)
+
+//open_meth_sync 单包应答的最大节点数(dp头 + 节点数 + 节点), 超出部分分包上报, 每包不超过sdk单次发送上限
+#define OPEN_METH_SYNC_PAGE_NODE_MAX  ((LOCK_DP_RSP_FRAME_MAX - LOCK_DP_HEAD_LEN - 1) / sizeof(open_meth_sync_node_result_t))
 
 /*********************************************************************
  * LOCAL STRUCT
@@ -14,321 +30,455 @@
 /*********************************************************************
  * LOCAL VARIABLES
  */
+static uint8_t  s_settings_changed = 0;
+//尾部预留一个完整dp作为应答槽, handler直接在帧内构造应答
+static uint8_t  s_rsp_frame[LOCK_DP_RSP_FRAME_MAX + sizeof(lock_dp_t)];
+static uint16_t s_rsp_frame_len = 0;
 
 /*********************************************************************
  * LOCAL FUNCTION
  */
-static uint32_t open_meth_creat_handler(void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len);
-static uint32_t open_meth_delete_handler(void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len);
-static uint32_t open_meth_modify_handler(void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len);
+static uint8_t lock_dp_parser_single(lock_dp_t* cmd, lock_dp_t* rsp);
+static uint32_t lock_dp_rsp_frame_commit(lock_dp_t* rsp);
+static void lock_dp_rsp_frame_flush(void);
+static bool lock_dp_pwd_cmd_len_valid(uint8_t cmd_dp_data_len, void* cmd_dp_data, uint8_t fixed_len);
+static uint32_t open_meth_creat_handler(uint8_t cmd_dp_data_len, void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len);
+static uint32_t open_meth_delete_handler(uint8_t cmd_dp_data_len, void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len);
+static uint32_t open_meth_modify_handler(uint8_t cmd_dp_data_len, void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len);
 static uint32_t open_meth_freeze_or_unfreeze_handler(void* cmd_dp_data, uint8_t freeze_state);
 static uint32_t user_freeze_or_unfreeze_handler(void* cmd_dp_data, uint8_t freeze_state);
-static uint32_t open_with_bt_handler(void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len);
-static uint32_t open_meth_sync_handler(void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len);
+static uint32_t open_with_bt_handler(uint8_t cmd_dp_data_len, void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len);
+static void open_meth_sync_rsp_add(lock_dp_t* rsp, open_meth_sync_node_result_t* node);
+static uint32_t open_meth_sync_handler(uint8_t cmd_dp_data_len, void* cmd_dp_data, lock_dp_t* rsp);
 static uint32_t open_meth_sync_new_handler(uint8_t cmd_dp_data_len, void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len);
-static uint32_t temp_pw_creat_handler(void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len);
-static uint32_t temp_pw_delete_handler(void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len);
-static uint32_t temp_pw_modify_handler(void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len);
-static uint32_t open_with_nopwd_remote_setkey_handler(void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len);
-static uint32_t open_with_nopwd_remote_handler(void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len);
+static uint32_t temp_pw_creat_handler(uint8_t cmd_dp_data_len, void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len);
+static uint32_t temp_pw_delete_handler(uint8_t cmd_dp_data_len, void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len);
+static uint32_t temp_pw_modify_handler(uint8_t cmd_dp_data_len, void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len);
+static uint32_t open_with_nopwd_remote_setkey_handler(uint8_t cmd_dp_data_len, void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len);
+static uint32_t open_with_nopwd_remote_handler(uint8_t cmd_dp_data_len, void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len);
 static uint32_t offline_pwd_set_T0_handler(void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len);
 
 /*********************************************************************
  * VARIABLES
  */
-lock_dp_t g_cmd;
-lock_dp_t g_rsp;
+//正在注册的开锁方式, 异步注册完成时入库使用
+open_meth_creat_t g_creat_cmd;
 
 
 
 
 /*********************************************************
 FN: 
+PM: dp_data - (id, type, len, data) 连续排列的一个或多个dp
+    dp_data_len - 整帧长度
 */
-uint32_t lock_dp_parser_handler(void* dp_data)
+uint32_t lock_dp_parser_handler(void* dp_data, uint16_t dp_data_len)
 {
-    uint8_t rsp_flag = 1;
+    uint8_t* p_dp = dp_data;
+    uint16_t offset;
+    uint16_t len;
+    uint32_t ret = APP_PORT_SUCCESS;
+    
+    //check the whole frame first, a malformed frame is dropped as a whole
+    if(dp_data_len < LOCK_DP_HEAD_LEN) {
+        return APP_PORT_ERROR_COMMON;
+    }
+    for(offset = 0; offset < dp_data_len; offset += len)
+    {
+        if((dp_data_len - offset) < LOCK_DP_HEAD_LEN) {
+            return APP_PORT_ERROR_COMMON;
+        }
+        len = LOCK_DP_HEAD_LEN + p_dp[offset + 2];
+        if(len > (dp_data_len - offset)) {
+            return APP_PORT_ERROR_COMMON;
+        }
+    }
     
-    //init cmd and rsp
-    memcpy(&g_cmd, dp_data, sizeof(lock_dp_t));
-    memcpy(&g_rsp, dp_data, sizeof(lock_dp_t));
-    APP_DEBUG_HEXDUMP("dp_cmd", (void*)&g_cmd, g_cmd.dp_data_len+3);
+    s_settings_changed = 0;
+    s_rsp_frame_len = 0;
     
-    switch(g_cmd.dp_id)
+    for(offset = 0; offset < dp_data_len; offset += len)
+    {
+        len = LOCK_DP_HEAD_LEN + p_dp[offset + 2];
+        
+        //cmd is decoded in place, rsp is built in the tail slot of the frame
+        lock_dp_t* cmd = (void*)&p_dp[offset];
+        lock_dp_t* rsp = (void*)&s_rsp_frame[s_rsp_frame_len];
+        APP_DEBUG_HEXDUMP("dp_cmd", (void*)cmd, len);
+        
+        if(lock_dp_parser_single(cmd, rsp) && (rsp->dp_data_len > 0))
+        {
+            if(lock_dp_rsp_frame_commit(rsp) != APP_PORT_SUCCESS) {
+                ret = APP_PORT_ERROR_COMMON;
+            }
+        }
+    }
+    
+    //settings carried by the frame are written to flash only once
+    if(s_settings_changed) {
+        if(lock_settings_save() == APP_PORT_SUCCESS) {
+            APP_DEBUG_PRINTF("lock_settings_save SUCCESS");
+        }
+    }
+    
+    lock_dp_rsp_frame_flush();
+
+    return ret;
+}
+
+/*********************************************************
+FN: 
+PM: cmd - 指向sdk缓冲区中的单个dp
+    rsp - 应答槽
+RT: 1 - rsp需要上报
+*/
+static uint8_t lock_dp_parser_single(lock_dp_t* cmd, lock_dp_t* rsp)
+{
+    uint8_t rsp_flag = LOCK_DP_RSP_ECHO;
+    
+    rsp->dp_id = cmd->dp_id;
+    rsp->dp_type = cmd->dp_type;
+    rsp->dp_data_len = 0;
+    
+    switch(cmd->dp_id)
     {
         case WR_BSC_OPEN_METH_CREATE: {
-            open_meth_creat_handler(g_cmd.dp_data, g_rsp.dp_data, &g_rsp.dp_data_len);
+            rsp_flag = LOCK_DP_RSP_BUILT;
+            open_meth_creat_handler(cmd->dp_data_len, cmd->dp_data, rsp->dp_data, &rsp->dp_data_len);
         } break;
         
         case WR_BSC_OPEN_METH_DELETE: {
-            open_meth_delete_handler(g_cmd.dp_data, g_rsp.dp_data, &g_rsp.dp_data_len);
+            rsp_flag = LOCK_DP_RSP_BUILT;
+            open_meth_delete_handler(cmd->dp_data_len, cmd->dp_data, rsp->dp_data, &rsp->dp_data_len);
         } break;
         
         case WR_BSC_OPEN_METH_MODIFY: {
-            open_meth_modify_handler(g_cmd.dp_data, g_rsp.dp_data, &g_rsp.dp_data_len);
+            rsp_flag = LOCK_DP_RSP_BUILT;
+            open_meth_modify_handler(cmd->dp_data_len, cmd->dp_data, rsp->dp_data, &rsp->dp_data_len);
         } break;
         
         case WR_BSC_OPEN_METH_FREEZE: {
-            if(g_cmd.dp_data_len == 4) {
+            if(cmd->dp_data_len == 4) {
                 APP_DEBUG_PRINTF("OPEN_METH freeze start");
-                open_meth_freeze_or_unfreeze_handler(g_cmd.dp_data, FREEZE_ON);
+                open_meth_freeze_or_unfreeze_handler(cmd->dp_data, FREEZE_ON);
             }
         } break;
         
         case WR_BSC_OPEN_METH_UNFREEZE: {
-            if(g_cmd.dp_data_len == 4) {
+            if(cmd->dp_data_len == 4) {
                 APP_DEBUG_PRINTF("OPEN_METH unfreeze start");
-                open_meth_freeze_or_unfreeze_handler(g_cmd.dp_data, FREEZE_OFF);
+                open_meth_freeze_or_unfreeze_handler(cmd->dp_data, FREEZE_OFF);
             }
         } break;
         
         case WR_SET_USER_FREEZE: {
-            if(g_cmd.dp_data_len == 4) {
+            if(cmd->dp_data_len == 4) {
                 APP_DEBUG_PRINTF("OPEN_METH freeze user start");
-                user_freeze_or_unfreeze_handler(g_cmd.dp_data, FREEZE_ON);
+                user_freeze_or_unfreeze_handler(cmd->dp_data, FREEZE_ON);
             }
         } break;
         
         case WR_SET_USER_UNFREEZE: {
-            if(g_cmd.dp_data_len == 4) {
+            if(cmd->dp_data_len == 4) {
                 APP_DEBUG_PRINTF("OPEN_METH unfreeze user start");
-                user_freeze_or_unfreeze_handler(g_cmd.dp_data, FREEZE_OFF);
+                user_freeze_or_unfreeze_handler(cmd->dp_data, FREEZE_OFF);
             }
         } break;
         
         case WR_BSC_OPEN_METH_SYNC: {
             APP_DEBUG_PRINTF("OPEN_METH sync start");
-            open_meth_sync_handler(g_cmd.dp_data, g_rsp.dp_data, &g_rsp.dp_data_len);
+            rsp_flag = LOCK_DP_RSP_BUILT;
+            open_meth_sync_handler(cmd->dp_data_len, cmd->dp_data, rsp);
         } break;
         
         case WR_BSC_OPEN_METH_SYNC_NEW: {
             APP_DEBUG_PRINTF("OPEN_METH sync new start");
-            open_meth_sync_new_handler(g_cmd.dp_data_len, g_cmd.dp_data, g_rsp.dp_data, &g_rsp.dp_data_len);
+            rsp_flag = LOCK_DP_RSP_BUILT;
+            open_meth_sync_new_handler(cmd->dp_data_len, cmd->dp_data, rsp->dp_data, &rsp->dp_data_len);
         } break;
         
         case OW_BSC_OPEN_WITH_BT: {
-            open_with_bt_handler(g_cmd.dp_data, g_rsp.dp_data, &g_rsp.dp_data_len);
+            rsp_flag = LOCK_DP_RSP_BUILT;
+            open_with_bt_handler(cmd->dp_data_len, cmd->dp_data, rsp->dp_data, &rsp->dp_data_len);
         } break;
         
         case WR_STS_REVERSE_LOCK: {
-            if((g_cmd.dp_data_len == 1) && (g_cmd.dp_data[0] <= 0x01))
+            if((cmd->dp_data_len == 1) && (cmd->dp_data[0] <= 0x01))
             {
-                lock_remote_anti_lock(g_cmd.dp_data[0]);
+                lock_remote_anti_lock(cmd->dp_data[0]);
             }
         } break;
         
         case WR_SET_MESSAGE_SWITCH: {
-            if((g_cmd.dp_data_len == 1) && (g_cmd.dp_data[0] <= 0x01))
+            if((cmd->dp_data_len == 1) && (cmd->dp_data[0] <= 0x01))
             {
-                lock_settings.message_switch = g_cmd.dp_data[0];
-                if(lock_settings_save() == APP_PORT_SUCCESS) {
-                    APP_DEBUG_PRINTF("WR_SET_MESSAGE_SWITCH SUCCESS");
-                }
+                lock_settings.message_switch = cmd->dp_data[0];
+                s_settings_changed = 1;
             }
         } break;
         
         case WR_SET_DOOR_BELL: {
-            if((g_cmd.dp_data_len == 1) && (g_cmd.dp_data[0] <= 0x0A))
+            if((cmd->dp_data_len == 1) && (cmd->dp_data[0] <= 0x0A))
             {
-                lock_settings.door_bell = g_cmd.dp_data[0];
-                if(lock_settings_save() == APP_PORT_SUCCESS) {
-                    APP_DEBUG_PRINTF("WR_SET_DOOR_BELL SUCCESS");
-                }
+                lock_settings.door_bell = cmd->dp_data[0];
+                s_settings_changed = 1;
             }
         } break;
         
         case WR_SET_LOCK_VOLUME: {
-            if((g_cmd.dp_data_len == 1) && (g_cmd.dp_data[0] <= 0x03))
+            if((cmd->dp_data_len == 1) && (cmd->dp_data[0] <= 0x03))
             {
-                lock_settings.lock_volume = g_cmd.dp_data[0];
-                if(lock_settings_save() == APP_PORT_SUCCESS) {
-                    APP_DEBUG_PRINTF("WR_SET_LOCK_VOLUME SUCCESS");
-                }
+                lock_settings.lock_volume = cmd->dp_data[0];
+                s_settings_changed = 1;
             }
         } break;
         
         case WR_SET_LOCK_LANGUAGE: {
-            if((g_cmd.dp_data_len == 1) && (g_cmd.dp_data[0] <= 0x0A))
+            if((cmd->dp_data_len == 1) && (cmd->dp_data[0] <= 0x0A))
             {
-                lock_settings.lock_language = g_cmd.dp_data[0];
-                if(lock_settings_save() == APP_PORT_SUCCESS) {
-                    APP_DEBUG_PRINTF("WR_SET_LOCK_LANGUAGE SUCCESS");
-                }
+                lock_settings.lock_language = cmd->dp_data[0];
+                s_settings_changed = 1;
             }
         } break;
         
         case WR_SET_WELCOME_WORDS: {
-            if((g_cmd.dp_data_len > 0) && (g_cmd.dp_data_len <= HARD_WELCOME_WORDS_MAX_LEN))
+            if((cmd->dp_data_len > 0) && (cmd->dp_data_len <= HARD_WELCOME_WORDS_MAX_LEN))
             {
-                memcpy(lock_settings.welcome_words, g_cmd.dp_data, g_cmd.dp_data_len);
-                if(lock_settings_save() == APP_PORT_SUCCESS) {
-                    APP_DEBUG_PRINTF("WR_SET_WELCOME_WORDS SUCCESS");
-                }
+                memcpy(lock_settings.welcome_words, cmd->dp_data, cmd->dp_data_len);
+                s_settings_changed = 1;
             }
         } break;
         
         case WR_SET_KEY_TONE: {
-            if((g_cmd.dp_data_len == 1) && (g_cmd.dp_data[0] <= 0x0A))
+            if((cmd->dp_data_len == 1) && (cmd->dp_data[0] <= 0x0A))
             {
-                lock_settings.key_tone = g_cmd.dp_data[0];
-                if(lock_settings_save() == APP_PORT_SUCCESS) {
-                    APP_DEBUG_PRINTF("WR_SET_KEY_TONE SUCCESS");
-                }
+                lock_settings.key_tone = cmd->dp_data[0];
+                s_settings_changed = 1;
             }
         } break;
         
         case WR_SET_NAVIGATE_VOLUME: {
-            if((g_cmd.dp_data_len == 1) && (g_cmd.dp_data[0] <= 0x0A))
+            if((cmd->dp_data_len == 1) && (cmd->dp_data[0] <= 0x0A))
             {
-                lock_settings.navigation_volume = g_cmd.dp_data[0];
-                if(lock_settings_save() == APP_PORT_SUCCESS) {
-                    APP_DEBUG_PRINTF("WR_SET_NAVIGATE_VOLUME SUCCESS");
-                }
+                lock_settings.navigation_volume = cmd->dp_data[0];
+                s_settings_changed = 1;
             }
         } break;
         
         case WR_SET_AUTO_LOCK_SWITCH: {
-            if((g_cmd.dp_data_len == 1) && (g_cmd.dp_data[0] <= 0x01))
+            if((cmd->dp_data_len == 1) && (cmd->dp_data[0] <= 0x01))
             {
-                lock_settings.auto_lock_switch = g_cmd.dp_data[0];
-                if(lock_settings_save() == APP_PORT_SUCCESS) {
-                    APP_DEBUG_PRINTF("WR_SET_AUTO_LOCK_SWITCH SUCCESS");
-                }
+                lock_settings.auto_lock_switch = cmd->dp_data[0];
+                s_settings_changed = 1;
             }
         } break;
         
         case WR_SET_COMBINE_LOCK: {
-            if((g_cmd.dp_data_len == 1) && (g_cmd.dp_data[0] <= 0x06))
+            if((cmd->dp_data_len == 1) && (cmd->dp_data[0] <= 0x06))
             {
-                lock_settings.combine_lock_switch = g_cmd.dp_data[0];
-                if(lock_settings_save() == APP_PORT_SUCCESS) {
-                    APP_DEBUG_PRINTF("WR_SET_COMBINE_LOCK SUCCESS");
-                }
+                lock_settings.combine_lock_switch = cmd->dp_data[0];
+                s_settings_changed = 1;
             }
         } break;
         
         case WR_SET_TIMER_LOCK: {
-            if(g_cmd.dp_data_len == 4)
+            if(cmd->dp_data_len == 4)
             {
                 uint32_t value;
-                value = (g_cmd.dp_data[0]<<24) + (g_cmd.dp_data[1]<<16) + (g_cmd.dp_data[2]<<8) + g_cmd.dp_data[3];
+                value = (cmd->dp_data[0]<<24) + (cmd->dp_data[1]<<16) + (cmd->dp_data[2]<<8) + cmd->dp_data[3];
                 lock_settings.timer_lock = value;
-                if(lock_settings_save() == APP_PORT_SUCCESS) {
-                    APP_DEBUG_PRINTF("WR_SET_TIMER_LOCK SUCCESS");
-                }
+                s_settings_changed = 1;
             }
         } break;
         
         case WR_SET_TIMER_AUTO_LOCK: {
-            if(g_cmd.dp_data_len == 4)
+            if(cmd->dp_data_len == 4)
             {
                 uint32_t value;
-                value = (g_cmd.dp_data[0]<<24) + (g_cmd.dp_data[1]<<16) + (g_cmd.dp_data[2]<<8) + g_cmd.dp_data[3];
+                value = (cmd->dp_data[0]<<24) + (cmd->dp_data[1]<<16) + (cmd->dp_data[2]<<8) + cmd->dp_data[3];
                 lock_settings.timer_auto_lock = value;
-                if(lock_settings_save() == APP_PORT_SUCCESS) {
-                    APP_DEBUG_PRINTF("WR_SET_TIMER_AUTO_LOCK SUCCESS");
-                }
+                s_settings_changed = 1;
             }
         } break;
         
         case WR_SET_FINGER_NUM: {
-            if(g_cmd.dp_data_len == 4)
+            if(cmd->dp_data_len == 4)
             {
                 uint32_t value;
-                value = (g_cmd.dp_data[0]<<24) + (g_cmd.dp_data[1]<<16) + (g_cmd.dp_data[2]<<8) + g_cmd.dp_data[3];
+                value = (cmd->dp_data[0]<<24) + (cmd->dp_data[1]<<16) + (cmd->dp_data[2]<<8) + cmd->dp_data[3];
                 lock_settings.finger_number = value;
-                if(lock_settings_save() == APP_PORT_SUCCESS) {
-                    APP_DEBUG_PRINTF("WR_SET_FINGER_NUM SUCCESS");
-                }
+                s_settings_changed = 1;
             }
         } break;
         
         case WR_SET_HAND_LOCK: {
-            if((g_cmd.dp_data_len == 1) && (g_cmd.dp_data[0] == 0x01))
+            if((cmd->dp_data_len == 1) && (cmd->dp_data[0] == 0x01))
             {
-                lock_settings.hand_lock = g_cmd.dp_data[0];
-                if(lock_settings_save() == APP_PORT_SUCCESS) {
-                    APP_DEBUG_PRINTF("WR_SET_HAND_LOCK SUCCESS");
-                }
+                lock_settings.hand_lock = cmd->dp_data[0];
+                s_settings_changed = 1;
             }
         } break;
         
         case WR_SET_MOTOR_DIRECTION: {
-            if((g_cmd.dp_data_len == 1) && (g_cmd.dp_data[0] <= 0x01))
+            if((cmd->dp_data_len == 1) && (cmd->dp_data[0] <= 0x01))
             {
-                lock_settings.motor_direction = g_cmd.dp_data[0];
-                if(lock_settings_save() == APP_PORT_SUCCESS) {
-                    APP_DEBUG_PRINTF("WR_SET_MOTOR_DIRECTION SUCCESS");
-                }
+                lock_settings.motor_direction = cmd->dp_data[0];
+                s_settings_changed = 1;
             }
         } break;
         
         case WR_SET_MOTOR_TORQUE: {
-            if((g_cmd.dp_data_len == 1) && (g_cmd.dp_data[0] <= 0x02))
+            if((cmd->dp_data_len == 1) && (cmd->dp_data[0] <= 0x02))
             {
-                lock_settings.motor_torque = g_cmd.dp_data[0];
-                if(lock_settings_save() == APP_PORT_SUCCESS) {
-                    APP_DEBUG_PRINTF("WR_SET_MOTOR_TORQUE SUCCESS");
-                }
+                lock_settings.motor_torque = cmd->dp_data[0];
+                s_settings_changed = 1;
             }
         } break;
         
         case WR_SET_AWAYHOME_ARMING_SWITCH: {
-            if((g_cmd.dp_data_len == 1) && (g_cmd.dp_data[0] <= 0x01))
+            if((cmd->dp_data_len == 1) && (cmd->dp_data[0] <= 0x01))
             {
-                lock_settings.awayhome_arming = g_cmd.dp_data[0];
-                if(lock_settings_save() == APP_PORT_SUCCESS) {
-                    APP_DEBUG_PRINTF("WR_SET_AWAYHOME_ARMING_SWITCH SUCCESS");
-                }
+                lock_settings.awayhome_arming = cmd->dp_data[0];
+                s_settings_changed = 1;
             }
         } break;
         
         case WR_BSC_TEMP_PW_CREAT: {
-            temp_pw_creat_handler(g_cmd.dp_data, g_rsp.dp_data, &g_rsp.dp_data_len);
+            rsp_flag = LOCK_DP_RSP_BUILT;
+            temp_pw_creat_handler(cmd->dp_data_len, cmd->dp_data, rsp->dp_data, &rsp->dp_data_len);
         } break;
         
         case WR_BSC_TEMP_PW_DELETE: {
-            temp_pw_delete_handler(g_cmd.dp_data, g_rsp.dp_data, &g_rsp.dp_data_len);
+            rsp_flag = LOCK_DP_RSP_BUILT;
+            temp_pw_delete_handler(cmd->dp_data_len, cmd->dp_data, rsp->dp_data, &rsp->dp_data_len);
         } break;
         
         case WR_BSC_TEMP_PW_MODIFY: {
-            temp_pw_modify_handler(g_cmd.dp_data, g_rsp.dp_data, &g_rsp.dp_data_len);
+            rsp_flag = LOCK_DP_RSP_BUILT;
+            temp_pw_modify_handler(cmd->dp_data_len, cmd->dp_data, rsp->dp_data, &rsp->dp_data_len);
         } break;
         
         case WR_BSC_OPEN_WITH_NOPWD_REMOTE_SETKEY: {
-            open_with_nopwd_remote_setkey_handler(g_cmd.dp_data, g_rsp.dp_data, &g_rsp.dp_data_len);
+            rsp_flag = LOCK_DP_RSP_BUILT;
+            open_with_nopwd_remote_setkey_handler(cmd->dp_data_len, cmd->dp_data, rsp->dp_data, &rsp->dp_data_len);
         } break;
         
         case WR_BSC_OPEN_WITH_NOPWD_REMOTE: {
-            open_with_nopwd_remote_handler(g_cmd.dp_data, g_rsp.dp_data, &g_rsp.dp_data_len);
+            rsp_flag = LOCK_DP_RSP_BUILT;
+            open_with_nopwd_remote_handler(cmd->dp_data_len, cmd->dp_data, rsp->dp_data, &rsp->dp_data_len);
         } break;
         
         case WR_BSC_SET_T0: {
-            offline_pwd_set_T0_handler(g_cmd.dp_data, g_rsp.dp_data, &g_rsp.dp_data_len);
+            if(cmd->dp_data_len == 10) {
+                offline_pwd_set_T0_handler(cmd->dp_data, rsp->dp_data, &rsp->dp_data_len);
+            }
         } break;
         
         default: {
-            rsp_flag = 0;
+            rsp_flag = LOCK_DP_RSP_NONE;
         } break;
     }
     
-    if(rsp_flag && (g_rsp.dp_data_len > 0))
-    {
-        app_port_dp_data_report((void*)&g_rsp, (3 + g_rsp.dp_data_len));
+    if(rsp_flag == LOCK_DP_RSP_ECHO) {
+        memcpy(rsp->dp_data, cmd->dp_data, cmd->dp_data_len);
+        rsp->dp_data_len = cmd->dp_data_len;
     }
+    
+    return (rsp_flag != LOCK_DP_RSP_NONE);
+}
 
-    return 0;
+/*********************************************************
+FN: 
+PM: 应答一般已在帧尾构造好; 之前的内容已被发出时(open_meth_sync分包)移到帧中
+RT: 超过sdk单次发送上限的应答不发送, 返回错误
+*/
+static uint32_t lock_dp_rsp_frame_commit(lock_dp_t* rsp)
+{
+    uint16_t len = LOCK_DP_HEAD_LEN + rsp->dp_data_len;
+    
+    if(len > LOCK_DP_RSP_FRAME_MAX) {
+        //the sdk would truncate it, handlers page anything longer (open_meth_sync)
+        APP_DEBUG_PRINTF("Error: dp %d rsp %d bytes, over the frame limit", rsp->dp_id, len);
+        return APP_PORT_ERROR_COMMON;
+    }
+    
+    if((s_rsp_frame_len + len) > LOCK_DP_RSP_FRAME_MAX) {
+        lock_dp_rsp_frame_flush();
+    }
+    
+    if((uint8_t*)rsp != &s_rsp_frame[s_rsp_frame_len]) {
+        memmove(&s_rsp_frame[s_rsp_frame_len], rsp, len);
+    }
+    s_rsp_frame_len += len;
+    return APP_PORT_SUCCESS;
+}
+
+/*********************************************************
+FN: 
+*/
+static void lock_dp_rsp_frame_flush(void)
+{
+    if(s_rsp_frame_len > 0) {
+        app_port_dp_data_report(s_rsp_frame, s_rsp_frame_len);
+        s_rsp_frame_len = 0;
+    }
+}
+
+/*********************************************************
+FN: 
+PM: fixed_len - password之前的定长部分, 最后一字节是password_len
+RT: true - 定长部分和password_len个密码字节都在dp内
+*/
+static bool lock_dp_pwd_cmd_len_valid(uint8_t cmd_dp_data_len, void* cmd_dp_data, uint8_t fixed_len)
+{
+    uint8_t* p_data = cmd_dp_data;
+    uint8_t password_len;
+    
+    if(cmd_dp_data_len < fixed_len) {
+        return false;
+    }
+    //lock_hard_save_in_local_flash() copies at most HARD_PASSWORD_MAX_LEN
+    password_len = p_data[fixed_len - 1];
+    if(password_len > HARD_PASSWORD_MAX_LEN) {
+        password_len = HARD_PASSWORD_MAX_LEN;
+    }
+    return (cmd_dp_data_len >= (fixed_len + password_len));
 }
 
 /*********************************************************
 FN: create open method
 */
-static uint32_t open_meth_creat_handler(void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len)
+static uint32_t open_meth_creat_handler(uint8_t cmd_dp_data_len, void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len)
 {
     open_meth_creat_t* cmd = cmd_dp_data;
     open_meth_creat_result_t* rsp = rsp_dp_data;
     uint8_t* rsp_len = rsp_dp_data_len;
     
+    if(cmd_dp_data_len < OPEN_METH_CMD_HEAD_LEN) {
+        memset(rsp, 0, sizeof(open_meth_creat_result_t));
+        rsp->stage = REG_STAGE_FAILED;
+        rsp->reg_num = REG_NOUSE_DEFAULT_VALUE;
+        rsp->result = REG_FAILD_FAILED;
+        *rsp_len = sizeof(open_meth_creat_result_t);
+        return APP_PORT_ERROR_COMMON;
+    }
+    
+    rsp->meth = cmd->meth;
+    rsp->stage = cmd->stage;
+    rsp->admin_falg = cmd->admin_falg;
+    rsp->memberid = cmd->memberid;
+    rsp->hardid = cmd->hardid;
+    rsp->reg_num = REG_NOUSE_DEFAULT_VALUE;
+    rsp->result = REG_NOUSE_DEFAULT_VALUE;
+    
+    if(cmd->stage == REG_STAGE_STSRT)
+    {
+        //keep the command, registration of card/finger/face completes asynchronously
+        memset(&g_creat_cmd, 0, sizeof(open_meth_creat_t));
+        memcpy(&g_creat_cmd, cmd, (cmd_dp_data_len < sizeof(open_meth_creat_t)) ? cmd_dp_data_len : sizeof(open_meth_creat_t));
+        cmd = &g_creat_cmd;
+    }
+    
     switch(cmd->meth)
     {
         case OPEN_METH_PASSWORD: {
@@ -339,7 +489,7 @@ static uint32_t open_meth_creat_handler(void* cmd_dp_data, void* rsp_dp_data, ui
                     APP_DEBUG_PRINTF("OPEN_METH_PASSWORD creat start");
                     if(g_auto_switch.creat_pw_flag == 0) {
                         lock_hard_creat_sub_report_with_delay(cmd->meth, REG_STAGE_COMPLETE, lock_get_hardid(cmd->meth), REG_NOUSE_DEFAULT_VALUE, REG_NOUSE_DEFAULT_VALUE);
-                        lock_hard_save_in_local_flash(cmd->meth);
+                        lock_hard_save_in_local_flash(cmd->meth, cmd);
                     }
                 }
                 else
@@ -445,13 +595,27 @@ static uint32_t open_meth_creat_handler(void* cmd_dp_data, void* rsp_dp_data, ui
 /*********************************************************
 FN: delete open method
 */
-static uint32_t open_meth_delete_handler(void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len)
+static uint32_t open_meth_delete_handler(uint8_t cmd_dp_data_len, void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len)
 {
     open_meth_delete_t* cmd = cmd_dp_data;
     open_meth_delete_result_t* rsp = rsp_dp_data;
     uint8_t* rsp_len = rsp_dp_data_len;
     uint8_t ret = APP_PORT_SUCCESS;
     
+    if(cmd_dp_data_len < sizeof(open_meth_delete_t)) {
+        memset(rsp, 0, sizeof(open_meth_delete_result_t));
+        rsp->result = 0x00; //delete fail
+        *rsp_len = sizeof(open_meth_delete_result_t);
+        return APP_PORT_ERROR_COMMON;
+    }
+    
+    rsp->meth = cmd->meth;
+    rsp->stage = cmd->stage;
+    rsp->admin_falg = cmd->admin_falg;
+    rsp->memberid = cmd->memberid;
+    rsp->hardid = cmd->hardid;
+    rsp->delete_style = cmd->delete_style;
+    
     switch(cmd->meth)
     {
         case OPEN_METH_BASE: {
@@ -504,13 +668,26 @@ static uint32_t open_meth_delete_handler(void* cmd_dp_data, void* rsp_dp_data, u
 /*********************************************************
 FN: modify open method
 */
-static uint32_t open_meth_modify_handler(void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len)
+static uint32_t open_meth_modify_handler(uint8_t cmd_dp_data_len, void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len)
 {
     open_meth_modify_t* cmd = cmd_dp_data;
     open_meth_modify_result_t* rsp = rsp_dp_data;
     uint8_t* rsp_len = rsp_dp_data_len;
     uint8_t ret = APP_PORT_SUCCESS;
     
+    if(!lock_dp_pwd_cmd_len_valid(cmd_dp_data_len, cmd, LOCK_DP_PWD_CMD_FIXED_LEN(open_meth_modify_t))) {
+        memset(rsp, 0, sizeof(open_meth_modify_result_t));
+        rsp->result = 0x00; //modify fail
+        *rsp_len = sizeof(open_meth_modify_result_t);
+        return APP_PORT_ERROR_COMMON;
+    }
+    
+    rsp->meth = cmd->meth;
+    rsp->stage = cmd->stage;
+    rsp->amin_falg = cmd->admin_falg;
+    rsp->memberid = cmd->memberid;
+    rsp->hardid = cmd->hardid;
+    
     switch(cmd->meth)
     {
         case OPEN_METH_BASE: {
@@ -520,19 +697,19 @@ static uint32_t open_meth_modify_handler(void* cmd_dp_data, void* rsp_dp_data, u
         } break;
         
         case OPEN_METH_PASSWORD: {
-            ret = lock_hard_modify_in_local_flash(OPEN_METH_PASSWORD);
+            ret = lock_hard_modify_in_local_flash(OPEN_METH_PASSWORD, cmd);
             if(ret == APP_PORT_SUCCESS) {
                 APP_DEBUG_PRINTF("OPEN_METH_PASSWORD modify start"); }
         } break;
         
         case OPEN_METH_DOORCARD: {
-            ret = lock_hard_modify_in_local_flash(OPEN_METH_PASSWORD);
+            ret = lock_hard_modify_in_local_flash(OPEN_METH_PASSWORD, cmd);
             if(ret == APP_PORT_SUCCESS) {
                 APP_DEBUG_PRINTF("OPEN_METH_DOORCARD modify start"); }
         } break;
         
         case OPEN_METH_FINGER: {
-            ret = lock_hard_modify_in_local_flash(OPEN_METH_PASSWORD);
+            ret = lock_hard_modify_in_local_flash(OPEN_METH_PASSWORD, cmd);
             if(ret == APP_PORT_SUCCESS) {
                 APP_DEBUG_PRINTF("OPEN_METH_FINGER modify start"); }
         } break;
@@ -575,12 +752,22 @@ static uint32_t user_freeze_or_unfreeze_handler(void* cmd_dp_data, uint8_t freez
 /*********************************************************
 FN: open with bt
 */
-static uint32_t open_with_bt_handler(void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len)
+static uint32_t open_with_bt_handler(uint8_t cmd_dp_data_len, void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len)
 {
     open_meth_with_bt_t* cmd = cmd_dp_data;
     open_meth_with_bt_result_t* rsp = rsp_dp_data;
     uint8_t* rsp_len = rsp_dp_data_len;
     
+    if(cmd_dp_data_len < sizeof(open_meth_with_bt_t)) {
+        memset(rsp, 0, sizeof(open_meth_with_bt_result_t));
+        rsp->result = 0x00; //open fail
+        *rsp_len = sizeof(open_meth_with_bt_result_t);
+        return APP_PORT_ERROR_COMMON;
+    }
+    
+    rsp->result = 0x00;
+    rsp->memberid = cmd->memberid;
+    
     if(cmd->open)
     {
         if(lock_open_with_bt() == APP_PORT_SUCCESS) {
@@ -598,24 +785,55 @@ static uint32_t open_with_bt_handler(void* cmd_dp_data, void* rsp_dp_data, uint8
     return 0;
 }
 
+/*********************************************************
+FN: 
+PM: 追加一个同步节点, 满一包时先上报
+*/
+static void open_meth_sync_rsp_add(lock_dp_t* rsp, open_meth_sync_node_result_t* node)
+{
+    if(rsp->dp_data[0] >= OPEN_METH_SYNC_PAGE_NODE_MAX)
+    {
+        //responses of earlier dps in the frame go first
+        lock_dp_rsp_frame_flush();
+        app_port_dp_data_report((void*)rsp, (LOCK_DP_HEAD_LEN + rsp->dp_data_len));
+        rsp->dp_data[0] = 0;
+        rsp->dp_data_len = 1;
+    }
+    
+    memcpy(&rsp->dp_data[rsp->dp_data_len], node, sizeof(open_meth_sync_node_result_t));
+    rsp->dp_data_len += sizeof(open_meth_sync_node_result_t);
+    rsp->dp_data[0]++;
+}
+
 /*********************************************************
 FN: sync open method
+PM: rsp - 最后一包留在rsp中由调用者上报, 之前的满包在这里直接上报
 */
-static uint32_t open_meth_sync_handler(void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len)
+static uint32_t open_meth_sync_handler(uint8_t cmd_dp_data_len, void* cmd_dp_data, lock_dp_t* rsp)
 {
     uint8_t* pHard_num = cmd_dp_data;
     uint8_t hard_num = *pHard_num;
     open_meth_sync_node_t *pNode = (void*)(pHard_num + 1);
-    //node
-    uint8_t node_count = 0;
+    //app node, indexed by hardid
     static open_meth_sync_node_t node[HARDID_MAX_TOTAL];
+    uint8_t node_bitmap[(HARDID_MAX_TOTAL + 7) / 8];
     //rsp
     open_meth_sync_node_result_t rsp_node;
-    uint8_t rsp_idx = 0;
-    static uint8_t rsp[201];
+    lock_hard_digest_t digest;
+    
+    //cmd is read in place, never walk past its payload
+    if(cmd_dp_data_len == 0) {
+        hard_num = 0;
+    } else if(hard_num > ((cmd_dp_data_len - 1) / sizeof(open_meth_sync_node_t))) {
+        hard_num = (cmd_dp_data_len - 1) / sizeof(open_meth_sync_node_t);
+    }
+    
+    rsp->dp_data[0] = 0;
+    rsp->dp_data_len = 1;
+    memset(node_bitmap, 0, sizeof(node_bitmap));
     
-    //delete invalid hard
-    for(uint32_t idx=0; idx<hard_num; idx++)
+    //mark app node, delete invalid hard
+    for(uint32_t idx=0; idx<hard_num; idx++, pNode++)
     {
         if(pNode->hardid >= HARDID_MAX_TOTAL)
         {
@@ -623,100 +841,44 @@ static uint32_t open_meth_sync_handler(void* cmd_dp_data, void* rsp_dp_data, uin
             rsp_node.hardid = pNode->hardid;
             rsp_node.hard_type = pNode->hard_type;
             memset(&rsp_node.hard_attribute, 0, sizeof(open_meth_sync_hard_attribute_t));
-            
-            //rsp
-            memcpy(rsp + 1 + rsp_idx*sizeof(open_meth_sync_node_result_t), &rsp_node, sizeof(open_meth_sync_node_result_t));
-            rsp_idx++;
-            if(rsp_idx >= 200/sizeof(open_meth_sync_node_result_t)) { break; }//ֹԽ
+            open_meth_sync_rsp_add(rsp, &rsp_node);
         }
         else
         {
-            memcpy(&node[node_count], pNode, sizeof(open_meth_sync_node_t));
-            node_count++;
-            if(node_count >= HARDID_MAX_TOTAL) { break; }//ֹԽ
+            memcpy(&node[pNode->hardid], pNode, sizeof(open_meth_sync_node_t));
+            node_bitmap[pNode->hardid/8] |= (1 << (pNode->hardid%8));
         }
-
-        //1μһṹ
-        pNode++;
     }
     
-    //ͬϷӲ
+    //同步合法硬件, 本地信息全部来自ram中的摘要
     for(uint32_t idx=0; idx<HARDID_MAX_TOTAL; idx++)
     {
-        uint32_t idy;
-        for(idy=0; idy<node_count; idy++)
-        {
-            if(node[idy].hardid == idx)
-            {
-                break;
-            }
-        }
+        bool app_has = (node_bitmap[idx/8] & (1 << (idx%8))) != 0;
+        bool local_has = (lock_hard_digest_get(idx, &digest) == APP_PORT_SUCCESS);
         
-        //APPиӲ
-        if(idy < node_count)
+        if(local_has)
         {
-            //иӲ
-            lock_hard_t hard;
-            if(lock_hard_load(idx, &hard) == 0)
+            //APP无该硬件, 或crc8不一致
+            if((!app_has) || (node[idx].hard_crc8 != digest.crc8))
             {
-                //ȶcrc8
-                uint8_t raw_data[3];
-                raw_data[0] = hard.hard_type;
-                raw_data[1] = hard.member_id;
-                raw_data[2] = hard.freeze_state;
-                if(node[idy].hard_crc8 != (app_port_crc16_compute(raw_data, 3, NULL) & 0xFF))
-                {
-                    rsp_node.op_type = 0x00; //Ӳ
-                    rsp_node.hardid = hard.hard_id; //idx
-                    rsp_node.hard_type = hard.hard_type; //OPENMETH_FINGER
-                    rsp_node.hard_attribute.memberid = hard.member_id;
-                    rsp_node.hard_attribute.freeze_state = hard.freeze_state;
-                    
-                    //rsp
-                    memcpy(rsp + 1 + rsp_idx*sizeof(open_meth_sync_node_result_t), &rsp_node, sizeof(open_meth_sync_node_result_t));
-                    rsp_idx++;
-                    if(rsp_idx >= 254/sizeof(open_meth_sync_node_result_t)) { break; }//ֹԽ
-                }
-            }
-            else
-            {
-                rsp_node.op_type = 0x01; //ɾӲ
-                rsp_node.hardid = node[idy].hardid; //idx
-                rsp_node.hard_type = node[idy].hard_type; //OPENMETH_FINGER
-                memset(&rsp_node.hard_attribute, 0, sizeof(open_meth_sync_hard_attribute_t));
-                
-                //rsp
-                memcpy(rsp + 1 + rsp_idx*sizeof(open_meth_sync_node_result_t), &rsp_node, sizeof(open_meth_sync_node_result_t));
-                rsp_idx++;
-                if(rsp_idx >= 254/sizeof(open_meth_sync_node_result_t)) { break; }//ֹԽ
+                rsp_node.op_type = 0x00; //更新硬件
+                rsp_node.hardid = idx;
+                rsp_node.hard_type = digest.hard_type;
+                rsp_node.hard_attribute.memberid = digest.member_id;
+                rsp_node.hard_attribute.freeze_state = digest.freeze_state;
+                open_meth_sync_rsp_add(rsp, &rsp_node);
             }
         }
-        //APP
-        else
+        else if(app_has)
         {
-            //иӲ
-            lock_hard_t hard;
-            if(lock_hard_load(idx, &hard) == 0)
-            {
-                rsp_node.op_type = 0x00; //Ӳ
-                rsp_node.hardid = hard.hard_id; //idx
-                rsp_node.hard_type = hard.hard_type;
-                rsp_node.hard_attribute.memberid = hard.member_id;
-                rsp_node.hard_attribute.freeze_state = hard.freeze_state;
-                
-                //rsp
-                memcpy(rsp + 1 + rsp_idx*sizeof(open_meth_sync_node_result_t), &rsp_node, sizeof(open_meth_sync_node_result_t));
-                rsp_idx++;
-                if(rsp_idx >= 254/sizeof(open_meth_sync_node_result_t)) { break; }//ֹԽ
-            }
+            rsp_node.op_type = 0x01; //删除硬件
+            rsp_node.hardid = idx;
+            rsp_node.hard_type = node[idx].hard_type;
+            memset(&rsp_node.hard_attribute, 0, sizeof(open_meth_sync_hard_attribute_t));
+            open_meth_sync_rsp_add(rsp, &rsp_node);
         }
     }
     
-    //rsp
-    rsp[0] = rsp_idx;
-    *rsp_dp_data_len = 1 + rsp_idx*sizeof(open_meth_sync_node_result_t);
-    memcpy(rsp_dp_data, rsp, *rsp_dp_data_len);
-    
     return APP_PORT_SUCCESS;
 }
 
@@ -729,33 +891,27 @@ static uint32_t open_meth_sync_new_handler(uint8_t cmd_dp_data_len, void* cmd_dp
     uint8_t* rsp_len = rsp_dp_data_len;
     uint8_t ret = APP_PORT_SUCCESS;
     
-    //Ӳöٵĳ
+    //检查硬件类型枚举的长度
     bool just_rsp_flag = false;
     if((cmd_dp_data_len == 0) || (cmd_dp_data_len >= OPEN_METH_MAX)) {
         just_rsp_flag = true;
     }
     
-    //Ӳö
+    //检查硬件类型枚举, 同一类型只能出现一次
+    uint8_t type_seen[OPEN_METH_MAX];
+    memset(type_seen, 0, sizeof(type_seen));
     for(uint8_t idx=0; idx<cmd_dp_data_len; idx++) {
         uint8_t* hard_type = cmd_dp_data;
-        if((hard_type[idx] >= OPEN_METH_MAX) || (hard_type[idx] == OPEN_METH_BASE)) {
+        if((hard_type[idx] >= OPEN_METH_MAX) || (hard_type[idx] == OPEN_METH_BASE) || type_seen[hard_type[idx]]) {
             just_rsp_flag = true;
             break;
         }
+        type_seen[hard_type[idx]] = 1;
     }
     
     if(!just_rsp_flag)
     {
-        uint8_t* hard_type = cmd_dp_data;
-        
-        memset((void*)&g_sync_new, 0x00, sizeof(open_meth_sync_new_t));
-        g_sync_new.flag = 1;
-        g_sync_new.hard_type_len = cmd_dp_data_len;
-        for(uint8_t idx=0; idx<cmd_dp_data_len; idx++) {
-            g_sync_new.hard[idx].type = hard_type[idx];
-            g_sync_new.hard[idx].idx = 0;
-        }
-        lock_open_meth_sync_new_report(0x00);
+        lock_open_meth_sync_new_start(cmd_dp_data_len, cmd_dp_data);
         
         *rsp_len = 0x00;
     } else {
@@ -769,18 +925,26 @@ static uint32_t open_meth_sync_new_handler(uint8_t cmd_dp_data_len, void* cmd_dp
 /*********************************************************
 FN: creat temp password
 */
-static uint32_t temp_pw_creat_handler(void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len)
+static uint32_t temp_pw_creat_handler(uint8_t cmd_dp_data_len, void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len)
 {
     temp_pw_creat_t* cmd = cmd_dp_data;
     temp_pw_creat_result_t* rsp = rsp_dp_data;
     uint8_t* rsp_len = rsp_dp_data_len;
     uint8_t ret = APP_PORT_SUCCESS;
     
+    if(!lock_dp_pwd_cmd_len_valid(cmd_dp_data_len, cmd, LOCK_DP_PWD_CMD_FIXED_LEN(temp_pw_creat_t))) {
+        memset(rsp, 0, sizeof(temp_pw_creat_result_t));
+        rsp->hardid = HARD_ID_INVALID;
+        rsp->result = 0x01; //creat fail
+        *rsp_len = sizeof(temp_pw_creat_result_t);
+        return APP_PORT_ERROR_COMMON;
+    }
+    
     rsp->hardid = lock_get_hardid(OPEN_METH_TEMP_PW);
     if(lock_get_hardid(OPEN_METH_TEMP_PW) != HARD_ID_INVALID)
     {
         APP_DEBUG_PRINTF("OPEN_METH_TEMP_PW creat start");
-        ret += lock_hard_save_in_local_flash(OPEN_METH_TEMP_PW);
+        ret += lock_hard_save_in_local_flash(OPEN_METH_TEMP_PW, cmd);
         
         switch(cmd->type)
         {
@@ -816,13 +980,20 @@ static uint32_t temp_pw_creat_handler(void* cmd_dp_data, void* rsp_dp_data, uint
 /*********************************************************
 FN: delete temp password
 */
-static uint32_t temp_pw_delete_handler(void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len)
+static uint32_t temp_pw_delete_handler(uint8_t cmd_dp_data_len, void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len)
 {
     temp_pw_delete_t* cmd = cmd_dp_data;
     temp_pw_delete_result_t* rsp = rsp_dp_data;
     uint8_t* rsp_len = rsp_dp_data_len;
     uint8_t ret = APP_PORT_SUCCESS;
     
+    if(cmd_dp_data_len < sizeof(temp_pw_delete_t)) {
+        memset(rsp, 0, sizeof(temp_pw_delete_result_t));
+        rsp->result = 0x01; //delete fail
+        *rsp_len = sizeof(temp_pw_delete_result_t);
+        return APP_PORT_ERROR_COMMON;
+    }
+    
     rsp->hardid = cmd->hardid;
     ret = lock_hard_delete(cmd->hardid);
     
@@ -841,15 +1012,22 @@ static uint32_t temp_pw_delete_handler(void* cmd_dp_data, void* rsp_dp_data, uin
 /*********************************************************
 FN: modify temp password
 */
-static uint32_t temp_pw_modify_handler(void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len)
+static uint32_t temp_pw_modify_handler(uint8_t cmd_dp_data_len, void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len)
 {
     temp_pw_modify_t* cmd = cmd_dp_data;
     temp_pw_modify_result_t* rsp = rsp_dp_data;
     uint8_t* rsp_len = rsp_dp_data_len;
     uint8_t ret = APP_PORT_SUCCESS;
     
+    if(!lock_dp_pwd_cmd_len_valid(cmd_dp_data_len, cmd, LOCK_DP_PWD_CMD_FIXED_LEN(temp_pw_modify_t))) {
+        memset(rsp, 0, sizeof(temp_pw_modify_result_t));
+        rsp->result = 0x01; //modify fail
+        *rsp_len = sizeof(temp_pw_modify_result_t);
+        return APP_PORT_ERROR_COMMON;
+    }
+    
     rsp->hardid = cmd->hardid;
-    ret = lock_hard_modify_in_local_flash(OPEN_METH_TEMP_PW);
+    ret = lock_hard_modify_in_local_flash(OPEN_METH_TEMP_PW, cmd);
     
     switch(cmd->type)
     {
@@ -878,22 +1056,32 @@ static uint32_t temp_pw_modify_handler(void* cmd_dp_data, void* rsp_dp_data, uin
 /*********************************************************
 FN: 
 */
-static uint32_t open_with_nopwd_remote_setkey_handler(void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len)
+static uint32_t open_with_nopwd_remote_setkey_handler(uint8_t cmd_dp_data_len, void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len)
 {
     open_with_nopwd_remote_setkey_t* cmd = cmd_dp_data;
     open_with_nopwd_remote_setkey_result_t* rsp = rsp_dp_data;
     uint8_t* rsp_len = rsp_dp_data_len;
     uint8_t ret = APP_PORT_SUCCESS;
+    open_with_nopwd_remote_setkey_t key;
+    
+    if(cmd_dp_data_len != sizeof(open_with_nopwd_remote_setkey_t)) {
+        memset(rsp, 0, sizeof(open_with_nopwd_remote_setkey_result_t));
+        rsp->result = 0x01; //set fail
+        *rsp_len = sizeof(open_with_nopwd_remote_setkey_result_t);
+        return APP_PORT_ERROR_COMMON;
+    }
     
     rsp->memberid = cmd->memberid;
     
-    app_port_reverse_byte(&cmd->memberid, sizeof(uint16_t));
-    app_port_reverse_byte(&cmd->time_begin, sizeof(uint32_t));
-    app_port_reverse_byte(&cmd->time_end, sizeof(uint32_t));
-    app_port_reverse_byte(&cmd->valid_num, sizeof(uint16_t));
+    //cmd points into the sdk buffer, convert a local copy
+    memcpy(&key, cmd, sizeof(open_with_nopwd_remote_setkey_t));
+    app_port_reverse_byte(&key.memberid, sizeof(uint16_t));
+    app_port_reverse_byte(&key.time_begin, sizeof(uint32_t));
+    app_port_reverse_byte(&key.time_end, sizeof(uint32_t));
+    app_port_reverse_byte(&key.valid_num, sizeof(uint16_t));
     
-    APP_DEBUG_PRINTF("WR_BSC_OPEN_WITH_NOPWD_REMOTE_SETKEY: time_begin-%d, time_end-%d", cmd->time_begin, cmd->time_end);
-    ret = app_port_nv_set(SF_AREA_0, NV_ID_OPEN_WITH_NOPWD_REMOTE, cmd, sizeof(open_with_nopwd_remote_setkey_t));
+    APP_DEBUG_PRINTF("WR_BSC_OPEN_WITH_NOPWD_REMOTE_SETKEY: time_begin-%d, time_end-%d", key.time_begin, key.time_end);
+    ret = app_port_nv_set(SF_AREA_0, NV_ID_OPEN_WITH_NOPWD_REMOTE, &key, sizeof(open_with_nopwd_remote_setkey_t));
     if(ret == APP_PORT_SUCCESS) {
         rsp->result = 0x00;
     } else {
@@ -908,12 +1096,19 @@ static uint32_t open_with_nopwd_remote_setkey_handler(void* cmd_dp_data, void* r
 /*********************************************************
 FN: 
 */
-static uint32_t open_with_nopwd_remote_handler(void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len)
+static uint32_t open_with_nopwd_remote_handler(uint8_t cmd_dp_data_len, void* cmd_dp_data, void* rsp_dp_data, uint8_t* rsp_dp_data_len)
 {
     open_with_nopwd_remote_t* cmd = cmd_dp_data;
     open_with_nopwd_remote_result_t* rsp = rsp_dp_data;
     uint8_t* rsp_len = rsp_dp_data_len;
     
+    if(cmd_dp_data_len < sizeof(open_with_nopwd_remote_t)) {
+        memset(rsp, 0, sizeof(open_with_nopwd_remote_result_t));
+        rsp->result = 0x01; //open fail
+        *rsp_len = sizeof(open_with_nopwd_remote_result_t);
+        return APP_PORT_ERROR_COMMON;
+    }
+    
     rsp->memberid = cmd->memberid;
     
     uint32_t timestamp = app_port_get_timestamp();
@@ -948,7 +1143,7 @@ static uint32_t open_with_nopwd_remote_handler(void* cmd_dp_data, void* rsp_dp_d
             APP_DEBUG_PRINTF("OPEN_WITH_NOPWD_REMOTE success");
             
             set_cmd.valid_num--;
-            app_port_nv_set(SF_AREA_0, NV_ID_OPEN_WITH_NOPWD_REMOTE, cmd, sizeof(open_with_nopwd_remote_setkey_t));
+            app_port_nv_set(SF_AREA_0, NV_ID_OPEN_WITH_NOPWD_REMOTE, &set_cmd, sizeof(open_with_nopwd_remote_setkey_t));
             
             rsp->result = 0x00; //open success
         } else {
@@ -32,71 +32,71 @@ extern "C"
 //WR-write_report, OW-only_write, OR-only_report
 //BSC-basic, STS-state_sync, SET-setting, RFU-remain_for_future_use
 //PW-password, BT-blue_tooth
-#define  WR_BSC_OPEN_METH_CREATE                  1   //-ӿʽ
-#define  WR_BSC_OPEN_METH_DELETE                  2   //-ɾʽ
-#define  WR_BSC_OPEN_METH_MODIFY                  3   //-޸Ŀʽ
-#define  WR_BSC_OPEN_METH_FREEZE                  4   //-Ὺʽ
-#define  WR_BSC_OPEN_METH_UNFREEZE                5   //-ⶳʽ
-#define  OW_BSC_OPEN_WITH_BT                      6   //-
-#define  OR_BSC_OPEN_WITH_BT_REPORT               7   //-
-#define  OR_STS_BATTERY_PERCENT                   8   //״̬ͬ-ٷֱ
-#define  OR_STS_BATTERY_POSITION                  9   //״̬ͬ-λ
-#define  OR_STS_CHILD_LOCK                        10  //״̬ͬ-ͯ
-#define  OR_STS_ANTI_LOCK                         11  //״̬ͬ-ᷴ
-#define  OR_LOG_OPEN_WITH_FINGER                  12  //¼-ָ
-#define  OR_LOG_OPEN_WITH_PW                      13  //¼-ͨ
-#define  OR_LOG_OPEN_WITH_DYNAMIC_PW              14  //¼-̬
-#define  OR_LOG_OPEN_WITH_CARD                    15  //¼-ſ
-#define  OR_LOG_OPEN_WITH_KEY                     16  //¼-еԿ
-#define  OR_LOG_DOOR_STATE                        17  //¼-ŵ״̬    //?
-#define  OR_LOG_OPEN_INSIDE                       18  //¼-Ŵڲ
-#define  OR_LOG_OPEN_WITH_BT                      19  //¼-
-#define  OR_RFU_DOOR_OPENED                       20  //δʹ-ű
-#define  OR_LOG_ALARM_REASON                      21  //¼-
-#define  OR_LOG_ALARM_HIJACK                      22  //¼-ٳֱ
-#define  OR_RFU_ALARM_LOW_POWER                   23  //δʹ-͵籨
-#define  OR_STS_DOORBELL_RING                     24  //״̬ͬ-
-#define  WR_SET_MESSAGE_SWITCH                    25  //-֪ͨ
-#define  WR_SET_DOOR_BELL                         26  //-Ч
-#define  WR_SET_LOCK_VOLUME                       27  //-
-#define  WR_SET_LOCK_LANGUAGE                     28  //-л
-#define  WR_SET_WELCOME_WORDS                     29  //-ʾӭ
-#define  WR_SET_KEY_TONE                          30  //-
-#define  WR_SET_NAVIGATE_VOLUME                   31  //-ıص
-#define  WR_STS_REVERSE_LOCK                      32  //״̬ͬ-״̬
-#define  WR_SET_AUTO_LOCK_SWITCH                  33  //-Զ
-#define  WR_SET_COMBINE_LOCK                      34  //-һϿл
-#define  WR_BSC_OPEN_METH_SYNC                    35  //-ͬʽ
-#define  WR_SET_TIMER_LOCK                        36  //-ʱ
-#define  WR_SET_TIMER_AUTO_LOCK                   37  //-ʱԶ
-#define  WR_SET_FINGER_NUM                        38  //-ָ¼
-#define  OR_LOG_OPEN_WITH_FACE                    39  //¼-
-#define  OR_STS_DOOR_STATE                        40  //״̬ͬ-ſ״̬
-#define  OR_LOG_OPEN_WITH_EYE                     41  //¼-Ĥ
-#define  OR_LOG_OPEN_WITH_PALM_PRINT              42  //¼-
-#define  OR_LOG_OPEN_WITH_FINGER_VEIN             43  //¼-ָ
-#define  OR_STS_AUTH_LOCK_OUTTIME                 45  //״̬ͬ-Զʱ
-#define  WR_SET_HAND_LOCK                         46  //-ֶ
-#define  OR_STS_LOCK_STATE                        47  //״̬ͬ-״̬
-#define  WR_SET_MOTOR_DIRECTION                   48  //-ת
-#define  WR_SET_USER_FREEZE                       49  //-û
-#define  WR_SET_USER_UNFREEZE                     50  //-ⶳû
-#define  WR_BSC_TEMP_PW_CREAT                     51  //-ʱ
-#define  WR_BSC_TEMP_PW_DELETE                    52  //-ɾʱ
-#define  WR_BSC_TEMP_PW_MODIFY                    53  //-޸ʱ
-#define  WR_BSC_OPEN_METH_SYNC_NEW                54  //-ͬʽ
-#define  OR_LOG_OPEN_WITH_TMP_PWD                 55  //¼-ʱ
-#define  WR_SET_MOTOR_TORQUE                      56  //-Ť
-#define  OR_LOG_OPEN_WITH_COMBINE                 57  //¼-Ͽ
-#define  WR_SET_AWAYHOME_ARMING_SWITCH            58  //-Ҳ
-#define  WR_BSC_OPEN_WITH_NOPWD_REMOTE_SETKEY     60  //-Զ̿
-#define  WR_BSC_OPEN_WITH_NOPWD_REMOTE            61  //-Զ̿
-#define  OR_LOG_OPEN_WITH_REMOTE_PHONE            62  //¼-Զֻ
-#define  OR_LOG_OPEN_WITH_REMOTE_VOICE            63  //¼-Զ俪
-#define  WR_BSC_SET_T0                            64  //--T0ʱ·
-#define  OR_LOG_ALARM_OFFLINE_PWD_CLEAR_SINGLE    65  //¼--
-#define  OR_LOG_ALARM_OFFLINE_PWD_CLEAR_ALL       66  //¼--
-#define  OR_LOG_OPEN_WITH_OFFLINE_PWD             67  //¼-
+#define  WR_BSC_OPEN_METH_CREATE                  1   //基础功能-添加开锁方式
+#define  WR_BSC_OPEN_METH_DELETE                  2   //基础功能-删除开锁方式
+#define  WR_BSC_OPEN_METH_MODIFY                  3   //基础功能-修改开锁方式
+#define  WR_BSC_OPEN_METH_FREEZE                  4   //基础功能-冻结开锁方式
+#define  WR_BSC_OPEN_METH_UNFREEZE                5   //基础功能-解冻开锁方式
+#define  OW_BSC_OPEN_WITH_BT                      6   //基础功能-蓝牙开锁
+#define  OR_BSC_OPEN_WITH_BT_REPORT               7   //基础功能-蓝牙开锁反馈，弃用
+#define  OR_STS_BATTERY_PERCENT                   8   //状态同步-电量百分比
+#define  OR_STS_BATTERY_POSITION                  9   //状态同步-电量档位
+#define  OR_STS_CHILD_LOCK                        10  //状态同步-童锁
+#define  OR_STS_ANTI_LOCK                         11  //状态同步-上提反锁
+#define  OR_LOG_OPEN_WITH_FINGER                  12  //开锁记录-指纹
+#define  OR_LOG_OPEN_WITH_PW                      13  //开锁记录-普通密码
+#define  OR_LOG_OPEN_WITH_DYNAMIC_PW              14  //开锁记录-动态密码
+#define  OR_LOG_OPEN_WITH_CARD                    15  //开锁记录-门卡
+#define  OR_LOG_OPEN_WITH_KEY                     16  //开锁记录-机械钥匙
+#define  OR_LOG_DOOR_STATE                        17  //开锁记录-门的状态    //?
+#define  OR_LOG_OPEN_INSIDE                       18  //开锁记录-门从内侧打开
+#define  OR_LOG_OPEN_WITH_BT                      19  //开锁记录-蓝牙开锁
+#define  OR_RFU_DOOR_OPENED                       20  //未被使用-门被打开
+#define  OR_LOG_ALARM_REASON                      21  //警报记录-各种
+#define  OR_LOG_ALARM_HIJACK                      22  //警报记录-劫持报警
+#define  OR_RFU_ALARM_LOW_POWER                   23  //未被使用-低电报警
+#define  OR_STS_DOORBELL_RING                     24  //状态同步-门铃提醒
+#define  WR_SET_MESSAGE_SWITCH                    25  //锁的设置-短信通知
+#define  WR_SET_DOOR_BELL                         26  //锁的设置-门铃音效
+#define  WR_SET_LOCK_VOLUME                       27  //锁的设置-锁的音量
+#define  WR_SET_LOCK_LANGUAGE                     28  //锁的设置-锁的语言切换
+#define  WR_SET_WELCOME_WORDS                     29  //锁的设置-显示屏欢迎词
+#define  WR_SET_KEY_TONE                          30  //锁的设置-按键音调
+#define  WR_SET_NAVIGATE_VOLUME                   31  //锁的设置-锁的本地导航音量
+#define  WR_STS_REVERSE_LOCK                      32  //状态同步-反锁状态
+#define  WR_SET_AUTO_LOCK_SWITCH                  33  //锁的设置-自动落锁开关
+#define  WR_SET_COMBINE_LOCK                      34  //锁的设置-单一开锁与组合开锁切换
+#define  WR_BSC_OPEN_METH_SYNC                    35  //基础功能-同步开锁方式
+#define  WR_SET_TIMER_LOCK                        36  //锁的设置-定时落锁
+#define  WR_SET_TIMER_AUTO_LOCK                   37  //锁的设置-定时自动落锁
+#define  WR_SET_FINGER_NUM                        38  //锁的设置-指纹录入次数
+#define  OR_LOG_OPEN_WITH_FACE                    39  //开锁记录-人脸
+#define  OR_STS_DOOR_STATE                        40  //状态同步-门开合状态
+#define  OR_LOG_OPEN_WITH_EYE                     41  //开锁记录-虹膜
+#define  OR_LOG_OPEN_WITH_PALM_PRINT              42  //开锁记录-掌纹
+#define  OR_LOG_OPEN_WITH_FINGER_VEIN             43  //开锁记录-指静脉
+#define  OR_STS_AUTH_LOCK_OUTTIME                 45  //状态同步-自动落锁倒计时
+#define  WR_SET_HAND_LOCK                         46  //锁的设置-手动落锁
+#define  OR_STS_LOCK_STATE                        47  //状态同步-锁开合状态
+#define  WR_SET_MOTOR_DIRECTION                   48  //锁的设置-锁贴电机转动方向
+#define  WR_SET_USER_FREEZE                       49  //锁的设置-冻结用户
+#define  WR_SET_USER_UNFREEZE                     50  //锁的设置-解冻用户
+#define  WR_BSC_TEMP_PW_CREAT                     51  //基础功能-添加临时密码
+#define  WR_BSC_TEMP_PW_DELETE                    52  //基础功能-删除临时密码
+#define  WR_BSC_TEMP_PW_MODIFY                    53  //基础功能-修改临时密码
+#define  WR_BSC_OPEN_METH_SYNC_NEW                54  //基础功能-同步开锁方式（数据量大）
+#define  OR_LOG_OPEN_WITH_TMP_PWD                 55  //开锁记录-临时密码
+#define  WR_SET_MOTOR_TORQUE                      56  //锁的设置-电机扭力
+#define  OR_LOG_OPEN_WITH_COMBINE                 57  //开锁记录-组合开锁
+#define  WR_SET_AWAYHOME_ARMING_SWITCH            58  //锁的设置-离家布防
+#define  WR_BSC_OPEN_WITH_NOPWD_REMOTE_SETKEY     60  //基础功能-免密远程开锁配置
+#define  WR_BSC_OPEN_WITH_NOPWD_REMOTE            61  //基础功能-免密远程开锁
+#define  OR_LOG_OPEN_WITH_REMOTE_PHONE            62  //开锁记录-远程手机开锁
+#define  OR_LOG_OPEN_WITH_REMOTE_VOICE            63  //开锁记录-远程音箱开锁
+#define  WR_BSC_SET_T0                            64  //基础功能-离线密码-T0时间下发
+#define  OR_LOG_ALARM_OFFLINE_PWD_CLEAR_SINGLE    65  //警报记录-离线密码-清除单条密码
+#define  OR_LOG_ALARM_OFFLINE_PWD_CLEAR_ALL       66  //警报记录-离线密码-清除所有密码
+#define  OR_LOG_OPEN_WITH_OFFLINE_PWD             67  //开锁记录-离线密码
 
 
 //open method
@@ -107,7 +107,7 @@ typedef enum
     OPEN_METH_DOORCARD,
     OPEN_METH_FINGER,
     OPEN_METH_FACE,
-    OPEN_METH_TEMP_PW, //ʵʵʱֵΪ0xF0˴Ϊ洢ʾȡֵ0x05
+    OPEN_METH_TEMP_PW, //实际的临时密码值为0xF0，此处为方便存储演示，取值0x05
     OPEN_METH_MAX,
 } open_meth_t;
 
@@ -352,17 +352,14 @@ typedef struct
 } open_meth_sync_new_last_result_t;
 typedef struct
 {
-    uint8_t type;
-    uint8_t idx;
-    uint8_t count;
-} open_meth_sync_new_hard_t;
-typedef struct
-{
-    uint8_t flag;
+    uint8_t flag;           //1-streaming, waiting for dp report response
+    uint8_t paused;         //1-stopped by disconnect or failed report, same request resumes it
     uint8_t hard_type_len;
-    uint8_t idx;
-    uint8_t pkg_count;
-    open_meth_sync_new_hard_t hard[OPEN_METH_MAX];
+    uint8_t hard_type[OPEN_METH_MAX];
+    uint8_t pkg_total;
+    uint8_t pkg_sent;
+    uint8_t pkg_acked;
+    uint32_t hard_generation; //snapshot is stale once the hard table changed
 } open_meth_sync_new_t;
 
 //open with bt
@@ -408,14 +405,13 @@ typedef struct
 /*********************************************************************
  * EXTERNAL VARIABLES
  */
-extern lock_dp_t g_cmd;
-extern lock_dp_t g_rsp;
+extern open_meth_creat_t g_creat_cmd;
 extern volatile open_meth_sync_new_t g_sync_new;
 
 /*********************************************************************
  * EXTERNAL FUNCTIONS
  */
-uint32_t lock_dp_parser_handler(void* dp_data);
+uint32_t lock_dp_parser_handler(void* dp_data, uint16_t dp_data_len);
 
 
 #ifdef __cplusplus
@@ -6,6 +6,15 @@
 /*********************************************************************
  * LOCAL CONSTANTS
  */
+#define OFFLINE_RECORD_LEN            19
+#define SYNC_NEW_PKG_NODE_MAX         20
+#define SYNC_NEW_PKG_MAX              (OPEN_METH_MAX + HARDID_MAX_TOTAL/SYNC_NEW_PKG_NODE_MAX)
+//同时未确认的包数
+#define SYNC_NEW_WINDOW_SIZE          2
+//延时上报队列深度, 满了之后最早的一条立即上报
+#define DELAY_REPORT_QUEUE_SIZE       8
+#define CREAT_SUB_REPORT_LEN          (3 + sizeof(open_meth_creat_result_t))
+
 typedef enum
 {
     DELAY_REPORT_TYPE_CREAT_SUB_REPORT = 0x00,
@@ -19,6 +28,8 @@ typedef struct
 {
     open_meth_t meth;
     reg_stage_t stage;
+    uint8_t admin_falg;     //g_creat_cmd when queued, a later creat overwrites it
+    uint8_t memberid;
     uint8_t hardid;
     uint8_t reg_idx;
     uint8_t result;
@@ -30,23 +41,55 @@ typedef struct
     uint32_t hardid;
 } open_record_report_t;
 
-static struct 
+typedef struct 
 {
     uint8_t type;
+    uint8_t due_tick;
     union
     {
         creat_sub_report_t creat_sub_report;
         open_record_report_t open_record_report;
     };
-} delay_report_param;
+} delay_report_param_t;
+
+#pragma pack(1)
+//上报用的dp, 按实际数据长度分配
+typedef struct
+{
+    uint8_t dp_id;
+    uint8_t dp_type;
+    uint8_t dp_data_len;
+    uint8_t dp_data[OFFLINE_RECORD_LEN - 3];
+} lock_record_dp_t;
+
+typedef struct
+{
+    uint8_t dp_id;
+    uint8_t dp_type;
+    uint8_t dp_data_len;
+    uint8_t dp_data[2 + SYNC_NEW_PKG_NODE_MAX*sizeof(open_meth_sync_node_new_t)];
+} sync_new_pkg_dp_t;
+#pragma pack()
 
 /*********************************************************************
  * LOCAL VARIABLES
  */
+static delay_report_param_t s_delay_report_queue[DELAY_REPORT_QUEUE_SIZE];
+static uint8_t s_delay_report_head = 0;
+static uint8_t s_delay_report_count = 0;
+static uint8_t s_delay_report_tick = 0;
+static bool    s_delay_report_timer_running = false;
+
+//open method sync new snapshot
+static open_meth_sync_node_new_t s_sync_new_node[HARDID_MAX_TOTAL];
+static uint8_t s_sync_new_pkg_start[SYNC_NEW_PKG_MAX + 1];
+static sync_new_pkg_dp_t s_sync_new_pkg;
+static uint8_t s_sync_new_pkg_idx = 0xFF;
 
 /*********************************************************************
  * LOCAL FUNCTION
  */
+static uint8_t lock_hard_creat_sub_report_build(uint8_t* buf, creat_sub_report_t* param);
 
 /*********************************************************************
  * VARIABLES
@@ -57,26 +100,89 @@ static struct
 
 /*********************************************************
 FN: 
+PM: 按到期顺序上报, 相邻的注册过程上报合并为一帧
+    force_num - 不论是否到期, 队首强制上报的条数
 */
-void delay_report_outtime_handler(void)
+static void delay_report_drain(uint8_t force_num)
 {
-    switch(delay_report_param.type)
+    uint8_t frame[DELAY_REPORT_QUEUE_SIZE * CREAT_SUB_REPORT_LEN];
+    uint8_t frame_len = 0;
+    
+    while(s_delay_report_count > 0)
     {
-        case DELAY_REPORT_TYPE_CREAT_SUB_REPORT: {
-            lock_hard_creat_sub_report(delay_report_param.creat_sub_report.meth,
-                                        delay_report_param.creat_sub_report.stage,
-                                        delay_report_param.creat_sub_report.hardid,
-                                        delay_report_param.creat_sub_report.reg_idx,
-                                        delay_report_param.creat_sub_report.result);
-        } break;
+        delay_report_param_t* param = &s_delay_report_queue[s_delay_report_head];
         
-        case DELAY_REPORT_TYPE_OPEN_RECORD_REPORT: {
-            lock_open_record_report(delay_report_param.open_record_report.dp_id,
-                                     delay_report_param.open_record_report.hardid);
-        } break;
+        if(force_num > 0) {
+            force_num--;
+        } else if((int8_t)(s_delay_report_tick - param->due_tick) < 0) {
+            break;
+        }
         
-        default: {
-        } break;
+        switch(param->type)
+        {
+            case DELAY_REPORT_TYPE_CREAT_SUB_REPORT: {
+                frame_len += lock_hard_creat_sub_report_build(&frame[frame_len], &param->creat_sub_report);
+            } break;
+            
+            case DELAY_REPORT_TYPE_OPEN_RECORD_REPORT: {
+                //records are stored and acked one by one, keep order with the pending frame
+                if(frame_len > 0) {
+                    app_port_dp_data_report(frame, frame_len);
+                    frame_len = 0;
+                }
+                lock_open_record_report(param->open_record_report.dp_id,
+                                         param->open_record_report.hardid);
+            } break;
+            
+            default: {
+            } break;
+        }
+        
+        s_delay_report_head = (s_delay_report_head + 1) % DELAY_REPORT_QUEUE_SIZE;
+        s_delay_report_count--;
+    }
+    
+    if(frame_len > 0) {
+        app_port_dp_data_report(frame, frame_len);
+    }
+}
+
+/*********************************************************
+FN: 
+PM: 入队一条延时上报, 到期时间为至少一个定时周期之后
+*/
+static uint32_t delay_report_push(delay_report_param_t* param)
+{
+    if(s_delay_report_count >= DELAY_REPORT_QUEUE_SIZE) {
+        //queue is full, deliver the oldest one now rather than lose it
+        delay_report_drain(1);
+    }
+    
+    //timer running means current period is partly elapsed, wait one more period
+    param->due_tick = s_delay_report_tick + (s_delay_report_timer_running ? 2 : 1);
+    memcpy(&s_delay_report_queue[(s_delay_report_head + s_delay_report_count) % DELAY_REPORT_QUEUE_SIZE], param, sizeof(delay_report_param_t));
+    s_delay_report_count++;
+    
+    if(!s_delay_report_timer_running) {
+        s_delay_report_timer_running = true;
+        lock_timer_start(LOCK_TIMER_DELAY_REPORT);
+    }
+    return APP_PORT_SUCCESS;
+}
+
+/*********************************************************
+FN: 
+*/
+void delay_report_outtime_handler(void)
+{
+    s_delay_report_tick++;
+    s_delay_report_timer_running = false;
+    
+    delay_report_drain(0);
+    
+    if(s_delay_report_count > 0) {
+        s_delay_report_timer_running = true;
+        lock_timer_start(LOCK_TIMER_DELAY_REPORT);
     }
 }
 
@@ -89,14 +195,43 @@ PM: reg_idx - Please refer to the documentation
 */
 void lock_hard_creat_sub_report(uint8_t meth, uint8_t stage, uint8_t hardid, uint8_t reg_idx, uint8_t result)
 {
-    open_meth_creat_result_t* rsp = (void*)g_rsp.dp_data;
-    rsp->stage = (reg_stage_t)stage;
-    rsp->hardid = hardid;
-    rsp->reg_num = reg_idx;
-    rsp->result = result;
-    g_rsp.dp_data_len = sizeof(open_meth_creat_result_t);
-    
-    app_port_dp_data_report((void*)&g_rsp, (3 + g_rsp.dp_data_len));
+    uint8_t report[CREAT_SUB_REPORT_LEN];
+    creat_sub_report_t param;
+    uint8_t len;
+    
+    param.meth = (open_meth_t)meth;
+    param.stage = (reg_stage_t)stage;
+    param.admin_falg = g_creat_cmd.admin_falg;
+    param.memberid = g_creat_cmd.memberid;
+    param.hardid = hardid;
+    param.reg_idx = reg_idx;
+    param.result = result;
+    len = lock_hard_creat_sub_report_build(report, &param);
+    
+    app_port_dp_data_report(report, len);
+}
+
+/*********************************************************
+FN: 
+PM: buf - at least CREAT_SUB_REPORT_LEN bytes
+*/
+static uint8_t lock_hard_creat_sub_report_build(uint8_t* buf, creat_sub_report_t* param)
+{
+    lock_record_dp_t* report = (void*)buf;
+    open_meth_creat_result_t* rsp = (void*)report->dp_data;
+    
+    report->dp_id = WR_BSC_OPEN_METH_CREATE;
+    report->dp_type = APP_PORT_DT_RAW;
+    report->dp_data_len = sizeof(open_meth_creat_result_t);
+    rsp->meth = param->meth;
+    rsp->stage = param->stage;
+    rsp->admin_falg = param->admin_falg;
+    rsp->memberid = param->memberid;
+    rsp->hardid = param->hardid;
+    rsp->reg_num = param->reg_idx;
+    rsp->result = param->result;
+    
+    return CREAT_SUB_REPORT_LEN;
 }
 
 /*********************************************************
@@ -104,15 +239,18 @@ FN:
 */
 uint32_t lock_hard_creat_sub_report_with_delay(uint8_t meth, uint8_t stage, uint8_t hardid, uint8_t reg_idx, uint8_t result)
 {
-    delay_report_param.type = DELAY_REPORT_TYPE_CREAT_SUB_REPORT;
-    delay_report_param.creat_sub_report.meth = (open_meth_t)meth;
-    delay_report_param.creat_sub_report.stage = (reg_stage_t)stage;
-    delay_report_param.creat_sub_report.hardid = hardid;
-    delay_report_param.creat_sub_report.reg_idx = reg_idx;
-    delay_report_param.creat_sub_report.result = result;
-    
-    lock_timer_start(LOCK_TIMER_DELAY_REPORT);
-    return APP_PORT_SUCCESS;
+    delay_report_param_t param;
+    
+    param.type = DELAY_REPORT_TYPE_CREAT_SUB_REPORT;
+    param.creat_sub_report.meth = (open_meth_t)meth;
+    param.creat_sub_report.stage = (reg_stage_t)stage;
+    param.creat_sub_report.admin_falg = g_creat_cmd.admin_falg;
+    param.creat_sub_report.memberid = g_creat_cmd.memberid;
+    param.creat_sub_report.hardid = hardid;
+    param.creat_sub_report.reg_idx = reg_idx;
+    param.creat_sub_report.result = result;
+    
+    return delay_report_push(&param);
 }
 
 
@@ -127,35 +265,35 @@ PM: dp_id - defined in "lock_dp_parser.h"
            - if dp_id=OR_LOG_OPEN_INSIDE,  then hardid=0x00
            - if dp_id=OR_LOG_DOOR_STATE,   then hardid=0x00-close,0x01-open
 */
-#define OFFLINE_RECORD_LEN 19
 uint32_t lock_open_record_report(uint8_t dp_id, uint32_t hardid)
 {
 	uint32_t timestamp = app_port_get_timestamp();
+    lock_record_dp_t report = {0};
     
-    g_rsp.dp_id = dp_id;
+    report.dp_id = dp_id;
     
     switch(dp_id)
     {
         case OR_LOG_OPEN_INSIDE: {
-            g_rsp.dp_type = APP_PORT_DT_BOOL;
-            g_rsp.dp_data_len = APP_PORT_DT_BOOL_LEN;
-            g_rsp.dp_data[0] = hardid;
+            report.dp_type = APP_PORT_DT_BOOL;
+            report.dp_data_len = APP_PORT_DT_BOOL_LEN;
+            report.dp_data[0] = hardid;
         } break;
         
         default: {
-            g_rsp.dp_type = APP_PORT_DT_VALUE;
-            g_rsp.dp_data_len = APP_PORT_DT_VALUE_LEN;
-            g_rsp.dp_data[0] = hardid>>24;
-            g_rsp.dp_data[1] = hardid>>16;
-            g_rsp.dp_data[2] = hardid>>8;
-            g_rsp.dp_data[3] = hardid;
+            report.dp_type = APP_PORT_DT_VALUE;
+            report.dp_data_len = APP_PORT_DT_VALUE_LEN;
+            report.dp_data[0] = hardid>>24;
+            report.dp_data[1] = hardid>>16;
+            report.dp_data[2] = hardid>>8;
+            report.dp_data[3] = hardid;
         } break;
     }
     
-//    lock_evt_save(timestamp, (void*)&g_rsp, (3 + g_rsp.dp_data_len));
-    lock_evt_save(timestamp, (void*)&g_rsp, (OFFLINE_RECORD_LEN));
+//    lock_evt_save(timestamp, (void*)&report, (3 + report.dp_data_len));
+    lock_evt_save(timestamp, (void*)&report, (OFFLINE_RECORD_LEN));
     
-    return app_port_dp_data_with_time_report(timestamp, (void*)&g_rsp, (3 + g_rsp.dp_data_len));
+    return app_port_dp_data_with_time_report(timestamp, (void*)&report, (3 + report.dp_data_len));
 }
 
 /*********************************************************
@@ -163,12 +301,13 @@ FN:
 */
 uint32_t lock_open_record_report_with_delay(uint8_t dp_id, uint32_t hardid)
 {
-    delay_report_param.type = DELAY_REPORT_TYPE_OPEN_RECORD_REPORT;
-    delay_report_param.open_record_report.dp_id = dp_id;
-    delay_report_param.open_record_report.hardid = hardid;
+    delay_report_param_t param;
     
-    lock_timer_start(LOCK_TIMER_DELAY_REPORT);
-    return APP_PORT_SUCCESS;
+    param.type = DELAY_REPORT_TYPE_OPEN_RECORD_REPORT;
+    param.open_record_report.dp_id = dp_id;
+    param.open_record_report.hardid = hardid;
+    
+    return delay_report_push(&param);
 }
 
 /*********************************************************
@@ -185,25 +324,26 @@ uint32_t lock_open_record_combine_report(uint8_t combine_enum, uint8_t size, uin
 //    
 //	uint32_t timestamp = app_port_get_timestamp();
 //    
-//    g_rsp.dp_id = OR_LOG_OPEN_WITH_COMBINE;
-//    g_rsp.dp_type = APP_PORT_DT_VALUE;
-//    g_rsp.dp_data_len = APP_PORT_DT_ENUM_LEN + size;
-//    g_rsp.dp_data[0] = combine_enum;
+//    report.dp_id = OR_LOG_OPEN_WITH_COMBINE;
+//    report.dp_type = APP_PORT_DT_VALUE;
+//    report.dp_data_len = APP_PORT_DT_ENUM_LEN + size;
+//    report.dp_data[0] = combine_enum;
 //    for(uint8_t idx=0; idx<size; idx++) {
-//        g_rsp.dp_data[1+idx] = hardid[idx];
+//        report.dp_data[1+idx] = hardid[idx];
 //    }
     
 	uint32_t timestamp = app_port_get_timestamp();
+    lock_record_dp_t report = {0};
     
-    g_rsp.dp_id = OR_LOG_OPEN_WITH_COMBINE;
-    g_rsp.dp_type = APP_PORT_DT_ENUM;
-    g_rsp.dp_data_len = APP_PORT_DT_ENUM_LEN;
-    g_rsp.dp_data[0] = combine_enum;
+    report.dp_id = OR_LOG_OPEN_WITH_COMBINE;
+    report.dp_type = APP_PORT_DT_ENUM;
+    report.dp_data_len = APP_PORT_DT_ENUM_LEN;
+    report.dp_data[0] = combine_enum;
     
-//    lock_evt_save(timestamp, (void*)&g_rsp, (3 + g_rsp.dp_data_len));
-    lock_evt_save(timestamp, (void*)&g_rsp, (OFFLINE_RECORD_LEN));
+//    lock_evt_save(timestamp, (void*)&report, (3 + report.dp_data_len));
+    lock_evt_save(timestamp, (void*)&report, (OFFLINE_RECORD_LEN));
     
-    return app_port_dp_data_with_time_report(timestamp, (void*)&g_rsp, (3 + g_rsp.dp_data_len));
+    return app_port_dp_data_with_time_report(timestamp, (void*)&report, (3 + report.dp_data_len));
 }
 
 /*********************************************************
@@ -212,16 +352,17 @@ FN:
 uint32_t lock_open_record_report_offline_pwd(uint8_t dp_id, uint8_t* pwd)
 {
 	uint32_t timestamp = app_port_get_timestamp();
+    lock_record_dp_t report = {0};
     
-    g_rsp.dp_id = dp_id;
-    g_rsp.dp_type = APP_PORT_DT_RAW;
-    g_rsp.dp_data_len = OFFLINE_PWD_LEN+6;
-    memcpy(&g_rsp.dp_data[0], pwd, OFFLINE_PWD_MAX_NUM);
+    report.dp_id = dp_id;
+    report.dp_type = APP_PORT_DT_RAW;
+    report.dp_data_len = OFFLINE_PWD_LEN+6;
+    memcpy(&report.dp_data[0], pwd, OFFLINE_PWD_LEN+6);
     
-//    lock_evt_save(timestamp, (void*)&g_rsp, (3 + g_rsp.dp_data_len));
-    lock_evt_save(timestamp, (void*)&g_rsp, (OFFLINE_RECORD_LEN));
+//    lock_evt_save(timestamp, (void*)&report, (3 + report.dp_data_len));
+    lock_evt_save(timestamp, (void*)&report, (OFFLINE_RECORD_LEN));
     
-    return app_port_dp_data_with_time_report(timestamp, (void*)&g_rsp, (3 + g_rsp.dp_data_len));
+    return app_port_dp_data_with_time_report(timestamp, (void*)&report, (3 + report.dp_data_len));
 }
 
 /*********************************************************
@@ -230,16 +371,17 @@ FN: alarm event record and report
 uint32_t lock_alarm_record_report(uint8_t alarm_reason)
 {
 	uint32_t timestamp = app_port_get_timestamp();
+    lock_record_dp_t report = {0};
     
-    g_rsp.dp_id = OR_LOG_ALARM_REASON;
-    g_rsp.dp_type = APP_PORT_DT_ENUM;
-    g_rsp.dp_data_len = APP_PORT_DT_ENUM_LEN;
-    g_rsp.dp_data[0] = alarm_reason;
+    report.dp_id = OR_LOG_ALARM_REASON;
+    report.dp_type = APP_PORT_DT_ENUM;
+    report.dp_data_len = APP_PORT_DT_ENUM_LEN;
+    report.dp_data[0] = alarm_reason;
     
-//    lock_evt_save(timestamp, (void*)&g_rsp, (3 + g_rsp.dp_data_len));
-    lock_evt_save(timestamp, (void*)&g_rsp, (OFFLINE_RECORD_LEN));
+//    lock_evt_save(timestamp, (void*)&report, (3 + report.dp_data_len));
+    lock_evt_save(timestamp, (void*)&report, (OFFLINE_RECORD_LEN));
     
-    return app_port_dp_data_with_time_report(timestamp, (void*)&g_rsp, (3 + g_rsp.dp_data_len));
+    return app_port_dp_data_with_time_report(timestamp, (void*)&report, (3 + report.dp_data_len));
 }
 
 /*********************************************************
@@ -276,91 +418,182 @@ void lock_offline_evt_report(uint8_t status)
         {
             timestamp = app_port_get_old_timestamp(timestamp);
         }
-        memcpy(&g_rsp, buf+5, OFFLINE_RECORD_LEN);
-        app_port_dp_data_with_time_report(timestamp, (void*)&g_rsp, (3 + g_rsp.dp_data_len));
+        lock_record_dp_t* report = (void*)(buf+5);
+        app_port_dp_data_with_time_report(timestamp, (void*)report, (3 + report->dp_data_len));
     }
     last_evt_id = lock_last_evtid(evt_id);
 }
 
 /*********************************************************
 FN: 
+PM: 从ram摘要生成同步快照, 每种硬件类型单独分包, 每包最多SYNC_NEW_PKG_NODE_MAX个
 */
 volatile open_meth_sync_new_t g_sync_new;
 
-void lock_open_meth_sync_new_report(uint8_t status)
+static void sync_new_snapshot(void)
 {
-    if(status != 0)
-    {
-        return;
-    }
-    
-    volatile open_meth_sync_new_hard_t* hard_type = g_sync_new.hard;
-    uint8_t* pIdx = (void*)&g_sync_new.idx; //hard_type_idx
+    uint8_t node_num = 0;
+    uint8_t pkg_num = 0;
     
-    g_rsp.dp_id = WR_BSC_OPEN_METH_SYNC_NEW;
-    g_rsp.dp_type = APP_PORT_DT_RAW;
-    g_rsp.dp_data[0] = 0x00;
-    g_rsp.dp_data[1] = g_sync_new.pkg_count;
-    g_rsp.dp_data_len = 2;
-    
-    //ѯÿӲö
-    for(uint8_t idx=hard_type[*pIdx].idx; idx<hardid_max[hard_type[*pIdx].type]; idx++)
+    for(uint8_t idx=0; idx<g_sync_new.hard_type_len; idx++)
     {
-        lock_hard_t hard;
-        if(lock_hard_load(hardid_start[hard_type[*pIdx].type]+idx, &hard) == APP_PORT_SUCCESS)
-        {
-            open_meth_sync_node_new_t node_rsp;
-            node_rsp.hardid = hard.hard_id;
-            node_rsp.hard_type = hard.hard_type;
-            node_rsp.hard_attribute.memberid = hard.member_id;
-            node_rsp.hard_attribute.freeze_state = hard.freeze_state;
-            
-            memcpy(&g_rsp.dp_data[g_rsp.dp_data_len], &node_rsp, sizeof(open_meth_sync_node_new_t));
-            g_rsp.dp_data_len += sizeof(open_meth_sync_node_new_t);
-            
-            hard_type[*pIdx].count++;
-        }
+        uint8_t type = g_sync_new.hard_type[idx];
+        uint8_t type_node_num = 0;
         
-        //ÿӲ͵Ӳ
-        hard_type[*pIdx].idx++;
-        //ĳӲͱߴﵽ
-        if((hard_type[*pIdx].idx == hardid_max[hard_type[*pIdx].type])
-            || ((hard_type[*pIdx].count > 0) && ((hard_type[*pIdx].count % 20) == 0)))
+        for(uint8_t hardid=hardid_start[type]; hardid<(hardid_start[type]+hardid_max[type]); hardid++)
         {
-            bool is_break = false;
-            
-            if(hard_type[*pIdx].count > 0) {
-                g_sync_new.pkg_count++;
-                app_port_dp_data_report((void*)&g_rsp, (3 + g_rsp.dp_data_len));
-                is_break = true;
-            }
-            
-            //ĳӲͱ
-            if(hard_type[*pIdx].idx == hardid_max[hard_type[*pIdx].type]) {
-                //Ӳ͸
-                (*pIdx)++;
-                idx=hard_type[*pIdx].idx - 1;
-//                APP_DEBUG_PRINTF("hard_type_idx: %d", *pIdx);
-                if((*pIdx) == g_sync_new.hard_type_len)
-                {
-                    g_rsp.dp_id = WR_BSC_OPEN_METH_SYNC_NEW;
-                    g_rsp.dp_type = APP_PORT_DT_RAW;
-                    g_rsp.dp_data_len = sizeof(open_meth_sync_new_last_result_t);
-                    
-                    open_meth_sync_new_last_result_t* rsp = (void*)g_rsp.dp_data;
-                    rsp->stage = 0x01;
-                    rsp->pkgs = g_sync_new.pkg_count;
-                    
-                    app_port_dp_data_report((void*)&g_rsp, (3 + g_rsp.dp_data_len));
-                    g_sync_new.flag = 0;
-                    is_break = true;
-                }
+            lock_hard_digest_t digest;
+            if(lock_hard_digest_get(hardid, &digest) != APP_PORT_SUCCESS) {
+                continue;
             }
             
-            if(is_break) {
+            //快照放不下的节点不上报(非默认的 HARDID_MAX_* 时), 不越界
+            if((node_num >= HARDID_MAX_TOTAL)
+                || (((type_node_num % SYNC_NEW_PKG_NODE_MAX) == 0) && (pkg_num >= SYNC_NEW_PKG_MAX))) {
                 break;
             }
+            if((type_node_num % SYNC_NEW_PKG_NODE_MAX) == 0) {
+                s_sync_new_pkg_start[pkg_num++] = node_num;
+            }
+            s_sync_new_node[node_num].hardid = hardid;
+            s_sync_new_node[node_num].hard_type = digest.hard_type;
+            s_sync_new_node[node_num].hard_attribute.memberid = digest.member_id;
+            s_sync_new_node[node_num].hard_attribute.freeze_state = digest.freeze_state;
+            node_num++;
+            type_node_num++;
+        }
+    }
+    s_sync_new_pkg_start[pkg_num] = node_num;
+    
+    g_sync_new.pkg_total = pkg_num;
+    g_sync_new.hard_generation = lock_hard_generation_get();
+}
+
+/*********************************************************
+FN: 
+PM: 提前组好下一包, 收到应答时直接发送
+*/
+static void sync_new_pkg_prefetch(uint8_t pkg)
+{
+    s_sync_new_pkg_idx = pkg;
+    if(pkg >= g_sync_new.pkg_total) {
+        return;
+    }
+    
+    uint8_t node_num = s_sync_new_pkg_start[pkg+1] - s_sync_new_pkg_start[pkg];
+    
+    s_sync_new_pkg.dp_id = WR_BSC_OPEN_METH_SYNC_NEW;
+    s_sync_new_pkg.dp_type = APP_PORT_DT_RAW;
+    s_sync_new_pkg.dp_data[0] = 0x00;
+    s_sync_new_pkg.dp_data[1] = pkg;
+    memcpy(&s_sync_new_pkg.dp_data[2], &s_sync_new_node[s_sync_new_pkg_start[pkg]], node_num*sizeof(open_meth_sync_node_new_t));
+    s_sync_new_pkg.dp_data_len = 2 + node_num*sizeof(open_meth_sync_node_new_t);
+}
+
+/*********************************************************
+FN: 
+PM: 窗口内连续发送, 全部确认后发送结束包
+*/
+static void sync_new_pump(void)
+{
+    while((g_sync_new.pkg_sent < g_sync_new.pkg_total)
+        && ((g_sync_new.pkg_sent - g_sync_new.pkg_acked) < SYNC_NEW_WINDOW_SIZE))
+    {
+        if(s_sync_new_pkg_idx != g_sync_new.pkg_sent) {
+            sync_new_pkg_prefetch(g_sync_new.pkg_sent);
+        }
+        if(app_port_dp_data_report_marked((void*)&s_sync_new_pkg, (3 + s_sync_new_pkg.dp_data_len)) != APP_PORT_SUCCESS) {
+            if(g_sync_new.pkg_sent == g_sync_new.pkg_acked) {
+                //nothing in flight, no response will drive us, wait for the app to request again
+                g_sync_new.flag = 0;
+                g_sync_new.paused = 1;
+            }
+            return; //otherwise retry on next response
         }
+        g_sync_new.pkg_sent++;
+        sync_new_pkg_prefetch(g_sync_new.pkg_sent);
+    }
+    
+    if((g_sync_new.pkg_acked >= g_sync_new.pkg_total) && (g_sync_new.flag == 1))
+    {
+        lock_record_dp_t report;
+        open_meth_sync_new_last_result_t* rsp = (void*)report.dp_data;
+        
+        report.dp_id = WR_BSC_OPEN_METH_SYNC_NEW;
+        report.dp_type = APP_PORT_DT_RAW;
+        report.dp_data_len = sizeof(open_meth_sync_new_last_result_t);
+        rsp->stage = 0x01;
+        rsp->pkgs = g_sync_new.pkg_total;
+        
+        app_port_dp_data_report((void*)&report, (3 + report.dp_data_len));
+        g_sync_new.flag = 0;
+        g_sync_new.paused = 0;
+    }
+}
+
+/*********************************************************
+FN: 
+PM: 与被中断的请求相同且硬件表未变化时, 从第一个未确认的包继续
+*/
+uint32_t lock_open_meth_sync_new_start(uint8_t hard_type_len, uint8_t* hard_type)
+{
+    if(hard_type_len > OPEN_METH_MAX) {
+        return APP_PORT_ERROR_COMMON;
+    }
+    
+    if((g_sync_new.paused)
+        && (g_sync_new.hard_type_len == hard_type_len)
+        && (memcmp((void*)g_sync_new.hard_type, hard_type, hard_type_len) == 0)
+        && (g_sync_new.hard_generation == lock_hard_generation_get()))
+    {
+        APP_DEBUG_PRINTF("sync new resume from pkg: %d", g_sync_new.pkg_acked);
+        g_sync_new.pkg_sent = g_sync_new.pkg_acked;
+    }
+    else
+    {
+        memset((void*)&g_sync_new, 0x00, sizeof(open_meth_sync_new_t));
+        g_sync_new.hard_type_len = hard_type_len;
+        memcpy((void*)g_sync_new.hard_type, hard_type, hard_type_len);
+        sync_new_snapshot();
+    }
+    
+    g_sync_new.flag = 1;
+    g_sync_new.paused = 0;
+    sync_new_pkg_prefetch(g_sync_new.pkg_sent);
+    sync_new_pump();
+    return APP_PORT_SUCCESS;
+}
+
+/*********************************************************
+FN: dp report response
+*/
+void lock_open_meth_sync_new_report(uint8_t status)
+{
+    if(g_sync_new.flag != 1) {
+        return;
+    }
+    
+    if(status != 0) {
+        //stop here, a new request with the same hard types resumes from pkg_acked
+        g_sync_new.flag = 0;
+        g_sync_new.paused = 1;
+        return;
+    }
+    
+    if(g_sync_new.pkg_acked < g_sync_new.pkg_sent) {
+        g_sync_new.pkg_acked++;
+    }
+    sync_new_pump();
+}
+
+/*********************************************************
+FN: 
+*/
+void lock_open_meth_sync_new_disconn_handler(void)
+{
+    if(g_sync_new.flag == 1) {
+        g_sync_new.flag = 0;
+        g_sync_new.paused = 1;
     }
 }
 
@@ -376,33 +609,35 @@ PM: dp_id - defined in "lock_dp_parser.h"
 */
 uint32_t lock_state_sync_report(uint8_t dp_id, uint32_t data)
 {
-    g_rsp.dp_id = dp_id;
+    lock_record_dp_t report = {0};
+    
+    report.dp_id = dp_id;
     
     switch(dp_id)
     {
         //dp_type = value
         case OR_STS_AUTH_LOCK_OUTTIME:
         case OR_STS_BATTERY_PERCENT: {
-            g_rsp.dp_type = APP_PORT_DT_VALUE;
-            g_rsp.dp_data_len = APP_PORT_DT_VALUE_LEN;
-            g_rsp.dp_data[0] = data>>24;
-            g_rsp.dp_data[1] = data>>16;
-            g_rsp.dp_data[2] = data>>8;
-            g_rsp.dp_data[3] = data;
+            report.dp_type = APP_PORT_DT_VALUE;
+            report.dp_data_len = APP_PORT_DT_VALUE_LEN;
+            report.dp_data[0] = data>>24;
+            report.dp_data[1] = data>>16;
+            report.dp_data[2] = data>>8;
+            report.dp_data[3] = data;
         } break;
         
         //dp_type = enum, but data is value, compatible with OR_BATTERY_PERCENT
         case OR_STS_BATTERY_POSITION: {
-            g_rsp.dp_type = APP_PORT_DT_ENUM;
-            g_rsp.dp_data_len = APP_PORT_DT_ENUM_LEN;
-            g_rsp.dp_data[0] = (data > 66) ? 0x00 : ((data > 33) ? 0x01 : 0x02);
+            report.dp_type = APP_PORT_DT_ENUM;
+            report.dp_data_len = APP_PORT_DT_ENUM_LEN;
+            report.dp_data[0] = (data > 66) ? 0x00 : ((data > 33) ? 0x01 : 0x02);
         } break;
         
         //dp_type = enum
         case OR_STS_DOOR_STATE: {
-            g_rsp.dp_type = APP_PORT_DT_ENUM;
-            g_rsp.dp_data_len = APP_PORT_DT_ENUM_LEN;
-            g_rsp.dp_data[0] = data;
+            report.dp_type = APP_PORT_DT_ENUM;
+            report.dp_data_len = APP_PORT_DT_ENUM_LEN;
+            report.dp_data[0] = data;
         } break;
         
         //dp_type = bool
@@ -411,16 +646,16 @@ uint32_t lock_state_sync_report(uint8_t dp_id, uint32_t data)
         case WR_STS_REVERSE_LOCK:
         case OR_STS_DOORBELL_RING:
         case OR_STS_LOCK_STATE: {
-            g_rsp.dp_type = APP_PORT_DT_BOOL;
-            g_rsp.dp_data_len = APP_PORT_DT_BOOL_LEN;
-            g_rsp.dp_data[0] = data;
+            report.dp_type = APP_PORT_DT_BOOL;
+            report.dp_data_len = APP_PORT_DT_BOOL_LEN;
+            report.dp_data[0] = data;
         } break;
         
         default: {
         } break;
     }
   
-    return app_port_dp_data_report((void*)&g_rsp, (3 + g_rsp.dp_data_len));
+    return app_port_dp_data_report((void*)&report, (3 + report.dp_data_len));
 }
 
 
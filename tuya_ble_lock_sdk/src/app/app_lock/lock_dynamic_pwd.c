@@ -1,5 +1,4 @@
 #include "lock_dynamic_pwd.h"
-#include "math.h"
 
 
 
@@ -7,15 +6,37 @@
 /*********************************************************************
  * LOCAL CONSTANTS
  */
+#define DYNAMIC_PWD_TOKEN_MOD           (100000000u)   //10^DYNAMIC_PWD_TOKEN_SIZE
+#define DYNAMIC_PWD_REPLAY_CACHE_SIZE   (4)
 
 /*********************************************************************
  * LOCAL STRUCT
  */
+typedef struct
+{
+    uint32_t pwd;
+    uint32_t timeseq;
+} dynamic_pwd_replay_t;
 
 /*********************************************************************
  * LOCAL VARIABLES
  */
-//static uint32_t s_last_dynamic_pwd = 0;
+//login_key 的 HMAC 中间状态, 绑定后第一次验证时计算
+static cpt_hmac_sha1_ctx_t s_hmac_ctx;
+static uint8_t s_hmac_key[LOGIN_KEY_LEN];
+static bool s_hmac_ready = false;
+
+//已使用的动态密码, 在有效窗口内不能再次使用
+static dynamic_pwd_replay_t s_replay_cache[DYNAMIC_PWD_REPLAY_CACHE_SIZE];
+static uint8_t s_replay_cache_idx = 0;
+
+//本地时钟相对 app 的偏移(时间步), 校时后清零
+static int32_t s_drift_steps = 0;
+//待确认的偏移, 连续 DYNAMIC_PWD_DRIFT_CONFIRM_CNT 次匹配到同一偏移才采用
+static int32_t s_drift_candidate = 0;
+static uint8_t s_drift_hits = 0;
+//上次校时的时间戳, 限制可采用的偏移
+static uint32_t s_drift_sync_ts = 0;
 
 /*********************************************************************
  * LOCAL FUNCTION
@@ -30,18 +51,22 @@
 
 /*********************************************************
 FN: timeseq = (timestamp / DYNAMIC_PWD_TIME_STEP)
+    "%08X", a uint32_t never needs more than 8 hex digits
 */
 static int get_timer_string(unsigned int timeseq, int str_len, char *time_str)
 {
-    if ( (timeseq == 0) || (str_len == 0) || (time_str == NULL) ) {
+    const char hex[] = "0123456789ABCDEF";
+    
+    if ( (timeseq == 0) || (str_len <= DYNAMIC_PWD_TOKEN_SIZE) || (time_str == NULL) ) {
         APP_DEBUG_PRINTF("get_timer_string paras err\r\n");
         return -1;
     }
 
-    snprintf(time_str, str_len, "%X", timeseq);
-    if (strlen(time_str) < DYNAMIC_PWD_TOKEN_SIZE) {
-        snprintf(time_str, str_len, "%08X", timeseq);
+    for (int idx = DYNAMIC_PWD_TOKEN_SIZE - 1; idx >= 0; idx--) {
+        time_str[idx] = hex[timeseq & 0x0F];
+        timeseq >>= 4;
     }
+    time_str[DYNAMIC_PWD_TOKEN_SIZE] = '\0';
 
     APP_DEBUG_PRINTF(" get pass timer is %s", time_str);
     return 0;
@@ -64,14 +89,104 @@ static uint32_t TruncateSHA1(uint8_t *digest)
 /*********************************************************
 FN: 
 */
-static uint32_t TOTP(uint8_t *key, unsigned int key_len, uint8_t *msg, unsigned int msg_len, unsigned int digits) 
+static uint32_t TOTP(const cpt_hmac_sha1_ctx_t *ctx, uint8_t *msg, unsigned int msg_len) 
 {
-	uint8_t digest[20];
+	uint8_t digest[CPT_SHA1_LEN];
 	uint32_t dt;
 
-	HMAC_SHA1(key, key_len, msg, msg_len, digest);
+	cpt_hmac_sha1_finish(ctx, msg, msg_len, digest);
 	dt = TruncateSHA1(digest);
-	return dt % (int)pow(10.0, digits);
+	return dt % DYNAMIC_PWD_TOKEN_MOD;
+}
+
+/*********************************************************
+FN: 
+*/
+static void dynamic_pwd_key_prepare(uint8_t *key)
+{
+    if (s_hmac_ready && (memcmp(s_hmac_key, key, LOGIN_KEY_LEN) == 0)) {
+        return;
+    }
+    
+    cpt_hmac_sha1_precompute(&s_hmac_ctx, key, LOGIN_KEY_LEN);
+    memcpy(s_hmac_key, key, LOGIN_KEY_LEN);
+    s_hmac_ready = true;
+}
+
+/*********************************************************
+FN: 
+*/
+static bool dynamic_pwd_is_replayed(uint32_t pwd, uint32_t min_timeseq)
+{
+    for (int idx=0; idx<DYNAMIC_PWD_REPLAY_CACHE_SIZE; idx++) {
+        if ((s_replay_cache[idx].timeseq != 0)
+            && (s_replay_cache[idx].timeseq >= min_timeseq)
+            && (s_replay_cache[idx].pwd == pwd)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*********************************************************
+FN: 
+*/
+static void dynamic_pwd_replay_add(uint32_t pwd, uint32_t timeseq)
+{
+    s_replay_cache[s_replay_cache_idx].pwd = pwd;
+    s_replay_cache[s_replay_cache_idx].timeseq = timeseq;
+    s_replay_cache_idx = (s_replay_cache_idx + 1) % DYNAMIC_PWD_REPLAY_CACHE_SIZE;
+}
+
+/*********************************************************
+FN: largest drift the local clock can have gathered since the last sync
+*/
+static int32_t dynamic_pwd_drift_bound(uint32_t ts)
+{
+    //开机后还没校时, 从第一次验证开始计算
+    if (s_drift_sync_ts == 0) {
+        s_drift_sync_ts = ts;
+    }
+    if (ts <= s_drift_sync_ts) {
+        return 0;
+    }
+    
+    uint64_t steps = ((uint64_t)(ts - s_drift_sync_ts) * DYNAMIC_PWD_DRIFT_MAX_PPM) / (1000000u * DYNAMIC_PWD_TIME_STEP);
+    return (steps > DYNAMIC_PWD_DRIFT_MAX_STEPS) ? DYNAMIC_PWD_DRIFT_MAX_STEPS : (int32_t)steps;
+}
+
+/*********************************************************
+FN: offset - step offset of the match from the current centre
+*/
+static void dynamic_pwd_drift_update(int32_t offset, uint32_t ts)
+{
+    int32_t drift = s_drift_steps + offset;
+    int32_t bound = dynamic_pwd_drift_bound(ts);
+    
+    //中心匹配, 当前偏移仍然正确
+    if (offset == 0) {
+        s_drift_hits = 0;
+        return;
+    }
+    
+    //单次偏移可能只是用户输入了上一个时间步的密码, 不能直接累加
+    if ((s_drift_hits > 0) && (drift == s_drift_candidate)) {
+        s_drift_hits++;
+    } else {
+        s_drift_candidate = drift;
+        s_drift_hits = 1;
+    }
+    if (s_drift_hits < DYNAMIC_PWD_DRIFT_CONFIRM_CNT) {
+        return;
+    }
+    
+    if (drift > bound) {
+        drift = bound;
+    } else if (drift < -bound) {
+        drift = -bound;
+    }
+    s_drift_steps = drift;
+    s_drift_hits = 0;
 }
 
 /*********************************************************
@@ -97,39 +212,47 @@ FN:
 */
 static int verify_dynamic_pwd_token(uint8_t *key, unsigned int key_len, uint8_t *pwd, uint8_t pwd_len, uint32_t ts)
 {
-	uint32_t timestamp, timeseq;
+	int32_t center, offset;
+	uint32_t timeseq;
 	uint32_t input_pwd, cal_dynamicpwd;
 
-	if ((key == NULL) || (pwd == NULL) || (pwd_len < DYNAMIC_PWD_TOKEN_SIZE) || (ts == 0))
+	if ((key == NULL) || (key_len != LOGIN_KEY_LEN) || (pwd == NULL) || (pwd_len < DYNAMIC_PWD_TOKEN_SIZE) || (ts == 0))
 		return DYNAMIC_PWD_ERR_PARAS;
 
+    center = (int32_t)(ts / DYNAMIC_PWD_TIME_STEP) + s_drift_steps;
+    
 	/* Convert pwd number to integer, Is dynamic pwd is used */
 	input_pwd = pwd_number_convert_to_integer(pwd, pwd_len);
-//	if (input_pwd == s_last_dynamic_pwd) {
-//		APP_DEBUG_PRINTF("dynamic pwd already used\r\n");
-//		return DYNAMIC_PWD_ERR_USED;
-//	}
+	if (dynamic_pwd_is_replayed(input_pwd, (center > DYNAMIC_PWD_WINDOW_STEPS) ? (center - DYNAMIC_PWD_WINDOW_STEPS) : 0)) {
+		APP_DEBUG_PRINTF("dynamic pwd already used\r\n");
+		return DYNAMIC_PWD_ERR_USED;
+	}
     
-	/* Calc dynamic pwd */
-    timestamp = ts;
-    for (int verify_cnt=0; verify_cnt<3; verify_cnt++) {
-        if (verify_cnt == 0)
-            timeseq = (timestamp / DYNAMIC_PWD_TIME_STEP);
-        else if (verify_cnt == 1)
-            timeseq = ((timestamp + DYNAMIC_PWD_TIME_WINDOW) / DYNAMIC_PWD_TIME_STEP);
-        else if (verify_cnt == 2)
-            timeseq = ((timestamp - DYNAMIC_PWD_TIME_WINDOW) / DYNAMIC_PWD_TIME_STEP);
+    dynamic_pwd_key_prepare(key);
+    
+	/* Calc dynamic pwd, center first, then +1, -1, +2, -2 ... */
+    for (int verify_cnt=0; verify_cnt<(2*DYNAMIC_PWD_WINDOW_STEPS + 1); verify_cnt++) {
+        offset = (verify_cnt + 1) / 2;
+        if ((verify_cnt & 0x01) == 0) {
+            offset = -offset;
+        }
+        if (center + offset <= 0) {
+            continue;
+        }
+        timeseq = center + offset;
             
         char timeseq_str[DYNAMIC_PWD_TOKEN_SIZE+1] = {0};
-        memset(timeseq_str, 0, sizeof(timeseq_str));
         if (get_timer_string(timeseq, sizeof(timeseq_str), timeseq_str))
             return DYNAMIC_PWD_ERR_PARAS;
 
-    	cal_dynamicpwd = TOTP(key, key_len, (uint8_t *)&timeseq_str, strlen(timeseq_str), 8);
-    	APP_DEBUG_PRINTF("calc dynamic pwd->[%d]-[%08d]\r\n", verify_cnt, cal_dynamicpwd);
+    	cal_dynamicpwd = TOTP(&s_hmac_ctx, (uint8_t *)&timeseq_str, DYNAMIC_PWD_TOKEN_SIZE);
+    	APP_DEBUG_PRINTF("calc dynamic pwd->[%d]-[%08d]\r\n", offset, cal_dynamicpwd);
     	if (input_pwd == cal_dynamicpwd) {
-//    		s_last_dynamic_pwd = cal_dynamicpwd;
-    		APP_DEBUG_PRINTF("dynamic pwd verify pass\r\n");
+    		dynamic_pwd_replay_add(cal_dynamicpwd, timeseq);
+    		
+    		//偏移确认后, 下次从这里开始找
+    		dynamic_pwd_drift_update(offset, ts);
+    		APP_DEBUG_PRINTF("dynamic pwd verify pass, drift->[%d]\r\n", s_drift_steps);
     		return DYNAMIC_PWD_VERIFY_SUCCESS;
     	} 
     }
@@ -146,6 +269,32 @@ int lock_dynamic_pwd_verify(uint8_t *pwd, uint8_t size)
     return verify_dynamic_pwd_token(tuya_ble_current_para.sys_settings.login_key, LOGIN_KEY_LEN, pwd, size, app_port_get_timestamp());
 }
 
+/*********************************************************
+FN: local clock was just synced with app
+*/
+void lock_dynamic_pwd_drift_reset(void)
+{
+    s_drift_steps = 0;
+    s_drift_hits = 0;
+    s_drift_sync_ts = app_port_get_timestamp();
+}
+
+/*********************************************************
+FN: login_key changes after unbind
+*/
+void lock_dynamic_pwd_key_wipe(void)
+{
+    cpt_crypto_zeroize(&s_hmac_ctx, sizeof(s_hmac_ctx));
+    cpt_crypto_zeroize(s_hmac_key, sizeof(s_hmac_key));
+    s_hmac_ready = false;
+    
+    memset(s_replay_cache, 0, sizeof(s_replay_cache));
+    s_replay_cache_idx = 0;
+    
+    s_drift_steps = 0;
+    s_drift_hits = 0;
+}
+
 
 
 
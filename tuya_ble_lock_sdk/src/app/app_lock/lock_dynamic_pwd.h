@@ -29,9 +29,26 @@ extern "C"
 /*********************************************************************
  * CONSTANTS
  */
-#define DYNAMIC_PWD_TOKEN_SIZE			( 8 )		// ̬
-#define DYNAMIC_PWD_TIME_STEP			( 5 * 60 )	// ʱ䲽 5
-#define DYNAMIC_PWD_TIME_WINDOW			( 5 * 60 )	// ݴʱ䴰5
+#define DYNAMIC_PWD_TOKEN_SIZE			( 8 )		// 动态口令长度
+#define DYNAMIC_PWD_TIME_STEP			( 5 * 60 )	// 时间步长 5分钟
+#define DYNAMIC_PWD_TIME_WINDOW			( 5 * 60 )	// 容错时间窗口5分钟
+
+//以(当前时间步 + 已记录的时钟偏移)为中心, 向两侧各尝试 N 个时间步
+#ifndef DYNAMIC_PWD_WINDOW_STEPS
+#define DYNAMIC_PWD_WINDOW_STEPS        ( DYNAMIC_PWD_TIME_WINDOW / DYNAMIC_PWD_TIME_STEP )
+#endif
+//记录的时钟偏移上限(时间步), 12 = 1小时
+#ifndef DYNAMIC_PWD_DRIFT_MAX_STEPS
+#define DYNAMIC_PWD_DRIFT_MAX_STEPS     ( 12 )
+#endif
+//同一偏移连续匹配次数, 达到后才采用
+#ifndef DYNAMIC_PWD_DRIFT_CONFIRM_CNT
+#define DYNAMIC_PWD_DRIFT_CONFIRM_CNT   ( 3 )
+#endif
+//本地时钟最大误差(ppm), 校时后经过的时间 * 误差 = 可采用的最大偏移, 500ppm 约7天1个时间步
+#ifndef DYNAMIC_PWD_DRIFT_MAX_PPM
+#define DYNAMIC_PWD_DRIFT_MAX_PPM       ( 500 )
+#endif
 
 /*********************************************************************
  * STRUCT
@@ -51,6 +68,8 @@ typedef enum {
  * EXTERNAL FUNCTIONS
  */
 int lock_dynamic_pwd_verify(uint8_t *pwd, uint8_t size);
+void lock_dynamic_pwd_key_wipe(void);
+void lock_dynamic_pwd_drift_reset(void);
 
 
 #ifdef __cplusplus
@@ -171,7 +171,7 @@ void lock_hard_uart_simulate(uint8_t cmd, uint8_t* data, uint16_t len)
             {
                 APP_DEBUG_PRINTF("OPEN_METH_PASSWORD creat complete");
                 lock_hard_creat_sub_report(OPEN_METH_PASSWORD, REG_STAGE_COMPLETE, lock_get_hardid(OPEN_METH_PASSWORD), REG_NOUSE_DEFAULT_VALUE, REG_NOUSE_DEFAULT_VALUE);
-                lock_hard_save_in_local_flash(OPEN_METH_PASSWORD);
+                lock_hard_save_in_local_flash(OPEN_METH_PASSWORD, &g_creat_cmd);
             }
             //reg fail, data[1] = reg_stage_t, data[2] = reg_failed_reason_t
             else if(data[0] == 0x02)
@@ -187,7 +187,7 @@ void lock_hard_uart_simulate(uint8_t cmd, uint8_t* data, uint16_t len)
             {
                 APP_DEBUG_PRINTF("OPEN_METH_DOORCARD creat complete");
                 lock_hard_creat_sub_report(OPEN_METH_DOORCARD, REG_STAGE_COMPLETE, lock_get_hardid(OPEN_METH_DOORCARD), REG_NOUSE_DEFAULT_VALUE, REG_NOUSE_DEFAULT_VALUE);
-                lock_hard_save_in_local_flash(OPEN_METH_DOORCARD);
+                lock_hard_save_in_local_flash(OPEN_METH_DOORCARD, &g_creat_cmd);
             }
             //reg fail, data[1] = reg_stage_t, data[2] = reg_failed_reason_t
             else if(data[0] == 0x02)
@@ -217,7 +217,7 @@ void lock_hard_uart_simulate(uint8_t cmd, uint8_t* data, uint16_t len)
             {
                 APP_DEBUG_PRINTF("OPEN_METH_FINGER creat complete");
                 lock_hard_creat_sub_report(OPEN_METH_FINGER, REG_STAGE_COMPLETE, lock_get_hardid(OPEN_METH_FINGER), REG_NOUSE_DEFAULT_VALUE, REG_NOUSE_DEFAULT_VALUE);
-                lock_hard_save_in_local_flash(OPEN_METH_FINGER);
+                lock_hard_save_in_local_flash(OPEN_METH_FINGER, &g_creat_cmd);
             }
             //reg fail, data[1] = reg_stage_t, data[2] = reg_failed_reason_t
             else if(data[0] == 0x02)
@@ -233,7 +233,7 @@ void lock_hard_uart_simulate(uint8_t cmd, uint8_t* data, uint16_t len)
             {
                 APP_DEBUG_PRINTF("OPEN_METH_FACE creat complete");
                 lock_hard_creat_sub_report(OPEN_METH_FACE, REG_STAGE_COMPLETE, lock_get_hardid(OPEN_METH_FACE), REG_NOUSE_DEFAULT_VALUE, REG_NOUSE_DEFAULT_VALUE);
-                lock_hard_save_in_local_flash(OPEN_METH_FACE);
+                lock_hard_save_in_local_flash(OPEN_METH_FACE, &g_creat_cmd);
             }
             //reg fail, data[1] = reg_stage_t, data[2] = reg_failed_reason_t
             else if(data[0] == 0x02)
@@ -7,10 +7,33 @@
 /*********************************************************************
  * LOCAL CONSTANTS
  */
+//(type, pwd) -> slot 哈希索引
+#define OFFLINE_PWD_HASH_SIZE           (64)
+#define OFFLINE_PWD_SLOT_NONE           (0xFF)
+
+//status 字节: bit0-1 状态, bit2-7 写入时的清空纪元(epoch)
+#define OFFLINE_PWD_STATUS_MASK         (0x03)
+#define OFFLINE_PWD_EPOCH_SHIFT         (2)
+#define OFFLINE_PWD_EPOCH_MASK          (0x3F)
+
+//覆盖优先级, 淘汰键的高2位
+#define OFFLINE_PWD_EVICT_CLASS_SHIFT   (30)
+#define OFFLINE_PWD_EVICT_TIMELINESS_INVALID    (0u)
+#define OFFLINE_PWD_EVICT_TIMELINESS_VALID      (1u)
+#define OFFLINE_PWD_EVICT_SINGLE                (2u)
+#define OFFLINE_PWD_EVICT_CLEAR_ALL             (3u)
 
 /*********************************************************************
  * LOCAL STRUCT
  */
+//最小堆, 键相同时slot小的优先(与原线性扫描选中的slot一致)
+typedef struct
+{
+    uint8_t  node[OFFLINE_PWD_MAX_NUM];
+    uint8_t  pos[OFFLINE_PWD_MAX_NUM];
+    uint8_t  size;
+    uint32_t (*key)(uint8_t pwdid);
+} lock_offline_pwd_heap_t;
 
 /*********************************************************************
  * LOCAL VARIABLES
@@ -18,13 +41,42 @@
 static uint32_t T0 = 1589251799;
 static volatile bool is_T0_updated = true;
 
+//SF_AREA_3 的内存镜像, 上电加载后只在状态变化时写flash
+static lock_offline_pwd_storage_t s_pwd_table[OFFLINE_PWD_MAX_NUM];
+static uint8_t s_pwd_hash_head[OFFLINE_PWD_HASH_SIZE];
+static uint8_t s_pwd_hash_next[OFFLINE_PWD_MAX_NUM];
+//未使用的slot按序号升序链接, 复用 s_pwd_hash_next
+static uint8_t s_pwd_free_head;
+//已使用的slot: 按T3排序(判断过期) / 按覆盖优先级排序
+static lock_offline_pwd_heap_t s_pwd_expire_heap;
+static lock_offline_pwd_heap_t s_pwd_evict_heap;
+//清空所有密码只递增纪元, 旧纪元的有效密码视为无效, slot 复用时才真正改写
+static uint8_t s_pwd_epoch;
+
 /*********************************************************************
  * LOCAL FUNCTION
  */
+static uint8_t  lock_offline_pwd_hash(uint8_t type, uint32_t pwd);
+static void     lock_offline_pwd_hash_insert(int32_t pwdid);
+static void     lock_offline_pwd_hash_remove(int32_t pwdid);
+static int32_t  lock_offline_pwd_hash_lookup(uint8_t type, uint32_t pwd);
+static void     lock_offline_pwd_free_push(uint8_t pwdid);
+static void     lock_offline_pwd_free_remove(uint8_t pwdid);
+static uint32_t lock_offline_pwd_expire_key(uint8_t pwdid);
+static uint32_t lock_offline_pwd_evict_key(uint8_t pwdid);
+static bool     lock_offline_pwd_heap_less(lock_offline_pwd_heap_t* heap, uint8_t a, uint8_t b);
+static void     lock_offline_pwd_heap_set(lock_offline_pwd_heap_t* heap, uint8_t idx, uint8_t pwdid);
+static void     lock_offline_pwd_heap_sift(lock_offline_pwd_heap_t* heap, uint8_t idx);
+static void     lock_offline_pwd_heap_insert(lock_offline_pwd_heap_t* heap, uint8_t pwdid);
+static void     lock_offline_pwd_heap_remove(lock_offline_pwd_heap_t* heap, uint8_t pwdid);
+static void     lock_offline_pwd_index_attach(int32_t pwdid);
+static void     lock_offline_pwd_index_detach(int32_t pwdid);
+static uint8_t  lock_offline_pwd_status_get(lock_offline_pwd_storage_t* pwd_storage);
+static uint32_t lock_offline_pwd_epoch_advance(void);
+static void lock_offline_pwd_storage_calculate_T2_T3_offset(lock_offline_pwd_storage_t* pwd_storage, uint32_t* pT2, uint32_t* pT3);
 static uint32_t lock_offline_pwd_save(int32_t pwdid, lock_offline_pwd_storage_t* pwd_storage);
 static uint32_t lock_offline_pwd_load(int32_t pwdid, lock_offline_pwd_storage_t* pwd_storage);
 static void lock_offline_pwd_calculate_T2_T3(lock_offline_pwd_t *pwd, uint32_t* pT2, uint32_t* pT3);
-static void lock_offline_pwd_storage_calculate_T2_T3(lock_offline_pwd_storage_t* pwd_storage, uint32_t* pT2, uint32_t* pT3);
 static int32_t lock_offline_pwd_find(uint32_t T_now);
 static int32_t is_offline_pwd_exist(enum_offline_pwd_type_t type, uint32_t pwd_integer, lock_offline_pwd_storage_t *data);
 static int32_t lock_offline_pwd_clear(enum_offline_pwd_type_t type, uint32_t pwd);
@@ -36,6 +88,283 @@ static int32_t lock_offline_pwd_clear(enum_offline_pwd_type_t type, uint32_t pwd
 
 
 
+/*********************************************************
+FN: 
+*/
+static uint8_t lock_offline_pwd_hash(uint8_t type, uint32_t pwd)
+{
+    return (((pwd ^ type) * 2654435761u) >> 26) % OFFLINE_PWD_HASH_SIZE;
+}
+
+/*********************************************************
+FN: 
+*/
+static void lock_offline_pwd_hash_insert(int32_t pwdid)
+{
+    uint8_t hash = lock_offline_pwd_hash(s_pwd_table[pwdid].type, s_pwd_table[pwdid].pwd);
+    
+    s_pwd_hash_next[pwdid] = s_pwd_hash_head[hash];
+    s_pwd_hash_head[hash] = pwdid;
+}
+
+/*********************************************************
+FN: 
+*/
+static void lock_offline_pwd_hash_remove(int32_t pwdid)
+{
+    uint8_t* p_slot = &s_pwd_hash_head[lock_offline_pwd_hash(s_pwd_table[pwdid].type, s_pwd_table[pwdid].pwd)];
+    
+    while(*p_slot != OFFLINE_PWD_SLOT_NONE)
+    {
+        if(*p_slot == pwdid) {
+            *p_slot = s_pwd_hash_next[pwdid];
+            break;
+        }
+        p_slot = &s_pwd_hash_next[*p_slot];
+    }
+    s_pwd_hash_next[pwdid] = OFFLINE_PWD_SLOT_NONE;
+}
+
+/*********************************************************
+FN: 
+RT: >= 0 pwdid, -1 not found
+*/
+static int32_t lock_offline_pwd_hash_lookup(uint8_t type, uint32_t pwd)
+{
+    uint8_t slot = s_pwd_hash_head[lock_offline_pwd_hash(type, pwd)];
+    
+    while(slot != OFFLINE_PWD_SLOT_NONE)
+    {
+        if((s_pwd_table[slot].type == type) && (s_pwd_table[slot].pwd == pwd)) {
+            return slot;
+        }
+        slot = s_pwd_hash_next[slot];
+    }
+    return -1;
+}
+
+/*********************************************************
+FN: 
+*/
+static void lock_offline_pwd_free_push(uint8_t pwdid)
+{
+    uint8_t* p_slot = &s_pwd_free_head;
+    
+    while((*p_slot != OFFLINE_PWD_SLOT_NONE) && (*p_slot < pwdid))
+    {
+        p_slot = &s_pwd_hash_next[*p_slot];
+    }
+    s_pwd_hash_next[pwdid] = *p_slot;
+    *p_slot = pwdid;
+}
+
+/*********************************************************
+FN: 
+*/
+static void lock_offline_pwd_free_remove(uint8_t pwdid)
+{
+    uint8_t* p_slot = &s_pwd_free_head;
+    
+    while(*p_slot != OFFLINE_PWD_SLOT_NONE)
+    {
+        if(*p_slot == pwdid) {
+            *p_slot = s_pwd_hash_next[pwdid];
+            break;
+        }
+        p_slot = &s_pwd_hash_next[*p_slot];
+    }
+    s_pwd_hash_next[pwdid] = OFFLINE_PWD_SLOT_NONE;
+}
+
+/*********************************************************
+FN: T3 - T0_round
+*/
+static uint32_t lock_offline_pwd_expire_key(uint8_t pwdid)
+{
+    uint32_t T2, T3;
+    lock_offline_pwd_storage_calculate_T2_T3_offset(&s_pwd_table[pwdid], &T2, &T3);
+    return T3;
+}
+
+/*********************************************************
+FN: 
+*/
+static uint32_t lock_offline_pwd_evict_key(uint8_t pwdid)
+{
+    uint32_t T2, T3;
+    lock_offline_pwd_storage_t* pwd_storage = &s_pwd_table[pwdid];
+    
+    lock_offline_pwd_storage_calculate_T2_T3_offset(pwd_storage, &T2, &T3);
+    
+    if (pwd_storage->type == PWD_TYPE_TIMELINESS) {
+        if (lock_offline_pwd_status_get(pwd_storage) == PWD_STATUS_INVALID) {
+            return (OFFLINE_PWD_EVICT_TIMELINESS_INVALID << OFFLINE_PWD_EVICT_CLASS_SHIFT) | T3;
+        }
+        return (OFFLINE_PWD_EVICT_TIMELINESS_VALID << OFFLINE_PWD_EVICT_CLASS_SHIFT) | T2;
+    }
+    else if (pwd_storage->type == PWD_TYPE_SINGLE) {
+        return (OFFLINE_PWD_EVICT_SINGLE << OFFLINE_PWD_EVICT_CLASS_SHIFT) | T3;
+    }
+    return (OFFLINE_PWD_EVICT_CLEAR_ALL << OFFLINE_PWD_EVICT_CLASS_SHIFT) | T3;
+}
+
+/*********************************************************
+FN: 
+*/
+static bool lock_offline_pwd_heap_less(lock_offline_pwd_heap_t* heap, uint8_t a, uint8_t b)
+{
+    uint32_t key_a = heap->key(a);
+    uint32_t key_b = heap->key(b);
+    
+    return (key_a < key_b) || ((key_a == key_b) && (a < b));
+}
+
+/*********************************************************
+FN: 
+*/
+static void lock_offline_pwd_heap_set(lock_offline_pwd_heap_t* heap, uint8_t idx, uint8_t pwdid)
+{
+    heap->node[idx] = pwdid;
+    heap->pos[pwdid] = idx;
+}
+
+/*********************************************************
+FN: 
+*/
+static void lock_offline_pwd_heap_sift(lock_offline_pwd_heap_t* heap, uint8_t idx)
+{
+    uint8_t pwdid = heap->node[idx];
+    
+    //up
+    while(idx > 0)
+    {
+        uint8_t parent = (idx - 1) / 2;
+        if(!lock_offline_pwd_heap_less(heap, pwdid, heap->node[parent])) {
+            break;
+        }
+        lock_offline_pwd_heap_set(heap, idx, heap->node[parent]);
+        idx = parent;
+    }
+    
+    //down
+    while(1)
+    {
+        uint16_t child = idx*2 + 1;
+        if(child >= heap->size) {
+            break;
+        }
+        if((child + 1 < heap->size) && lock_offline_pwd_heap_less(heap, heap->node[child + 1], heap->node[child])) {
+            child++;
+        }
+        if(!lock_offline_pwd_heap_less(heap, heap->node[child], pwdid)) {
+            break;
+        }
+        lock_offline_pwd_heap_set(heap, idx, heap->node[child]);
+        idx = child;
+    }
+    
+    lock_offline_pwd_heap_set(heap, idx, pwdid);
+}
+
+/*********************************************************
+FN: 
+*/
+static void lock_offline_pwd_heap_insert(lock_offline_pwd_heap_t* heap, uint8_t pwdid)
+{
+    lock_offline_pwd_heap_set(heap, heap->size, pwdid);
+    heap->size++;
+    lock_offline_pwd_heap_sift(heap, heap->size - 1);
+}
+
+/*********************************************************
+FN: 
+*/
+static void lock_offline_pwd_heap_remove(lock_offline_pwd_heap_t* heap, uint8_t pwdid)
+{
+    uint8_t idx = heap->pos[pwdid];
+    
+    if((idx >= heap->size) || (heap->node[idx] != pwdid)) {
+        return;
+    }
+    
+    heap->size--;
+    if(idx != heap->size) {
+        lock_offline_pwd_heap_set(heap, idx, heap->node[heap->size]);
+        lock_offline_pwd_heap_sift(heap, idx);
+    }
+    heap->pos[pwdid] = OFFLINE_PWD_SLOT_NONE;
+}
+
+/*********************************************************
+FN: effective status of a stored entry
+*/
+static uint8_t lock_offline_pwd_status_get(lock_offline_pwd_storage_t* pwd_storage)
+{
+    uint8_t status = pwd_storage->status & OFFLINE_PWD_STATUS_MASK;
+    
+    if((status == PWD_STATUS_VALID) && ((pwd_storage->status >> OFFLINE_PWD_EPOCH_SHIFT) != s_pwd_epoch)) {
+        return PWD_STATUS_INVALID;
+    }
+    return status;
+}
+
+/*********************************************************
+FN: link s_pwd_table[pwdid] into the hash / free list / heaps
+*/
+static void lock_offline_pwd_index_attach(int32_t pwdid)
+{
+    if(lock_offline_pwd_status_get(&s_pwd_table[pwdid]) == PWD_STATUS_UNUSED) {
+        lock_offline_pwd_free_push(pwdid);
+    } else {
+        lock_offline_pwd_hash_insert(pwdid);
+        lock_offline_pwd_heap_insert(&s_pwd_expire_heap, pwdid);
+        lock_offline_pwd_heap_insert(&s_pwd_evict_heap, pwdid);
+    }
+}
+
+/*********************************************************
+FN: must be called before s_pwd_table[pwdid] changes
+*/
+static void lock_offline_pwd_index_detach(int32_t pwdid)
+{
+    if(lock_offline_pwd_status_get(&s_pwd_table[pwdid]) == PWD_STATUS_UNUSED) {
+        lock_offline_pwd_free_remove(pwdid);
+    } else {
+        lock_offline_pwd_hash_remove(pwdid);
+        lock_offline_pwd_heap_remove(&s_pwd_expire_heap, pwdid);
+        lock_offline_pwd_heap_remove(&s_pwd_evict_heap, pwdid);
+    }
+}
+
+/*********************************************************
+FN: load all offline pwd into ram
+*/
+void lock_offline_pwd_init(void)
+{
+    memset(s_pwd_hash_head, OFFLINE_PWD_SLOT_NONE, sizeof(s_pwd_hash_head));
+    memset(s_pwd_hash_next, OFFLINE_PWD_SLOT_NONE, sizeof(s_pwd_hash_next));
+    s_pwd_free_head = OFFLINE_PWD_SLOT_NONE;
+    
+    memset(&s_pwd_expire_heap, 0, sizeof(lock_offline_pwd_heap_t));
+    s_pwd_expire_heap.key = lock_offline_pwd_expire_key;
+    memset(&s_pwd_evict_heap, 0, sizeof(lock_offline_pwd_heap_t));
+    s_pwd_evict_heap.key = lock_offline_pwd_evict_key;
+    
+    if(app_port_nv_get(SF_AREA_0, NV_ID_OFFLINE_PWD_EPOCH, &s_pwd_epoch, sizeof(uint8_t)) != APP_PORT_SUCCESS) {
+        s_pwd_epoch = 0;
+    }
+    
+    //倒序加载, 空闲链表插入时总在表头
+    for (int32_t idx=OFFLINE_PWD_MAX_NUM-1; idx>=0; idx--)
+    {
+        if(app_port_nv_get(SF_AREA_3, idx, &s_pwd_table[idx], sizeof(lock_offline_pwd_storage_t)) != APP_PORT_SUCCESS) {
+            memset(&s_pwd_table[idx], 0, sizeof(lock_offline_pwd_storage_t));
+        }
+        
+        lock_offline_pwd_index_attach(idx);
+    }
+}
+
 /*********************************************************
 FN: 
 */
@@ -45,8 +374,20 @@ static uint32_t lock_offline_pwd_save(int32_t pwdid, lock_offline_pwd_storage_t*
         return APP_PORT_ERROR_COMMON;
     }
     
-	uint32_t err_code = app_port_nv_set(SF_AREA_3, pwdid, pwd_storage, sizeof(lock_offline_pwd_storage_t));
+    lock_offline_pwd_storage_t raw;
+    memcpy(&raw, pwd_storage, sizeof(lock_offline_pwd_storage_t));
+    raw.status = (pwd_storage->status & OFFLINE_PWD_STATUS_MASK) | (s_pwd_epoch << OFFLINE_PWD_EPOCH_SHIFT);
+    
+    //unchanged, don't touch flash
+    if(memcmp(&s_pwd_table[pwdid], &raw, sizeof(lock_offline_pwd_storage_t)) == 0) {
+        return APP_PORT_SUCCESS;
+    }
+    
+	uint32_t err_code = app_port_nv_set(SF_AREA_3, pwdid, &raw, sizeof(lock_offline_pwd_storage_t));
 	if(err_code == APP_PORT_SUCCESS) {
+        lock_offline_pwd_index_detach(pwdid);
+        memcpy(&s_pwd_table[pwdid], &raw, sizeof(lock_offline_pwd_storage_t));
+        lock_offline_pwd_index_attach(pwdid);
         return APP_PORT_SUCCESS;
 	}
     return APP_PORT_ERROR_COMMON;
@@ -61,11 +402,9 @@ static uint32_t lock_offline_pwd_load(int32_t pwdid, lock_offline_pwd_storage_t*
         return APP_PORT_ERROR_COMMON;
     }
     
-	uint32_t err_code = app_port_nv_get(SF_AREA_3, pwdid, pwd_storage, sizeof(lock_offline_pwd_storage_t));
-	if(err_code == APP_PORT_SUCCESS) {
-        return APP_PORT_SUCCESS;
-    }
-	return APP_PORT_ERROR_COMMON;
+    memcpy(pwd_storage, &s_pwd_table[pwdid], sizeof(lock_offline_pwd_storage_t));
+    pwd_storage->status = lock_offline_pwd_status_get(&s_pwd_table[pwdid]);
+	return APP_PORT_SUCCESS;
 }
 
 /*********************************************************
@@ -79,6 +418,9 @@ uint32_t lock_offline_pwd_delete(int32_t pwdid)
     
 	uint32_t err_code = app_port_nv_del(SF_AREA_3, pwdid);
 	if(err_code == APP_PORT_SUCCESS) {
+        lock_offline_pwd_index_detach(pwdid);
+        memset(&s_pwd_table[pwdid], 0, sizeof(lock_offline_pwd_storage_t));
+        lock_offline_pwd_index_attach(pwdid);
         return APP_PORT_SUCCESS;
 	}
     return APP_PORT_ERROR_COMMON;
@@ -91,7 +433,44 @@ uint32_t lock_offline_pwd_delete_all(void)
 {
     for (int32_t idx=0; idx<OFFLINE_PWD_MAX_NUM; idx++)
     {
-        lock_offline_pwd_delete(idx);
+        if(lock_offline_pwd_status_get(&s_pwd_table[idx]) != PWD_STATUS_UNUSED) {
+            lock_offline_pwd_delete(idx);
+        }
+    }
+    return APP_PORT_SUCCESS;
+}
+
+/*********************************************************
+FN: clear all valid pwd with one nv write
+*/
+static uint32_t lock_offline_pwd_epoch_advance(void)
+{
+    uint8_t epoch = (s_pwd_epoch + 1) & OFFLINE_PWD_EPOCH_MASK;
+    
+    //纪元回绕前, 仍带有新纪元标记的有效密码必须先改写, 否则会"复活"
+    for (int32_t idx=0; idx<OFFLINE_PWD_MAX_NUM; idx++)
+    {
+        if(((s_pwd_table[idx].status & OFFLINE_PWD_STATUS_MASK) == PWD_STATUS_VALID)
+            && ((s_pwd_table[idx].status >> OFFLINE_PWD_EPOCH_SHIFT) == epoch)) {
+            lock_offline_pwd_storage_t pwd_storage;
+            lock_offline_pwd_load(idx, &pwd_storage);
+            lock_offline_pwd_save(idx, &pwd_storage);
+        }
+    }
+    
+	if(app_port_nv_set(SF_AREA_0, NV_ID_OFFLINE_PWD_EPOCH, &epoch, sizeof(uint8_t)) != APP_PORT_SUCCESS) {
+        return APP_PORT_ERROR_COMMON;
+    }
+    s_pwd_epoch = epoch;
+    APP_DEBUG_PRINTF("offline pwd epoch->[%d]", s_pwd_epoch);
+    
+    //有效的时效密码全部变为无效, 淘汰顺序需要重建
+    s_pwd_evict_heap.size = 0;
+    for (int32_t idx=0; idx<OFFLINE_PWD_MAX_NUM; idx++)
+    {
+        if(lock_offline_pwd_status_get(&s_pwd_table[idx]) != PWD_STATUS_UNUSED) {
+            lock_offline_pwd_heap_insert(&s_pwd_evict_heap, idx);
+        }
     }
     return APP_PORT_SUCCESS;
 }
@@ -155,7 +534,7 @@ static void lock_offline_pwd_calculate_T2_T3(lock_offline_pwd_t *pwd, uint32_t*
 	*pT3 = T3;
     
     
-    //ӡ T2T3ǰʱ
+    //打印 T2、T3，当前时间
     tuya_ble_time_struct_data_t datatime;
     
     tuya_ble_utc_sec_2_mytime(T2, &datatime, 0);
@@ -175,11 +554,10 @@ static void lock_offline_pwd_calculate_T2_T3(lock_offline_pwd_t *pwd, uint32_t*
 /*********************************************************
 FN: 
 */
-static void lock_offline_pwd_storage_calculate_T2_T3(lock_offline_pwd_storage_t* pwd_storage, uint32_t* pT2, uint32_t* pT3)
+static void lock_offline_pwd_storage_calculate_T2_T3_offset(lock_offline_pwd_storage_t* pwd_storage, uint32_t* pT2, uint32_t* pT3)
 {
 	uint32_t num_1_5 = 0;
     uint32_t num_6_9 = 0;
-	uint32_t T0_round;
     uint32_t T2 = 0;
     uint32_t T3 = 0;
    
@@ -189,8 +567,8 @@ static void lock_offline_pwd_storage_calculate_T2_T3(lock_offline_pwd_storage_t*
     // T0 = T0 - (T0 % 3600)
     // num_1_5 = (T2 - T0)/3600      T2 = num_1_5*3600 + T0
 	// num_6_9 = (T3 - T2)/3600      T3 = num_6_9*3600 + T2
-    T0_round = T0 - (T0 % 3600);
-    T2 = num_1_5*OFFLINE_PWD_TIME_ACCURACY + T0_round;
+    // 这里返回相对 T0_round 的偏移, T0 变化时所有密码整体平移, 排序不变
+    T2 = num_1_5*OFFLINE_PWD_TIME_ACCURACY;
     if (pwd_storage->type == PWD_TYPE_TIMELINESS) {
         T3 = (num_6_9*OFFLINE_PWD_TIME_ACCURACY + T2);
     } else if (pwd_storage->type == PWD_TYPE_SINGLE) {
@@ -208,116 +586,34 @@ FN:
 */
 static int32_t lock_offline_pwd_find(uint32_t T_now)
 {
-    uint32_t T2, T3;
-	int32_t  find_pwdid = -1;
-    bool find_flag = false;
-    lock_offline_pwd_find_info_t info_invalid_pwd;
-    lock_offline_pwd_find_info_t info_valid_pwd;
-    lock_offline_pwd_find_info_t info_single_pwd;
-    lock_offline_pwd_find_info_t info_clear_all;
-    
-    // 洢ȼ
-    // 1.δʹõ
-    // 2.ڵģT3 < T_nowֱӸ
-    // 3.ʱЧ״̬ΪЧģʧЧʱ
-    // 4.ʱЧ״̬ΪЧģЧʱ
-    // 5.綼ǵ룬ʧЧʱ
-    // 6.綼룬ʧЧʱ
-    info_invalid_pwd.found = false;
-    info_valid_pwd.found   = false;
-    info_single_pwd.found  = false;
-    info_clear_all.found = false;
+    uint32_t T0_round = T0 - (T0 % 3600);
     
-    for (int32_t idx=0; idx<OFFLINE_PWD_MAX_NUM; idx++)
-    {
-        lock_offline_pwd_storage_t pwd_storage = {0};
-        lock_offline_pwd_load(idx, &pwd_storage);
-        
-        //δʹõ
-		if (pwd_storage.status == PWD_STATUS_UNUSED)
-        {
-			find_pwdid = idx;
-			find_flag = true;
-            APP_DEBUG_PRINTF("find unused pwdid->[%d]", idx);
-            break;
-		}
-        else
-        {
-            lock_offline_pwd_storage_calculate_T2_T3(&pwd_storage, &T2, &T3);
-            
-            //ڵ
-            if (T3 < T_now) {
-                find_pwdid = idx;
-			    find_flag = true;
-                APP_DEBUG_PRINTF("find outtime(T3<T_now) pwdid->[%d]", idx);
-                break;
-            }
-            //ʱЧ
-            else if (pwd_storage.type == PWD_TYPE_TIMELINESS) {
-                //״̬ΪЧģʧЧʱ
-                if (pwd_storage.status == PWD_STATUS_INVALID) {
-                    if (!info_invalid_pwd.found) {
-                        info_invalid_pwd.found = true;
-                        info_invalid_pwd.min_T = T3;
-                        info_invalid_pwd.pwdid = idx;
-                    } else if (T3 < info_invalid_pwd.min_T) {
-                        info_invalid_pwd.min_T = T3;
-                        info_invalid_pwd.pwdid = idx;
-                    }
-                }
-                //״̬ΪЧģЧʱ
-                else {
-                    if (!info_valid_pwd.found) {
-                        info_valid_pwd.found = true;
-                        info_valid_pwd.min_T = T2;
-                        info_valid_pwd.pwdid = idx;
-                    } else if (T2 < info_valid_pwd.min_T) {
-                        info_valid_pwd.min_T = T2;
-                        info_valid_pwd.pwdid = idx;
-                    }
-                }
-            }
-            //綼ǵ룬ʧЧʱ
-            else if (pwd_storage.type == PWD_TYPE_SINGLE) {
-                if (!info_single_pwd.found) {
-                    info_single_pwd.found = true;
-                    info_single_pwd.min_T = T3;
-                    info_single_pwd.pwdid = idx;
-                } else if (T3 < info_single_pwd.min_T) {
-                    info_single_pwd.min_T = T3;
-                    info_single_pwd.pwdid = idx;
-                }
-            }
-            //綼룬ʧЧʱ
-            else if (pwd_storage.type == PWD_TYPE_CLEAR_ALL) {
-                if (!info_clear_all.found) {
-                    info_clear_all.found = true;
-                    info_clear_all.min_T = T3;
-                    info_clear_all.pwdid = idx;
-                } else if (T3 < info_clear_all.min_T) {
-                    info_clear_all.min_T = T3;
-                    info_clear_all.pwdid = idx;
-                }
-            }
-        }
-	}
-
-    if (!find_flag) {
-        if (info_invalid_pwd.found) {
-            find_pwdid = info_invalid_pwd.pwdid;
-        }
-        else if (info_valid_pwd.found) {
-            find_pwdid = info_valid_pwd.pwdid;
-        }
-        else if (info_single_pwd.found) {
-            find_pwdid = info_single_pwd.pwdid;
-        }
-        else if (info_clear_all.found) {
-            find_pwdid = info_clear_all.pwdid;
-        }
-        APP_DEBUG_PRINTF("all pwdid full, cover id->[%d]", find_pwdid);
+    // 离线密码存储优先级
+    // 1.未使用的
+    // 2.过期的（T3 < T_now），直接覆盖
+    // 3.时效密码中密码状态为无效的，找失效时间最早的
+    // 4.时效密码中密码状态为有效的，找生效时间最早的
+    // 5.如都是单次密码，找失效时间最早的
+    // 6.如都是清空所有密码，找失效时间最早的
+    
+    //未使用的
+    if (s_pwd_free_head != OFFLINE_PWD_SLOT_NONE) {
+        APP_DEBUG_PRINTF("find unused pwdid->[%d]", s_pwd_free_head);
+        return s_pwd_free_head;
+    }
+    
+    if (s_pwd_evict_heap.size == 0) {
+        return -1;
     }
-	return find_pwdid;
+    
+    //过期的
+    if ((lock_offline_pwd_expire_key(s_pwd_expire_heap.node[0]) + T0_round) < T_now) {
+        APP_DEBUG_PRINTF("find outtime(T3<T_now) pwdid->[%d]", s_pwd_expire_heap.node[0]);
+        return s_pwd_expire_heap.node[0];
+    }
+    
+    APP_DEBUG_PRINTF("all pwdid full, cover id->[%d]", s_pwd_evict_heap.node[0]);
+	return s_pwd_evict_heap.node[0];
 }
 
 /*********************************************************
@@ -328,20 +624,12 @@ RT: >= 0 exist
 */
 static int32_t is_offline_pwd_exist(enum_offline_pwd_type_t type, uint32_t pwd_int, lock_offline_pwd_storage_t *data)
 {
-	for (int32_t idx=0; idx<OFFLINE_PWD_MAX_NUM; idx++)
-    {
-        lock_offline_pwd_storage_t pwd_storage = {0};
-        lock_offline_pwd_load(idx, &pwd_storage);
-        
-		if ((pwd_storage.status != PWD_STATUS_UNUSED)
-            && (pwd_storage.type == type)
-            && (pwd_storage.pwd == pwd_int)) {
-            
-			memcpy(data, &pwd_storage, sizeof(lock_offline_pwd_storage_t));
-            return idx;
-		}
-	}
-	return -1;
+    int32_t pwdid = lock_offline_pwd_hash_lookup(type, pwd_int);
+    
+    if(pwdid >= 0) {
+        lock_offline_pwd_load(pwdid, data);
+    }
+	return pwdid;
 }
 
 /*********************************************************
@@ -356,36 +644,54 @@ static int32_t lock_offline_pwd_clear(enum_offline_pwd_type_t type, uint32_t pwd
     
     bool clear_all_flag = false;
     
-    for (int32_t idx=0; idx<OFFLINE_PWD_MAX_NUM; idx++)
+    //清除单条密码, 任意存储类型中pwd相同且slot最小的一条
+    if(type == PWD_TYPE_CLEAR_SINGLE)
     {
-        lock_offline_pwd_storage_t pwd_storage = {0};
-        lock_offline_pwd_load(idx, &pwd_storage);
+        const uint8_t stored_type[] = {PWD_TYPE_TIMELINESS, PWD_TYPE_SINGLE, PWD_TYPE_CLEAR_ALL};
+        int32_t pwdid = -1;
+        
+        for (uint32_t idx=0; idx<sizeof(stored_type); idx++)
+        {
+            int32_t tmp = lock_offline_pwd_hash_lookup(stored_type[idx], pwd);
+            if((tmp >= 0) && ((pwdid < 0) || (tmp < pwdid))) {
+                pwdid = tmp;
+            }
+        }
         
-        //
-        if(type == PWD_TYPE_CLEAR_SINGLE && pwd_storage.pwd == pwd)
+        if(pwdid >= 0)
         {
+            lock_offline_pwd_storage_t pwd_storage;
+            lock_offline_pwd_load(pwdid, &pwd_storage);
+            
             if(pwd_storage.status == PWD_STATUS_VALID) {
                 pwd_storage.status = PWD_STATUS_INVALID;
-                lock_offline_pwd_save(idx, &pwd_storage);
+                lock_offline_pwd_save(pwdid, &pwd_storage);
                 
                 APP_DEBUG_PRINTF("OFFLINE_PWD_CLEAR_SINGLE_SUCCESS");
                 return OFFLINE_PWD_CLEAR_SINGLE_SUCCESS;
             }
-            else if (pwd_storage.status == PWD_STATUS_INVALID) {
+            else {
                 APP_DEBUG_PRINTF("OFFLINE_PWD_ERR_INVALID");
                 return OFFLINE_PWD_ERR_INVALID;
             }
         }
-        //
-        else if (type == PWD_TYPE_CLEAR_ALL)
+    }
+    //清除所有密码
+    else
+    {
+        for (int32_t idx=0; idx<OFFLINE_PWD_MAX_NUM; idx++)
         {
-            if(pwd_storage.status == PWD_STATUS_VALID) {
+            if(lock_offline_pwd_status_get(&s_pwd_table[idx]) == PWD_STATUS_VALID) {
                 clear_all_flag = true;
-                pwd_storage.status = PWD_STATUS_INVALID;
-                lock_offline_pwd_save(idx, &pwd_storage);
+                break;
             }
         }
-	}
+        
+        if(clear_all_flag && (lock_offline_pwd_epoch_advance() != APP_PORT_SUCCESS)) {
+            APP_DEBUG_PRINTF("OFFLINE_PWD_ERR_UNKNOW");
+            return OFFLINE_PWD_ERR_UNKNOW;
+        }
+    }
     
     if(type == PWD_TYPE_CLEAR_SINGLE) {
         APP_DEBUG_PRINTF("OFFLINE_PWD_ERR_NO_EXIST");
@@ -405,13 +711,13 @@ static int32_t lock_offline_pwd_clear(enum_offline_pwd_type_t type, uint32_t pwd
 
 /*********************************************************
 FN: 
-PM: key - 16ֽ޷Ĭַ0ڽβ䡰tuya_ble_current_para.sys_settings.login_key6ֽڣlogin_keyΪ8f7d54keyΪ00000000008f7d54
-    key_len - 16ֽ
-    encrypt_pwd - 루û룩
-    encrypt_pwd_len - 10ֽ
-    timestamp - ǰʱ
-    plain_pwd - 
-    p_plain_pwd_len - 10ֽ
+PM: key - 16字节无符号整数，默认填充字符‘0’，在结尾填充“tuya_ble_current_para.sys_settings.login_key”（6字节），例如login_key为‘8f7d54’，则key为‘00000000008f7d54’
+    key_len - 16字节
+    encrypt_pwd - 离线密码（用户看到的密码）
+    encrypt_pwd_len - 10字节
+    timestamp - 当前时间戳
+    plain_pwd - 明文离线密码
+    p_plain_pwd_len - 10字节
 */
 int32_t lock_offline_pwd_verify(uint8_t *key, uint8_t key_len,
                                     uint8_t *encrypt_pwd, uint8_t encrypt_pwd_len,
@@ -424,7 +730,7 @@ int32_t lock_offline_pwd_verify(uint8_t *key, uint8_t key_len,
 	uint32_t T2, T3, T_now = timestamp;
 	uint32_t active_period;
     
-    //
+    //输入参数检查
 	if ((key == NULL)
             || (key_len != 16 && key_len != 24 && key_len != 32)
             || (encrypt_pwd == NULL)
@@ -433,24 +739,24 @@ int32_t lock_offline_pwd_verify(uint8_t *key, uint8_t key_len,
 		return OFFLINE_PWD_ERR_PARAM;
 	}
 
-    //fpe
+    //fpe解密
 	if (fpe_decrypt(key, key_len, encrypt_pwd, encrypt_pwd_len, decrypt_pwd, &decrypt_pwd_len)) {
 		APP_DEBUG_PRINTF("OFFLINE_PWD_ERR_DECRYPT");
 		return OFFLINE_PWD_ERR_DECRYPT;
 	}
-    //
+    //参数检查
     if (decrypt_pwd_len > OFFLINE_PWD_LEN) {
 		APP_DEBUG_PRINTF("OFFLINE_PWD_ERR_UNKNOW");
         return OFFLINE_PWD_ERR_UNKNOW;
     }
     
-    //ȡ
+    //提取明文密码
     if (plain_pwd != NULL) {
         memcpy(plain_pwd, decrypt_pwd, decrypt_pwd_len);
         *p_plain_pwd_len = decrypt_pwd_len;
     }
     
-    //ͼ
+    //离线密码类型检查
 	lock_offline_pwd_t *pwd = (void*)decrypt_pwd;
     APP_DEBUG_HEXDUMP("decrypt_pwd", (void*)pwd, sizeof(lock_offline_pwd_t));
 	if (pwd->type != PWD_TYPE_TIMELINESS
@@ -461,18 +767,18 @@ int32_t lock_offline_pwd_verify(uint8_t *key, uint8_t key_len,
 		return OFFLINE_PWD_ERR_TYPE;
 	}
 	
-    //ȡT0
+    //读取T0
     lock_offline_pwd_get_T0();
-    //T2T3
+    //计算T2、T3
 	lock_offline_pwd_calculate_T2_T3(pwd, &T2, &T3);
     
     
 	uint32_t num_1_9 = app_port_num_array_2_int(decrypt_pwd, 1, 9);
 	APP_DEBUG_PRINTF("offline pwd info, type->[%d] num_1_9->[%09d]", pwd->type, num_1_9);
-    //ʱЧ/
+    //时效/单次密码
     if (pwd->type == PWD_TYPE_TIMELINESS || pwd->type == PWD_TYPE_SINGLE)
     {
-        //ʱЧ
+        //时效密码
         if(pwd->type == PWD_TYPE_TIMELINESS) {
             if (T2 > T_now) {
                 APP_DEBUG_PRINTF("OFFLINE_PWD_ERR_START_TIME");
@@ -484,7 +790,7 @@ int32_t lock_offline_pwd_verify(uint8_t *key, uint8_t key_len,
             }
             active_period = PWD_ACTIVE_PERIOD_TIMELINESS;
         }
-        //
+        //单次密码
         else if(pwd->type == PWD_TYPE_SINGLE) {
             if (T2 > T_now) {
                 APP_DEBUG_PRINTF("OFFLINE_PWD_ERR_START_TIME");
@@ -501,7 +807,7 @@ int32_t lock_offline_pwd_verify(uint8_t *key, uint8_t key_len,
         lock_offline_pwd_storage_t pwd_storage = {0};
         exist_pwdid = is_offline_pwd_exist((enum_offline_pwd_type_t)pwd->type, num_1_9, &pwd_storage);
         APP_DEBUG_PRINTF("is_offline_pwd_exist, pwdid-->[%d]", exist_pwdid);
-        //Ѿ
+        //离线密码已经存在
         if (exist_pwdid >= 0) {
             if(pwd_storage.status == PWD_STATUS_INVALID) {
                 APP_DEBUG_PRINTF("OFFLINE_PWD_ERR_INVALID");
@@ -511,12 +817,12 @@ int32_t lock_offline_pwd_verify(uint8_t *key, uint8_t key_len,
                 return OFFLINE_PWD_VERIFY_SUCCESS;
             }
         }
-        //볬
+        //离线密码超过激活周期
 		else if ((T_now - T2) > active_period) {
             APP_DEBUG_PRINTF("OFFLINE_PWD_ERR_ACTIVE_TIME");
 			return OFFLINE_PWD_ERR_ACTIVE_TIME;
         }
-        //洢
+        //存储离线密码
 		else {
             APP_DEBUG_PRINTF("lock_offline_pwd_find");
             int32_t find_pwdid = lock_offline_pwd_find(T_now);
@@ -525,7 +831,7 @@ int32_t lock_offline_pwd_verify(uint8_t *key, uint8_t key_len,
 				return OFFLINE_PWD_ERR_NO_SPACE;
 			}
 			
-			pwd_storage.status = (pwd->type == PWD_TYPE_TIMELINESS) ? (PWD_STATUS_VALID) : (PWD_STATUS_INVALID); //ʹһκʧЧ
+			pwd_storage.status = (pwd->type == PWD_TYPE_TIMELINESS) ? (PWD_STATUS_VALID) : (PWD_STATUS_INVALID); //单次密码使用一次后就失效
 			pwd_storage.type   = pwd->type;
 			pwd_storage.pwd    = num_1_9;
             lock_offline_pwd_save(find_pwdid, &pwd_storage);
@@ -534,10 +840,10 @@ int32_t lock_offline_pwd_verify(uint8_t *key, uint8_t key_len,
 			return OFFLINE_PWD_VERIFY_SUCCESS;
         }
     }
-    //
+    //清除单条密码
     else if (pwd->type == PWD_TYPE_CLEAR_SINGLE)
     {
-        //ʱЧ
+        //检查时效性
         if (T2 > T_now) {
             APP_DEBUG_PRINTF("OFFLINE_PWD_ERR_NO_EXIST");
             return OFFLINE_PWD_ERR_NO_EXIST;
@@ -549,14 +855,14 @@ int32_t lock_offline_pwd_verify(uint8_t *key, uint8_t key_len,
         
         return lock_offline_pwd_clear(PWD_TYPE_CLEAR_SINGLE, num_1_9);
     }
-    //
+    //清除所有密码
     else if (pwd->type == PWD_TYPE_CLEAR_ALL)
     {
         if (T2 > T_now) {
             APP_DEBUG_PRINTF("OFFLINE_PWD_ERR_START_TIME");
 			return OFFLINE_PWD_ERR_START_TIME;
         }
-        //볬
+        //离线密码超过激活周期
 		else if ((T_now - T2) > PWD_ACTIVE_PERIOD_CLEAR_ALL) {
             APP_DEBUG_PRINTF("OFFLINE_PWD_ERR_ACTIVE_TIME");
 			return OFFLINE_PWD_ERR_ACTIVE_TIME;
@@ -570,12 +876,12 @@ int32_t lock_offline_pwd_verify(uint8_t *key, uint8_t key_len,
         lock_offline_pwd_storage_t pwd_storage = {0};
         exist_pwdid = is_offline_pwd_exist((enum_offline_pwd_type_t)pwd->type, num_1_9, &pwd_storage);
         APP_DEBUG_PRINTF("is_offline_pwd_exist, pwdid-->[%d]", exist_pwdid);
-        //Ѿ
+        //离线密码已经存在
         if (exist_pwdid >= 0) {
             APP_DEBUG_PRINTF("OFFLINE_PWD_ERR_INVALID");
             return OFFLINE_PWD_ERR_INVALID;
         }
-        //洢
+        //存储离线密码
 		else {
             int32_t find_pwdid = lock_offline_pwd_find(T_now);
 			if (find_pwdid < 0) {
@@ -583,7 +889,7 @@ int32_t lock_offline_pwd_verify(uint8_t *key, uint8_t key_len,
 				return OFFLINE_PWD_ERR_NO_SPACE;
 			}
 			
-			pwd_storage.status = PWD_STATUS_INVALID; //ʹһκʧЧ
+			pwd_storage.status = PWD_STATUS_INVALID; //清空所有密码使用一次后就失效
 			pwd_storage.type   = pwd->type;
 			pwd_storage.pwd    = num_1_9;
             lock_offline_pwd_save(find_pwdid, &pwd_storage);
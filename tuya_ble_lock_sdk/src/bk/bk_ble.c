@@ -43,7 +43,7 @@ void bk_conn_param_update(uint16_t cMin, uint16_t cMax, uint16_t latency, uint16
 }
 
 /*********************************************************
-FN: Ͽ
+FN: 断开连接
 */
 void bk_disconnect(void)
 {
@@ -33,6 +33,7 @@ extern "C"
 //
 #include "ke_timer.h"
 #include "co_utils.h"
+#include "co_job.h"
 //
 #include "app.h"
 #include "app_task.h"
@@ -29,6 +29,9 @@ extern "C"
 /*********************************************************************
  * CONSTANTS
  */
+#define BK_FLASH_APP_IMAGE_ADDR    0x20010 //running app, same layout as the ota file
+#define BK_FLASH_APP_END_ADDR      0x40000
+
 #define BK_FLASH_START_ADDR        0x44000
 #define BK_FLASH_END_ADDR          0x64000
 
@@ -32,7 +32,7 @@ static void bk_timer_app_handler(uint32_t timer_id);
 /*********************************************************  bk_timer  *********************************************************/
 
 /*********************************************************
-FN: ʱ
+FN: 超时处理
 */
 void bk_timer_handler(ke_msg_id_t timer_id)
 {
@@ -44,7 +44,7 @@ void bk_timer_handler(ke_msg_id_t timer_id)
 }
 
 /*********************************************************
-FN: 
+FN: 启动
 */
 void bk_timer_start_0(ke_msg_id_t const timer_id, uint32_t ms, uint32_t count)
 {
@@ -61,7 +61,7 @@ void bk_timer_start_0(ke_msg_id_t const timer_id, uint32_t ms, uint32_t count)
 }
 
 /*********************************************************
-FN: 
+FN: 继续
 */
 static void bk_timer_continue(ke_msg_id_t const timer_id)
 {
@@ -72,7 +72,7 @@ static void bk_timer_continue(ke_msg_id_t const timer_id)
     
     uint32_t idx = timer_id-BK_TIMER0;
     
-    //
+    //周期性
     if((s_bk_timer[idx].count != BK_TIMER_COUNT_ENDLESS) && (s_bk_timer[idx].count > 0))
     {
         s_bk_timer[idx].count--;
@@ -85,7 +85,7 @@ static void bk_timer_continue(ke_msg_id_t const timer_id)
 }
 
 /*********************************************************
-FN: ֹͣ
+FN: 停止
 */
 void bk_timer_stop_0(ke_msg_id_t const timer_id)
 {
@@ -102,7 +102,7 @@ void bk_timer_stop_0(ke_msg_id_t const timer_id)
 }
 
 /*********************************************************
-FN: Ƿ
+FN: 是否运行
 */
 uint8_t bk_timer_is_running(ke_msg_id_t const timer_id)
 {
@@ -276,7 +276,7 @@ static uint32_t s_app_timestamp_when_update = 0;
 
 
 /*********************************************************
-FN: ʱ
+FN: 启动本地时间戳
 */
 void bk_rtc_handler(void)
 {
@@ -285,7 +285,7 @@ void bk_rtc_handler(void)
 }
 
 /*********************************************************
-FN: ʱ
+FN: 启动本地时间戳
 */
 static void bk_rtc_start(void)
 {
@@ -294,8 +294,8 @@ static void bk_rtc_start(void)
 //	PWM_DRV_DESC pwm;
 //    memset(&pwm, 0, sizeof(PWM_DRV_DESC));
 //	pwm.channel = 0x00;
-//	pwm.mode = 0x06; //ע
-//	pwm.end_value = (uint16_t)(32.768*1000); //ʱʱ
+//	pwm.mode = 0x06; //看注释
+//	pwm.end_value = (uint16_t)(32.768*1000); //定时时间
 //	pwm.duty_cycle = 0;
 //    pwm.p_Int_Handler = bk_rtc_handler;
 //	pwm_init(&pwm);
@@ -304,7 +304,7 @@ static void bk_rtc_start(void)
 }
 
 /*********************************************************
-FN: ʱ
+FN: 启动本地时间戳
 */
 void bk_local_timer_start(void)
 {
@@ -312,7 +312,7 @@ void bk_local_timer_start(void)
 }
 
 /*********************************************************
-FN: ʱ
+FN: 更新时间戳
 */
 void bk_update_timestamp(uint32_t app_timestamp)
 {
@@ -321,7 +321,7 @@ void bk_update_timestamp(uint32_t app_timestamp)
 }
 
 /*********************************************************
-FN: ȡʱappʱ
+FN: 获取更新时的app时间戳
 */
 uint32_t bk_get_app_timestamp_when_update(void)
 {
@@ -329,7 +329,7 @@ uint32_t bk_get_app_timestamp_when_update(void)
 }
 
 /*********************************************************
-FN: ȡʱ
+FN: 获取本地时间戳
 */
 uint32_t bk_get_local_timestamp(void)
 {
@@ -337,7 +337,7 @@ uint32_t bk_get_local_timestamp(void)
 }
 
 /*********************************************************
-FN: ȡǰʱûи¹Ϊʱ
+FN: 获取当前时间戳（如果没有更新过，即为本地时间戳）
 */
 uint32_t bk_get_timestamp(void)
 {
@@ -345,7 +345,7 @@ uint32_t bk_get_timestamp(void)
 }
 
 /*********************************************************
-FN: ȡȥʱڸʱ֮ʹã򷵻 old_local_timestamp
+FN: 获取过去的时间戳（必须在更新时间戳之后使用，否则返回 old_local_timestamp）
 */
 uint32_t bk_get_old_timestamp(uint32_t old_local_timestamp)
 {
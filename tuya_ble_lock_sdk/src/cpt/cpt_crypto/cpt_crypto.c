@@ -0,0 +1,235 @@
+#include <string.h>
+#include "cpt_crypto.h"
+
+
+
+
+/*********************************************************************
+ * LOCAL CONSTANTS
+ */
+#define CPT_CMAC_RB     0x87    //R_128, RFC 4493
+
+/*********************************************************************
+ * LOCAL STRUCT
+ */
+
+/*********************************************************************
+ * LOCAL VARIABLES
+ */
+
+/*********************************************************************
+ * LOCAL FUNCTION
+ */
+static void cpt_cmac_double(uint8_t block[16]);
+
+/*********************************************************************
+ * VARIABLES
+ */
+
+
+
+
+/*********************************************************
+FN: zeroize that the compiler is not allowed to drop
+*/
+void cpt_crypto_zeroize(void *buf, uint32_t size)
+{
+    volatile uint8_t *p = buf;
+    while(size--)
+    {
+        *p++ = 0;
+    }
+}
+
+/*********************************************************
+FN:
+*/
+void cpt_aes_init(cpt_aes_ctx_t *ctx)
+{
+    mbedtls_aes_init(ctx);
+}
+
+/*********************************************************
+FN: free and zeroize the key schedule
+*/
+void cpt_aes_free(cpt_aes_ctx_t *ctx)
+{
+    mbedtls_aes_free(ctx);
+}
+
+/*********************************************************
+FN:
+*/
+int cpt_aes_setkey_enc(cpt_aes_ctx_t *ctx, const uint8_t *key, uint32_t key_bits)
+{
+    return mbedtls_aes_setkey_enc(ctx, key, key_bits);
+}
+
+/*********************************************************
+FN:
+*/
+int cpt_aes_setkey_dec(cpt_aes_ctx_t *ctx, const uint8_t *key, uint32_t key_bits)
+{
+    return mbedtls_aes_setkey_dec(ctx, key, key_bits);
+}
+
+/*********************************************************
+FN: one block, in and out may overlap
+*/
+int cpt_aes_crypt_ecb(cpt_aes_ctx_t *ctx, int mode, const uint8_t in[16], uint8_t out[16])
+{
+    return mbedtls_aes_crypt_ecb(ctx, (mode == CPT_AES_ENCRYPT) ? MBEDTLS_AES_ENCRYPT : MBEDTLS_AES_DECRYPT, in, out);
+}
+
+/*********************************************************
+FN: size % 16 == 0, iv is updated for chaining
+*/
+int cpt_aes_crypt_cbc(cpt_aes_ctx_t *ctx, int mode, uint32_t size, uint8_t iv[16], const uint8_t *in, uint8_t *out)
+{
+    return mbedtls_aes_crypt_cbc(ctx, (mode == CPT_AES_ENCRYPT) ? MBEDTLS_AES_ENCRYPT : MBEDTLS_AES_DECRYPT, size, iv, in, out);
+}
+
+/*********************************************************
+FN: left shift by one bit in GF(2^128)
+*/
+static void cpt_cmac_double(uint8_t block[16])
+{
+    uint8_t msb = block[0] & 0x80;
+    uint8_t i;
+
+    for(i=0; i<15; i++)
+    {
+        block[i] = (block[i] << 1) | (block[i+1] >> 7);
+    }
+    block[15] = (block[15] << 1) ^ (msb ? CPT_CMAC_RB : 0);
+}
+
+/*********************************************************
+FN: AES-128-CMAC (RFC 4493)
+*/
+int cpt_aes128_cmac(const uint8_t key[16], const uint8_t *buf, uint32_t size, uint8_t mac[16])
+{
+    cpt_aes_ctx_t ctx;
+    uint8_t subkey[16];
+    uint8_t last[16];
+    uint32_t full;
+    uint32_t i;
+    int ret;
+
+    cpt_aes_init(&ctx);
+    ret = cpt_aes_setkey_enc(&ctx, key, 128);
+    if(ret != 0)
+    {
+        cpt_aes_free(&ctx);
+        return ret;
+    }
+
+    //K1 = dbl(E(K, 0)), K2 = dbl(K1)
+    memset(subkey, 0x00, sizeof(subkey));
+    cpt_aes_crypt_ecb(&ctx, CPT_AES_ENCRYPT, subkey, subkey);
+    cpt_cmac_double(subkey);
+
+    //all blocks but the last go straight through CBC-MAC
+    full = (size == 0) ? 0 : ((size - 1) / 16);
+    memset(mac, 0x00, 16);
+    for(; full > 0; full--)
+    {
+        for(i=0; i<16; i++)
+        {
+            mac[i] ^= *buf++;
+        }
+        cpt_aes_crypt_ecb(&ctx, CPT_AES_ENCRYPT, mac, mac);
+        size -= 16;
+    }
+
+    //last block: complete -> xor K1, partial -> pad 10..0 and xor K2
+    memset(last, 0x00, sizeof(last));
+    memcpy(last, buf, size);
+    if(size < 16)
+    {
+        last[size] = 0x80;
+        cpt_cmac_double(subkey);
+    }
+    for(i=0; i<16; i++)
+    {
+        mac[i] ^= last[i] ^ subkey[i];
+    }
+    cpt_aes_crypt_ecb(&ctx, CPT_AES_ENCRYPT, mac, mac);
+
+    cpt_crypto_zeroize(subkey, sizeof(subkey));
+    cpt_crypto_zeroize(last, sizeof(last));
+    cpt_aes_free(&ctx);
+    return 0;
+}
+
+/*********************************************************
+FN:
+*/
+int cpt_md5(const uint8_t *buf, uint32_t size, uint8_t digest[CPT_MD5_LEN])
+{
+    return mbedtls_md5_ret(buf, size, digest);
+}
+
+/*********************************************************
+FN:
+*/
+void cpt_md5_init(cpt_md5_ctx_t *ctx)
+{
+    mbedtls_md5_init(ctx);
+}
+
+/*********************************************************
+FN: zeroize the intermediate state
+*/
+void cpt_md5_free(cpt_md5_ctx_t *ctx)
+{
+    mbedtls_md5_free(ctx);
+}
+
+/*********************************************************
+FN:
+*/
+int cpt_md5_starts(cpt_md5_ctx_t *ctx)
+{
+    return mbedtls_md5_starts_ret(ctx);
+}
+
+/*********************************************************
+FN: any split of the input gives the same digest
+*/
+int cpt_md5_update(cpt_md5_ctx_t *ctx, const uint8_t *buf, uint32_t size)
+{
+    return mbedtls_md5_update_ret(ctx, buf, size);
+}
+
+/*********************************************************
+FN:
+*/
+int cpt_md5_finish(cpt_md5_ctx_t *ctx, uint8_t digest[CPT_MD5_LEN])
+{
+    return mbedtls_md5_finish_ret(ctx, digest);
+}
+
+/*********************************************************
+FN:
+*/
+int cpt_sha1(const uint8_t *buf, uint32_t size, uint8_t digest[CPT_SHA1_LEN])
+{
+    return SHA1(buf, size, digest);
+}
+
+/*********************************************************
+FN: ipad/opad midstates of key, reused by cpt_hmac_sha1_finish()
+*/
+void cpt_hmac_sha1_precompute(cpt_hmac_sha1_ctx_t *ctx, const uint8_t *key, uint32_t key_len)
+{
+    HMAC_SHA1_Precompute(ctx, (uint8_t *)key, key_len);
+}
+
+/*********************************************************
+FN:
+*/
+void cpt_hmac_sha1_finish(const cpt_hmac_sha1_ctx_t *ctx, const uint8_t *buf, uint32_t size, uint8_t digest[CPT_SHA1_LEN])
+{
+    HMAC_SHA1_Finish(ctx, (uint8_t *)buf, size, digest);
+}
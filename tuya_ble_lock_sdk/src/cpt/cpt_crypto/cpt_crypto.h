@@ -0,0 +1,102 @@
+/**
+****************************************************************************
+* @file      cpt_crypto.h
+* @brief     cpt_crypto, the one crypto provider used by port, fpe, dynamic pwd and ota
+* @author    suding
+* @version   V1.0.0
+* @date      2020-05-11
+* @note
+******************************************************************************
+* @attention
+*
+* <h2><center>&copy; COPYRIGHT 2020 Tuya </center></h2>
+*/
+
+
+#ifndef __CPT_CRYPTO_H__
+#define __CPT_CRYPTO_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*********************************************************************
+ * INCLUDES
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include "cpt_math.h"   //crc16/crc32
+#include "hmac-sha1.h"  //sha1/hmac-sha1 backend, always built in
+
+/*********************************************************************
+ * CONSTANTS
+ */
+//AES/MD5 backend, selected at build time
+#define CPT_CRYPTO_BACKEND_MBEDTLS      1   //cpt/mbedtls-2.16.1
+
+#ifndef CPT_CRYPTO_BACKEND
+#define CPT_CRYPTO_BACKEND              CPT_CRYPTO_BACKEND_MBEDTLS
+#endif
+
+#if (CPT_CRYPTO_BACKEND == CPT_CRYPTO_BACKEND_MBEDTLS)
+#include "mbedtls/aes.h"
+#include "mbedtls/md5.h"
+#else
+#error "cpt_crypto: unknown CPT_CRYPTO_BACKEND"
+#endif
+
+#define CPT_AES_ENCRYPT                 1
+#define CPT_AES_DECRYPT                 0
+#define CPT_AES_BLOCK_LEN               16
+#define CPT_MD5_LEN                     16
+#define CPT_SHA1_LEN                    20
+
+/*********************************************************************
+ * STRUCT
+ */
+#if (CPT_CRYPTO_BACKEND == CPT_CRYPTO_BACKEND_MBEDTLS)
+typedef mbedtls_aes_context cpt_aes_ctx_t;
+typedef mbedtls_md5_context cpt_md5_ctx_t;
+#endif
+
+typedef HMAC_SHA1Context cpt_hmac_sha1_ctx_t;
+
+/*********************************************************************
+ * EXTERNAL VARIABLES
+ */
+
+/*********************************************************************
+ * EXTERNAL FUNCTIONS
+ */
+void cpt_crypto_zeroize(void *buf, uint32_t size);
+
+//AES, key_bits = 128/192/256; a ctx is expanded once and may be reused for many blocks
+void cpt_aes_init(cpt_aes_ctx_t *ctx);
+void cpt_aes_free(cpt_aes_ctx_t *ctx);
+int cpt_aes_setkey_enc(cpt_aes_ctx_t *ctx, const uint8_t *key, uint32_t key_bits);
+int cpt_aes_setkey_dec(cpt_aes_ctx_t *ctx, const uint8_t *key, uint32_t key_bits);
+int cpt_aes_crypt_ecb(cpt_aes_ctx_t *ctx, int mode, const uint8_t in[16], uint8_t out[16]);
+int cpt_aes_crypt_cbc(cpt_aes_ctx_t *ctx, int mode, uint32_t size, uint8_t iv[16], const uint8_t *in, uint8_t *out);
+int cpt_aes128_cmac(const uint8_t key[16], const uint8_t *buf, uint32_t size, uint8_t mac[16]);
+
+//hash
+int cpt_md5(const uint8_t *buf, uint32_t size, uint8_t digest[CPT_MD5_LEN]);
+//streaming md5: init -> starts -> update ... -> finish -> free
+void cpt_md5_init(cpt_md5_ctx_t *ctx);
+void cpt_md5_free(cpt_md5_ctx_t *ctx);
+int cpt_md5_starts(cpt_md5_ctx_t *ctx);
+int cpt_md5_update(cpt_md5_ctx_t *ctx, const uint8_t *buf, uint32_t size);
+int cpt_md5_finish(cpt_md5_ctx_t *ctx, uint8_t digest[CPT_MD5_LEN]);
+int cpt_sha1(const uint8_t *buf, uint32_t size, uint8_t digest[CPT_SHA1_LEN]);
+void cpt_hmac_sha1_precompute(cpt_hmac_sha1_ctx_t *ctx, const uint8_t *key, uint32_t key_len);
+void cpt_hmac_sha1_finish(const cpt_hmac_sha1_ctx_t *ctx, const uint8_t *buf, uint32_t size, uint8_t digest[CPT_SHA1_LEN]);
+
+//crc: cpt_crc16_compute() / cpt_crc32_compute(), see cpt_math.h
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //__CPT_CRYPTO_H__
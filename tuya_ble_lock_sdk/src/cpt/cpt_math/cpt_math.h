@@ -29,6 +29,15 @@ extern "C"
 /*********************************************************************
  * CONSTANTS
  */
+//CRC 查表方式: NIBBLE - 4bit 表(CRC16 32B + CRC32 64B), BYTE - 8bit 表(512B + 1KB),
+//SLICE4 - CRC32 每次 4 字节(4KB), 用于主机工具
+#define CPT_CRC_TABLE_NIBBLE   1
+#define CPT_CRC_TABLE_BYTE     2
+#define CPT_CRC_TABLE_SLICE4   3
+
+#ifndef CPT_CRC_TABLE
+#define CPT_CRC_TABLE          CPT_CRC_TABLE_BYTE
+#endif
 
 /*********************************************************************
  * STRUCT
@@ -2,6 +2,7 @@
 #include "fpe_math.h"
 #include "fpe_cipher.h"
 #include <stdio.h>
+#include <string.h>
 
 uint32_t calcb(uint32_t v) {
     //  int b = ceil(ceil(v * log2(ctx.radix)) / 8.0);
@@ -101,3 +102,53 @@ num_str decrypt(byte_str key, byte_str tweak, num_str cipher, ff1_context ctx) {
     FPE_PRINT_STR(ret, -1, "Result", ctx);
     return ret;
 }
+
+#define FF1_10_DIGITS_HALF 5
+#define FF1_10_DIGITS_MOD  100000u
+
+static uint32_t digits_to_u32(const uint8_t *digits, uint32_t len) {
+    uint32_t x = 0;
+    for (uint32_t i = 0; i < len; i++) {
+        x = x * FPE_RADIX + digits[i];
+    }
+    return x;
+}
+
+static void u32_to_digits(uint32_t x, uint8_t *digits, uint32_t len) {
+    for (uint32_t i = 1; i <= len; i++) {
+        digits[len - i] = (uint8_t) (x % FPE_RADIX);
+        x /= FPE_RADIX;
+    }
+}
+
+int ff1_decrypt_10_digits(prf_key_handle *key, const uint8_t *cipher, uint8_t *plain) {
+    // n = 10, u = v = 5, t = 0  =>  b = 3, d = 8
+    // P || Q, Q = [0]*12 || [i] || NUM(A) as 3 bytes
+    uint8_t blocks[32] = {0x01, 0x02, 0x01, 0x00, 0x00, FPE_RADIX, 0x0a, FF1_10_DIGITS_HALF,
+                          0x00, 0x00, 0x00, FF1_10_DIGITS_LEN, 0x00, 0x00, 0x00, 0x00};
+    if (!key->loaded || (key->key_len != 16 && key->key_len != 24 && key->key_len != 32)) {
+        return INVALID_KEY_LENGTH;
+    }
+    uint32_t num_A = digits_to_u32(cipher, FF1_10_DIGITS_HALF);
+    uint32_t num_B = digits_to_u32(cipher + FF1_10_DIGITS_HALF, FF1_10_DIGITS_HALF);
+    for (int i = 9; i >= 0; i--) {
+        blocks[28] = (uint8_t) i;
+        blocks[29] = (uint8_t) (num_A >> 16);
+        blocks[30] = (uint8_t) (num_A >> 8);
+        blocks[31] = (uint8_t) num_A;
+        prf_with_handle(key, blocks, sizeof(blocks));
+        // y = NUM(S), S = R[0..d), only y mod radix^m is needed
+        uint64_t y = 0;
+        for (int j = 0; j < 8; j++) {
+            y = (y << 8) | key->mac[j];
+        }
+        uint32_t c = (num_B + FF1_10_DIGITS_MOD - (uint32_t) (y % FF1_10_DIGITS_MOD)) % FF1_10_DIGITS_MOD;
+        num_B = num_A;
+        num_A = c;
+    }
+    u32_to_digits(num_A, plain, FF1_10_DIGITS_HALF);
+    u32_to_digits(num_B, plain + FF1_10_DIGITS_HALF, FF1_10_DIGITS_HALF);
+    memset(blocks, 0x00, sizeof(blocks));
+    memset(key->mac, 0x00, sizeof(key->mac));
+    return OK;
+}
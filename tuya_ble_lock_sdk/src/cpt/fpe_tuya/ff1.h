@@ -4,6 +4,7 @@
 #include <stdlib.h>
 #include "fpe_str.h"
 #include "ff1_common.h"
+#include "fpe_cipher.h"
 
 #define INPUT_MIN_LENGTH 2
 #define INPUT_MAX_LENGTH 18
@@ -17,5 +18,11 @@
 
 num_str decrypt(byte_str key, byte_str tweak, num_str cipher, ff1_context ctx);
 
+#define FF1_10_DIGITS_LEN 10
+
+// decrypt() specialized for radix 10, 10 digits, empty tweak: no heap, plain has FF1_10_DIGITS_LEN digits
+// key must be loaded with prf_key_load() (16, 24 or 32 bytes)
+int ff1_decrypt_10_digits(prf_key_handle *key, const uint8_t *cipher, uint8_t *plain);
+
 #endif //FPE_FF1_H
 
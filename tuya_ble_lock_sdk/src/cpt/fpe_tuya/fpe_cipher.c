@@ -5,32 +5,15 @@
 #include <string.h>
 #include "fpe_cipher.h"
 #include "fpe_str.h"
-#include "mbedtls/aes.h"
+#include "cpt_crypto.h"
 #if defined (USED_STDLIB_MEMALLOC)
 #include <stdlib.h>
 #else 
 #include "tuya_ble_heap.h"
 #endif 
 
-#if 0
 byte_str prf(byte_str key, byte_str blocks) {
-    mbedcrypto_aes_context ctx;
-    mbedcrypto_aes_init(&ctx);
-    mbedcrypto_aes_setkey_enc(&ctx, key.buf, key.len * 8);
-    uint8_t *output = calloc(blocks.len, 1);
-    uint8_t iv[16] = {0};
-    mbedcrypto_aes_crypt_cbc(&ctx, MBEDCRYPTO_AES_ENCRYPT, blocks.len, iv, blocks.buf, output);
-    mbedcrypto_aes_free(&ctx);
-    uint8_t *ret_buf = calloc(16, 1);
-    memcpy(ret_buf, output + (blocks.len - 16), 16);
-    free(output);
-    byte_str ret = {.buf=ret_buf, .len=16};
-    return ret;
-}
-#endif 
-
-byte_str prf(byte_str key, byte_str blocks) {
-	mbedtls_aes_context aes_ctx;
+	cpt_aes_ctx_t aes_ctx;
 	uint8_t iv[16] = {0};
 #if defined (USED_STDLIB_MEMALLOC)	
 	uint8_t *output = calloc(blocks.len, 1);
@@ -39,10 +22,10 @@ byte_str prf(byte_str key, byte_str blocks) {
 	memset(output, 0x00, blocks.len*1);
 #endif 
 	
-    mbedtls_aes_init(&aes_ctx);
-    mbedtls_aes_setkey_enc(&aes_ctx, key.buf, key.len * 8);
-    mbedtls_aes_crypt_cbc(&aes_ctx, MBEDTLS_AES_ENCRYPT, blocks.len, iv, blocks.buf, output);
-	mbedtls_aes_free(&aes_ctx);
+    cpt_aes_init(&aes_ctx);
+    cpt_aes_setkey_enc(&aes_ctx, key.buf, key.len * 8);
+    cpt_aes_crypt_cbc(&aes_ctx, CPT_AES_ENCRYPT, blocks.len, iv, blocks.buf, output);
+	cpt_aes_free(&aes_ctx);
 	
 #if defined (USED_STDLIB_MEMALLOC)	
 	uint8_t *ret_buf = calloc(16, 1);
@@ -61,3 +44,39 @@ byte_str prf(byte_str key, byte_str blocks) {
     byte_str ret = {.buf=ret_buf, .len=16};
 	return ret;
 }
+
+int prf_key_load(prf_key_handle *handle, const uint8_t *key, uint32_t key_len) {
+    if (key_len > PRF_KEY_MAX_LEN) {
+        return -1;
+    }
+    if (handle->loaded && handle->key_len == key_len && memcmp(handle->key, key, key_len) == 0) {
+        return 0;
+    }
+    prf_key_wipe(handle);
+    cpt_aes_init(&handle->aes);
+    if (cpt_aes_setkey_enc(&handle->aes, key, key_len * 8) != 0) {
+        prf_key_wipe(handle);
+        return -1;
+    }
+    memcpy(handle->key, key, key_len);
+    handle->key_len = key_len;
+    handle->loaded = true;
+    return 0;
+}
+
+void prf_key_wipe(prf_key_handle *handle) {
+    if (handle->loaded) {
+        cpt_aes_free(&handle->aes);
+    }
+    cpt_crypto_zeroize(handle, sizeof(prf_key_handle));
+}
+
+void prf_with_handle(prf_key_handle *handle, const uint8_t *blocks, uint32_t len) {
+    memset(handle->mac, 0x00, PRF_BLOCK_LEN);
+    for (uint32_t offset = 0; offset < len; offset += PRF_BLOCK_LEN) {
+        for (int i = 0; i < PRF_BLOCK_LEN; i++) {
+            handle->mac[i] ^= blocks[offset + i];
+        }
+        cpt_aes_crypt_ecb(&handle->aes, CPT_AES_ENCRYPT, handle->mac, handle->mac);
+    }
+}
@@ -6,7 +6,29 @@
 #define FPE_CIPHER_H
 
 #include "fpe_str.h"
+#include "cpt_crypto.h"
+
+#define PRF_KEY_MAX_LEN 32
+#define PRF_BLOCK_LEN   16
+
+// pre-expanded AES encryption schedule plus CBC-MAC state, reused across prf calls
+typedef struct {
+    bool loaded;
+    uint8_t key[PRF_KEY_MAX_LEN];
+    uint32_t key_len;
+    cpt_aes_ctx_t aes;
+    uint8_t mac[PRF_BLOCK_LEN];
+} prf_key_handle;
 
 byte_str prf(byte_str key, byte_str blocks);
 
+// expand key into handle, skipped if the handle already holds the same key
+int prf_key_load(prf_key_handle *handle, const uint8_t *key, uint32_t key_len);
+
+// zeroize schedule, key copy and mac
+void prf_key_wipe(prf_key_handle *handle);
+
+// same as prf(), CBC-MAC of blocks (len % 16 == 0) left in handle->mac, no heap
+void prf_with_handle(prf_key_handle *handle, const uint8_t *blocks, uint32_t len);
+
 #endif //FPE_CIPHER_H
@@ -8,7 +8,24 @@
 #include "fpe_str.h"
 #include "elog.h"
 
+// expanded offline password key, derived from login_key, reused across keypad attempts
+static prf_key_handle s_fpe_key;
+
+void fpe_decrypt_key_wipe(void) {
+    prf_key_wipe(&s_fpe_key);
+}
+
 int fpe_decrypt(uint8_t *input_key, uint8_t key_len, uint8_t *input_cipher, uint16_t cipher_len, uint8_t *output, uint8_t *output_len) {
+    // offline password, fixed size fast path
+    if (cipher_len == FF1_10_DIGITS_LEN) {
+        if (prf_key_load(&s_fpe_key, input_key, key_len) != 0
+            || ff1_decrypt_10_digits(&s_fpe_key, input_cipher, output) != OK) {
+            return -1;
+        }
+        *output_len = FF1_10_DIGITS_LEN;
+        return 0;
+    }
+
     byte_str key = {.buf=input_key, .len=key_len};
     byte_str tweak = create_byte_str("", 0);
     num_str cipher = {.buf=input_cipher, .len=cipher_len};
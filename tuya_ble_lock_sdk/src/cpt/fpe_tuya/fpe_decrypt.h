@@ -8,6 +8,8 @@ extern "C" {
 #endif
 
 int fpe_decrypt(uint8_t *input_key, uint8_t key_len, uint8_t *input_cipher, uint16_t cipher_len, uint8_t *output, uint8_t *output_len);
+
+void fpe_decrypt_key_wipe(void);
 	
 #ifdef __cplusplus
 }
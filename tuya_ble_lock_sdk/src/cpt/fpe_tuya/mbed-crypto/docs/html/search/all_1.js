@@ -1,4 +0,0 @@
-var searchData=
-[
-  ['basic_20definitions',['Basic definitions',['../group__basic.html',1,'']]]
-];
@@ -1,5 +0,0 @@
-var searchData=
-[
-  ['crypto_2eh',['crypto.h',['../crypto_8h.html',1,'']]],
-  ['crypto_5fsizes_2eh',['crypto_sizes.h',['../crypto__sizes_8h.html',1,'']]]
-];
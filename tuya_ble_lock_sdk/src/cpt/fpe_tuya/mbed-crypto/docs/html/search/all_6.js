@@ -1,8 +0,0 @@
-var searchData=
-[
-  ['key_20and_20algorithm_20types',['Key and algorithm types',['../group__crypto__types.html',1,'']]],
-  ['key_20derivation',['Key derivation',['../group__derivation.html',1,'']]],
-  ['key_20management',['Key management',['../group__key__management.html',1,'']]],
-  ['key_20lifetime',['Key lifetime',['../group__persistence.html',1,'']]],
-  ['key_20policies',['Key policies',['../group__policy.html',1,'']]]
-];
@@ -1,4 +0,0 @@
-var searchData=
-[
-  ['random_20generation',['Random generation',['../group__random.html',1,'']]]
-];
@@ -1,4 +0,0 @@
-var searchData=
-[
-  ['symmetric_20ciphers',['Symmetric ciphers',['../group__cipher.html',1,'']]]
-];
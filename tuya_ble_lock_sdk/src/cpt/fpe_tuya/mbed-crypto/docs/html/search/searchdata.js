@@ -1,36 +0,0 @@
-var indexSectionsWithContent =
-{
-  0: "abcegikmprs",
-  1: "p",
-  2: "c",
-  3: "p",
-  4: "e",
-  5: "p",
-  6: "p",
-  7: "abgikmrs"
-};
-
-var indexSectionNames =
-{
-  0: "all",
-  1: "classes",
-  2: "files",
-  3: "functions",
-  4: "variables",
-  5: "typedefs",
-  6: "defines",
-  7: "groups"
-};
-
-var indexSectionLabels =
-{
-  0: "All",
-  1: "Classes",
-  2: "Files",
-  3: "Functions",
-  4: "Variables",
-  5: "Typedefs",
-  6: "Macros",
-  7: "Modules"
-};
-
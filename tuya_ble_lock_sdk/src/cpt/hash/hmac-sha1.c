@@ -3,7 +3,7 @@
 #include "sha1.h"
 #include "hmac-sha1.h"
 
-void HMAC_SHA1(uint8_t *key, unsigned int key_len, uint8_t *message, unsigned int msg_len, uint8_t *digest)
+void HMAC_SHA1_Precompute(HMAC_SHA1Context *ctx, uint8_t *key, unsigned int key_len)
 {
 	uint8_t ipad[HMAC_BLOCK_SIZE];
 	uint8_t opad[HMAC_BLOCK_SIZE];
@@ -29,16 +29,40 @@ void HMAC_SHA1(uint8_t *key, unsigned int key_len, uint8_t *message, unsigned in
 		opad[i] ^= 0x5c;
 	}
 
-	// Inner SHA1
+	// one full block each, keep only the chaining value
 	SHA1Context sha;
 	SHA1Reset(&sha);
 	SHA1Input(&sha, ipad, HMAC_BLOCK_SIZE);
+	SHA1GetMidstate(&sha, ctx->inner);
+	SHA1Reset(&sha);
+	SHA1Input(&sha, opad, HMAC_BLOCK_SIZE);
+	SHA1GetMidstate(&sha, ctx->outer);
+	memset(&sha, 0, sizeof(sha));
+
+	memset(ipad, 0, HMAC_BLOCK_SIZE);
+	memset(opad, 0, HMAC_BLOCK_SIZE);
+	memset(tk, 0, SHA1HashSize);
+}
+
+void HMAC_SHA1_Finish(const HMAC_SHA1Context *ctx, uint8_t *message, unsigned int msg_len, uint8_t *digest)
+{
+	SHA1Context sha;
+
+	// Inner SHA1
+	SHA1SetMidstate(&sha, ctx->inner, 1);
 	SHA1Input(&sha, message, msg_len);
 	SHA1Result(&sha, digest);
 
 	// Outer SHA1
-	SHA1Reset(&sha);
-	SHA1Input(&sha, opad, HMAC_BLOCK_SIZE);
+	SHA1SetMidstate(&sha, ctx->outer, 1);
 	SHA1Input(&sha, digest, SHA1HashSize);
 	SHA1Result(&sha, digest);
 }
+
+void HMAC_SHA1(uint8_t *key, unsigned int key_len, uint8_t *message, unsigned int msg_len, uint8_t *digest)
+{
+	HMAC_SHA1Context ctx;
+
+	HMAC_SHA1_Precompute(&ctx, key, key_len);
+	HMAC_SHA1_Finish(&ctx, message, msg_len, digest);
+}
@@ -6,11 +6,25 @@ extern "C" {
 #endif
     
 #include <stdint.h>
+#include "sha1.h"
     
 #define HMAC_BLOCK_SIZE 		( 64 )
+
+/*
+*  SHA1 states after absorbing (key XOR ipad) and (key XOR opad),
+*  computed once per key and reused for every message
+*/
+typedef struct
+{
+	uint32_t inner[SHA1HashSize / 4];
+	uint32_t outer[SHA1HashSize / 4];
+} HMAC_SHA1Context;
     
 void HMAC_SHA1(uint8_t *key, unsigned int key_len, uint8_t *message, unsigned int msg_len, uint8_t *digest);
 
+void HMAC_SHA1_Precompute(HMAC_SHA1Context *ctx, uint8_t *key, unsigned int key_len);
+void HMAC_SHA1_Finish(const HMAC_SHA1Context *ctx, uint8_t *message, unsigned int msg_len, uint8_t *digest);
+
 #ifdef __cplusplus
 }
 #endif
@@ -29,6 +29,7 @@
  *
  */
 
+#include <string.h>
 #include "sha1.h"
 
 /*
@@ -37,9 +38,29 @@
 #define SHA1CircularShift(bits,word) \
                 (((word) << (bits)) | ((word) >> (32-(bits))))
 
+/*
+ *  Compression function: 16-word rolling message window, rounds fully
+ *  unrolled. Define SHA1_COMPACT to trade speed for code size.
+ */
+#define SHA1_LOAD(i)        (W[i] = ((uint32_t)block[(i) * 4] << 24) | ((uint32_t)block[(i) * 4 + 1] << 16) \
+                                  | ((uint32_t)block[(i) * 4 + 2] << 8) | ((uint32_t)block[(i) * 4 + 3]))
+#define SHA1_BLK(i)         (W[(i) & 15] = SHA1CircularShift(1, W[((i) + 13) & 15] ^ W[((i) + 8) & 15] \
+                                                              ^ W[((i) + 2) & 15] ^ W[(i) & 15]))
+
+#define SHA1_F0(b,c,d)      ((((c) ^ (d)) & (b)) ^ (d))
+#define SHA1_F1(b,c,d)      ((b) ^ (c) ^ (d))
+#define SHA1_F2(b,c,d)      (((b) & (c)) | (((b) | (c)) & (d)))
+
+#define SHA1_R0(a,b,c,d,e,i) e += SHA1_F0(b,c,d) + SHA1_LOAD(i) + 0x5A827999 + SHA1CircularShift(5, a); b = SHA1CircularShift(30, b);
+#define SHA1_R1(a,b,c,d,e,i) e += SHA1_F0(b,c,d) + SHA1_BLK(i)  + 0x5A827999 + SHA1CircularShift(5, a); b = SHA1CircularShift(30, b);
+#define SHA1_R2(a,b,c,d,e,i) e += SHA1_F1(b,c,d) + SHA1_BLK(i)  + 0x6ED9EBA1 + SHA1CircularShift(5, a); b = SHA1CircularShift(30, b);
+#define SHA1_R3(a,b,c,d,e,i) e += SHA1_F2(b,c,d) + SHA1_BLK(i)  + 0x8F1BBCDC + SHA1CircularShift(5, a); b = SHA1CircularShift(30, b);
+#define SHA1_R4(a,b,c,d,e,i) e += SHA1_F1(b,c,d) + SHA1_BLK(i)  + 0xCA62C1D6 + SHA1CircularShift(5, a); b = SHA1CircularShift(30, b);
+
 /* Local Function Prototyptes */
 void SHA1PadMessage(SHA1Context *);
 void SHA1ProcessMessageBlock(SHA1Context *);
+static void SHA1Compress(uint32_t H[SHA1HashSize / 4], const uint8_t *block);
 
 /*
  *  SHA1Reset
@@ -178,33 +199,110 @@ int SHA1Input(SHA1Context    *context,
 	{
 		return context->Corrupted;
 	}
-	while (length-- && !context->Corrupted)
+
+	/* bit length, updated once per call */
+	uint32_t low = context->Length_Low + (length << 3);
+	uint32_t high = context->Length_High + (length >> 29) + (low < context->Length_Low);
+	if (high < context->Length_High)
 	{
-		context->Message_Block[context->Message_Block_Index++] =
-			(*message_array & 0xFF);
+		/* Message is too long */
+		context->Corrupted = 1;
+		return shaSuccess;
+	}
+	context->Length_Low = low;
+	context->Length_High = high;
 
-		context->Length_Low += 8;
-		if (context->Length_Low == 0)
+	/* top up a partial block first */
+	if (context->Message_Block_Index)
+	{
+		unsigned int fill = 64 - context->Message_Block_Index;
+		if (fill > length)
 		{
-			context->Length_High++;
-			if (context->Length_High == 0)
-			{
-				/* Message is too long */
-				context->Corrupted = 1;
-			}
+			fill = length;
 		}
+		memcpy(&context->Message_Block[context->Message_Block_Index], message_array, fill);
+		context->Message_Block_Index += fill;
+		message_array += fill;
+		length -= fill;
 
-		if (context->Message_Block_Index == 64)
+		if (context->Message_Block_Index < 64)
 		{
-			SHA1ProcessMessageBlock(context);
+			return shaSuccess;
 		}
+		SHA1ProcessMessageBlock(context);
+	}
+
+	/* whole blocks straight from the caller's buffer */
+	while (length >= 64)
+	{
+		SHA1Compress(context->Intermediate_Hash, message_array);
+		message_array += 64;
+		length -= 64;
+	}
 
-		message_array++;
+	if (length)
+	{
+		memcpy(context->Message_Block, message_array, length);
+		context->Message_Block_Index = length;
 	}
 
 	return shaSuccess;
 }
 
+/*
+ *  SHA1GetMidstate
+ *
+ *  Description:
+ *      Export the chaining value after a whole number of blocks, e.g.
+ *      the HMAC key pads, so it can be resumed with SHA1SetMidstate.
+ *
+ *  Returns:
+ *      sha Error Code, shaStateError if a partial block is buffered.
+ *
+ */
+int SHA1GetMidstate(const SHA1Context *context, uint32_t midstate[SHA1HashSize / 4])
+{
+	if (!context || !midstate)
+	{
+		return shaNull;
+	}
+
+	if (context->Computed || context->Corrupted || context->Message_Block_Index)
+	{
+		return shaStateError;
+	}
+
+	memcpy(midstate, context->Intermediate_Hash, SHA1HashSize);
+	return shaSuccess;
+}
+
+/*
+ *  SHA1SetMidstate
+ *
+ *  Description:
+ *      Start a context from an exported midstate that has already
+ *      absorbed block_count 64-byte blocks.
+ *
+ *  Returns:
+ *      sha Error Code.
+ *
+ */
+int SHA1SetMidstate(SHA1Context *context, const uint32_t midstate[SHA1HashSize / 4], uint32_t block_count)
+{
+	if (!context || !midstate)
+	{
+		return shaNull;
+	}
+
+	memcpy(context->Intermediate_Hash, midstate, SHA1HashSize);
+	context->Length_Low = block_count << 9;
+	context->Length_High = block_count >> 23;
+	context->Message_Block_Index = 0;
+	context->Computed = 0;
+	context->Corrupted = 0;
+	return shaSuccess;
+}
+
 /*
  *  SHA1ProcessMessageBlock
  *
@@ -227,88 +325,87 @@ int SHA1Input(SHA1Context    *context,
  */
 void SHA1ProcessMessageBlock(SHA1Context *context)
 {
-	const uint32_t K[] = {       /* Constants defined in SHA-1   */
-		0x5A827999,
-		0x6ED9EBA1,
-		0x8F1BBCDC,
-		0xCA62C1D6
-	};
-	int           t;                 /* Loop counter                */
-	uint32_t      temp;              /* Temporary word value        */
-	uint32_t      W[80];             /* Word sequence               */
-	uint32_t      A, B, C, D, E;     /* Word buffers                */
-
-	/*
-	 *  Initialize the first 16 words in the array W
-	 */
-	for (t = 0; t < 16; t++)
-	{
-		W[t] = context->Message_Block[t * 4] << 24;
-		W[t] |= context->Message_Block[t * 4 + 1] << 16;
-		W[t] |= context->Message_Block[t * 4 + 2] << 8;
-		W[t] |= context->Message_Block[t * 4 + 3];
-	}
-
-	for (t = 16; t < 80; t++)
-	{
-		W[t] = SHA1CircularShift(1, W[t - 3] ^ W[t - 8] ^ W[t - 14] ^ W[t - 16]);
-	}
+	SHA1Compress(context->Intermediate_Hash, context->Message_Block);
+	context->Message_Block_Index = 0;
+}
 
-	A = context->Intermediate_Hash[0];
-	B = context->Intermediate_Hash[1];
-	C = context->Intermediate_Hash[2];
-	D = context->Intermediate_Hash[3];
-	E = context->Intermediate_Hash[4];
+static void SHA1Compress(uint32_t H[SHA1HashSize / 4], const uint8_t *block)
+{
+	uint32_t      W[16];             /* Rolling word window         */
+	uint32_t      A, B, C, D, E;     /* Word buffers                */
 
-	for (t = 0; t < 20; t++)
+	A = H[0];
+	B = H[1];
+	C = H[2];
+	D = H[3];
+	E = H[4];
+
+#ifndef SHA1_COMPACT
+	SHA1_R0(A,B,C,D,E, 0); SHA1_R0(E,A,B,C,D, 1); SHA1_R0(D,E,A,B,C, 2); SHA1_R0(C,D,E,A,B, 3);
+	SHA1_R0(B,C,D,E,A, 4); SHA1_R0(A,B,C,D,E, 5); SHA1_R0(E,A,B,C,D, 6); SHA1_R0(D,E,A,B,C, 7);
+	SHA1_R0(C,D,E,A,B, 8); SHA1_R0(B,C,D,E,A, 9); SHA1_R0(A,B,C,D,E,10); SHA1_R0(E,A,B,C,D,11);
+	SHA1_R0(D,E,A,B,C,12); SHA1_R0(C,D,E,A,B,13); SHA1_R0(B,C,D,E,A,14); SHA1_R0(A,B,C,D,E,15);
+	SHA1_R1(E,A,B,C,D,16); SHA1_R1(D,E,A,B,C,17); SHA1_R1(C,D,E,A,B,18); SHA1_R1(B,C,D,E,A,19);
+	SHA1_R2(A,B,C,D,E,20); SHA1_R2(E,A,B,C,D,21); SHA1_R2(D,E,A,B,C,22); SHA1_R2(C,D,E,A,B,23);
+	SHA1_R2(B,C,D,E,A,24); SHA1_R2(A,B,C,D,E,25); SHA1_R2(E,A,B,C,D,26); SHA1_R2(D,E,A,B,C,27);
+	SHA1_R2(C,D,E,A,B,28); SHA1_R2(B,C,D,E,A,29); SHA1_R2(A,B,C,D,E,30); SHA1_R2(E,A,B,C,D,31);
+	SHA1_R2(D,E,A,B,C,32); SHA1_R2(C,D,E,A,B,33); SHA1_R2(B,C,D,E,A,34); SHA1_R2(A,B,C,D,E,35);
+	SHA1_R2(E,A,B,C,D,36); SHA1_R2(D,E,A,B,C,37); SHA1_R2(C,D,E,A,B,38); SHA1_R2(B,C,D,E,A,39);
+	SHA1_R3(A,B,C,D,E,40); SHA1_R3(E,A,B,C,D,41); SHA1_R3(D,E,A,B,C,42); SHA1_R3(C,D,E,A,B,43);
+	SHA1_R3(B,C,D,E,A,44); SHA1_R3(A,B,C,D,E,45); SHA1_R3(E,A,B,C,D,46); SHA1_R3(D,E,A,B,C,47);
+	SHA1_R3(C,D,E,A,B,48); SHA1_R3(B,C,D,E,A,49); SHA1_R3(A,B,C,D,E,50); SHA1_R3(E,A,B,C,D,51);
+	SHA1_R3(D,E,A,B,C,52); SHA1_R3(C,D,E,A,B,53); SHA1_R3(B,C,D,E,A,54); SHA1_R3(A,B,C,D,E,55);
+	SHA1_R3(E,A,B,C,D,56); SHA1_R3(D,E,A,B,C,57); SHA1_R3(C,D,E,A,B,58); SHA1_R3(B,C,D,E,A,59);
+	SHA1_R4(A,B,C,D,E,60); SHA1_R4(E,A,B,C,D,61); SHA1_R4(D,E,A,B,C,62); SHA1_R4(C,D,E,A,B,63);
+	SHA1_R4(B,C,D,E,A,64); SHA1_R4(A,B,C,D,E,65); SHA1_R4(E,A,B,C,D,66); SHA1_R4(D,E,A,B,C,67);
+	SHA1_R4(C,D,E,A,B,68); SHA1_R4(B,C,D,E,A,69); SHA1_R4(A,B,C,D,E,70); SHA1_R4(E,A,B,C,D,71);
+	SHA1_R4(D,E,A,B,C,72); SHA1_R4(C,D,E,A,B,73); SHA1_R4(B,C,D,E,A,74); SHA1_R4(A,B,C,D,E,75);
+	SHA1_R4(E,A,B,C,D,76); SHA1_R4(D,E,A,B,C,77); SHA1_R4(C,D,E,A,B,78); SHA1_R4(B,C,D,E,A,79);
+#else
+	for (int t = 0; t < 80; t++)
 	{
-		temp = SHA1CircularShift(5, A) +
-			((B & C) | ((~B) & D)) + E + W[t] + K[0];
-		E = D;
-		D = C;
-		C = SHA1CircularShift(30, B);
-		B = A;
-		A = temp;
-	}
+		uint32_t temp;
 
-	for (t = 20; t < 40; t++)
-	{
-		temp = SHA1CircularShift(5, A) + (B ^ C ^ D) + E + W[t] + K[1];
-		E = D;
-		D = C;
-		C = SHA1CircularShift(30, B);
-		B = A;
-		A = temp;
-	}
+		if (t < 16)
+		{
+			temp = SHA1_LOAD(t);
+		}
+		else
+		{
+			temp = SHA1_BLK(t);
+		}
 
-	for (t = 40; t < 60; t++)
-	{
-		temp = SHA1CircularShift(5, A) +
-			((B & C) | (B & D) | (C & D)) + E + W[t] + K[2];
-		E = D;
-		D = C;
-		C = SHA1CircularShift(30, B);
-		B = A;
-		A = temp;
-	}
+		if (t < 20)
+		{
+			temp += SHA1_F0(B, C, D) + 0x5A827999;
+		}
+		else if (t < 40)
+		{
+			temp += SHA1_F1(B, C, D) + 0x6ED9EBA1;
+		}
+		else if (t < 60)
+		{
+			temp += SHA1_F2(B, C, D) + 0x8F1BBCDC;
+		}
+		else
+		{
+			temp += SHA1_F1(B, C, D) + 0xCA62C1D6;
+		}
 
-	for (t = 60; t < 80; t++)
-	{
-		temp = SHA1CircularShift(5, A) + (B ^ C ^ D) + E + W[t] + K[3];
+		temp += SHA1CircularShift(5, A) + E;
 		E = D;
 		D = C;
 		C = SHA1CircularShift(30, B);
 		B = A;
 		A = temp;
 	}
+#endif
 
-	context->Intermediate_Hash[0] += A;
-	context->Intermediate_Hash[1] += B;
-	context->Intermediate_Hash[2] += C;
-	context->Intermediate_Hash[3] += D;
-	context->Intermediate_Hash[4] += E;
-
-	context->Message_Block_Index = 0;
+	H[0] += A;
+	H[1] += B;
+	H[2] += C;
+	H[3] += D;
+	H[4] += E;
 }
 
 
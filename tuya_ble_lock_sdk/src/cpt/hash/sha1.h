@@ -57,6 +57,12 @@ int SHA1Input(SHA1Context *,
 int SHA1Result(SHA1Context *,
 	uint8_t Message_Digest[SHA1HashSize]);
 
+int SHA1GetMidstate(const SHA1Context *,
+	uint32_t midstate[SHA1HashSize / 4]);
+int SHA1SetMidstate(SHA1Context *,
+	const uint32_t midstate[SHA1HashSize / 4],
+	uint32_t block_count);
+
 int SHA1(const uint8_t *message, 
 	unsigned int length,
 	uint8_t digest[SHA1HashSize]);
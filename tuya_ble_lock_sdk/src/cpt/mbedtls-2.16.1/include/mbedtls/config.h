@@ -40,7 +40,7 @@
 #define MBEDTLS_AES_ROM_TABLES
 //#define MBEDTLS_AES_FEWER_TABLES
 #define MBEDTLS_CIPHER_MODE_CBC
-#define MBEDTLS_CIPHER_MODE_CFB
+//#define MBEDTLS_CIPHER_MODE_CFB
 //#define MBEDTLS_PKCS1_V15
 //#define MBEDTLS_KEY_EXCHANGE_RSA_ENABLED
 //#define MBEDTLS_SSL_PROTO_TLS1_1
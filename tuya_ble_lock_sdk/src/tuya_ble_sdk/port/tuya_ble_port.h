@@ -536,6 +536,12 @@ bool tuya_ble_aes128_cbc_encrypt(uint8_t *key,uint8_t *iv,uint8_t *input,uint16_
     */
 bool tuya_ble_aes128_cbc_decrypt(uint8_t *key,uint8_t *iv,uint8_t *input,uint16_t input_len,uint8_t *output);
 
+/**
+    * @brief  drop the cached AES key schedules used by the functions above
+    * @note   call on disconnect so the session key does not outlive the link
+    */
+void tuya_ble_aes128_ctx_cache_clear(void);
+
 /**
     * @brief  MD5 checksum 
     * @param  input    specifed plain text to be encypted
@@ -3,12 +3,28 @@
 #include <string.h>
 #include "tuya_ble_port.h"
 #include "tuya_ble_type.h"
-#include "mbedtls/aes.h"
-#include "mbedtls/md5.h"
+#include "cpt_crypto.h"
 #include "tuya_ble_internal_config.h"
 #include "app_port.h"
 
 
+//Expanded AES round keys, so every frame does not redo setkey. A new session key simply misses.
+#ifndef TUYA_BLE_AES_CTX_CACHE_NUM
+#define TUYA_BLE_AES_CTX_CACHE_NUM  2
+#endif
+
+typedef struct
+{
+    bool                valid;
+    uint8_t             mode;   //CPT_AES_ENCRYPT / CPT_AES_DECRYPT
+    uint8_t             age;
+    uint8_t             key[16];
+    cpt_aes_ctx_t       ctx;
+} tuya_ble_aes_ctx_cache_t;
+
+static tuya_ble_aes_ctx_cache_t s_aes_ctx_cache[TUYA_BLE_AES_CTX_CACHE_NUM];
+
+
 
 
 /*********************************************************
@@ -299,13 +315,95 @@ bool tuya_ble_os_msg_queue_recv(void *p_handle, void *p_msg, uint32_t wait_ms)
 #endif
 
 
+/*********************************************************
+FN: 
+*/
+static cpt_aes_ctx_t* tuya_ble_aes128_ctx_get(uint8_t *key, int mode)
+{
+    tuya_ble_aes_ctx_cache_t *p_slot = NULL;
+    uint8_t i;
+
+    for(i=0; i<TUYA_BLE_AES_CTX_CACHE_NUM; i++)
+    {
+        if(s_aes_ctx_cache[i].valid && (s_aes_ctx_cache[i].mode == mode)
+            && (memcmp(s_aes_ctx_cache[i].key, key, 16) == 0))
+        {
+            p_slot = &s_aes_ctx_cache[i];
+            break;
+        }
+    }
+
+    if(p_slot == NULL)
+    {
+        //miss: take a free slot, else the least recently used one
+        p_slot = &s_aes_ctx_cache[0];
+        for(i=0; i<TUYA_BLE_AES_CTX_CACHE_NUM; i++)
+        {
+            if(!s_aes_ctx_cache[i].valid)
+            {
+                p_slot = &s_aes_ctx_cache[i];
+                break;
+            }
+            if(s_aes_ctx_cache[i].age > p_slot->age)
+            {
+                p_slot = &s_aes_ctx_cache[i];
+            }
+        }
+
+        if(p_slot->valid)
+        {
+            cpt_aes_free(&p_slot->ctx);
+        }
+        cpt_aes_init(&p_slot->ctx);
+        if(mode == CPT_AES_ENCRYPT)
+        {
+            cpt_aes_setkey_enc(&p_slot->ctx, key, 128);
+        }
+        else
+        {
+            cpt_aes_setkey_dec(&p_slot->ctx, key, 128);
+        }
+        memcpy(p_slot->key, key, 16);
+        p_slot->mode = mode;
+        p_slot->valid = true;
+    }
+
+    for(i=0; i<TUYA_BLE_AES_CTX_CACHE_NUM; i++)
+    {
+        if(s_aes_ctx_cache[i].age < 0xFF)
+        {
+            s_aes_ctx_cache[i].age++;
+        }
+    }
+    p_slot->age = 0;
+
+    return &p_slot->ctx;
+}
+
+/*********************************************************
+FN: 
+*/
+void tuya_ble_aes128_ctx_cache_clear(void)
+{
+    uint8_t i;
+
+    for(i=0; i<TUYA_BLE_AES_CTX_CACHE_NUM; i++)
+    {
+        if(s_aes_ctx_cache[i].valid)
+        {
+            cpt_aes_free(&s_aes_ctx_cache[i].ctx);
+        }
+        cpt_crypto_zeroize(&s_aes_ctx_cache[i], sizeof(tuya_ble_aes_ctx_cache_t));
+    }
+}
+
 /*********************************************************
 FN: 
 */
 bool tuya_ble_aes128_ecb_encrypt(uint8_t *key,uint8_t *input,uint16_t input_len,uint8_t *output)
 {
     uint16_t length;
-    mbedtls_aes_context aes_ctx;
+    cpt_aes_ctx_t *p_ctx;
     //
     if(input_len%16)
     {
@@ -314,20 +412,16 @@ bool tuya_ble_aes128_ecb_encrypt(uint8_t *key,uint8_t *input,uint16_t input_len,
 
     length = input_len;
 
-    mbedtls_aes_init(&aes_ctx);
-
-    mbedtls_aes_setkey_enc(&aes_ctx, key, 128);
+    p_ctx = tuya_ble_aes128_ctx_get(key, CPT_AES_ENCRYPT);
 
     while( length > 0 )
     {
-        mbedtls_aes_crypt_ecb(&aes_ctx, MBEDTLS_AES_ENCRYPT, input, output );
+        cpt_aes_crypt_ecb(p_ctx, CPT_AES_ENCRYPT, input, output );
         input  += 16;
         output += 16;
         length -= 16;
     }
 
-    mbedtls_aes_free(&aes_ctx);
-
     return true;
 }
 
@@ -337,7 +431,7 @@ FN:
 bool tuya_ble_aes128_ecb_decrypt(uint8_t *key,uint8_t *input,uint16_t input_len,uint8_t *output)
 {
     uint16_t length;
-    mbedtls_aes_context aes_ctx;
+    cpt_aes_ctx_t *p_ctx;
     //
     if(input_len%16)
     {
@@ -346,20 +440,16 @@ bool tuya_ble_aes128_ecb_decrypt(uint8_t *key,uint8_t *input,uint16_t input_len,
 
     length = input_len;
 
-    mbedtls_aes_init(&aes_ctx);
-
-    mbedtls_aes_setkey_dec(&aes_ctx, key, 128);
+    p_ctx = tuya_ble_aes128_ctx_get(key, CPT_AES_DECRYPT);
 
     while( length > 0 )
     {
-        mbedtls_aes_crypt_ecb(&aes_ctx, MBEDTLS_AES_DECRYPT, input, output );
+        cpt_aes_crypt_ecb(p_ctx, CPT_AES_DECRYPT, input, output );
         input  += 16;
         output += 16;
         length -= 16;
     }
 
-    mbedtls_aes_free(&aes_ctx);
-
     return true;
 }
 
@@ -368,20 +458,16 @@ FN:
 */
 bool tuya_ble_aes128_cbc_encrypt(uint8_t *key,uint8_t *iv,uint8_t *input,uint16_t input_len,uint8_t *output)
 {
-    mbedtls_aes_context aes_ctx;
+    cpt_aes_ctx_t *p_ctx;
     //
     if(input_len%16)
     {
         return false;
     }
 
-    mbedtls_aes_init(&aes_ctx);
-
-    mbedtls_aes_setkey_enc(&aes_ctx, key, 128);
+    p_ctx = tuya_ble_aes128_ctx_get(key, CPT_AES_ENCRYPT);
     
-    mbedtls_aes_crypt_cbc(&aes_ctx,MBEDTLS_AES_ENCRYPT,input_len,iv,input,output);
-    //
-    mbedtls_aes_free(&aes_ctx);
+    cpt_aes_crypt_cbc(p_ctx,CPT_AES_ENCRYPT,input_len,iv,input,output);
 
     return true;
 }
@@ -391,20 +477,16 @@ FN:
 */
 bool tuya_ble_aes128_cbc_decrypt(uint8_t *key,uint8_t *iv,uint8_t *input,uint16_t input_len,uint8_t *output)
 {
-    mbedtls_aes_context aes_ctx;
+    cpt_aes_ctx_t *p_ctx;
     //
     if(input_len%16)
     {
         return false;
     }
 
-    mbedtls_aes_init(&aes_ctx);
-
-    mbedtls_aes_setkey_dec(&aes_ctx, key, 128);
+    p_ctx = tuya_ble_aes128_ctx_get(key, CPT_AES_DECRYPT);
     
-    mbedtls_aes_crypt_cbc(&aes_ctx,MBEDTLS_AES_DECRYPT,input_len,iv,input,output);
-    //
-    mbedtls_aes_free(&aes_ctx);
+    cpt_aes_crypt_cbc(p_ctx,CPT_AES_DECRYPT,input_len,iv,input,output);
 
     return true;
 }
@@ -414,14 +496,7 @@ FN:
 */
 bool tuya_ble_md5_crypt(uint8_t *input,uint16_t input_len,uint8_t *output)
 {
-    mbedtls_md5_context md5_ctx;
-    mbedtls_md5_init(&md5_ctx);
-    mbedtls_md5_starts(&md5_ctx);
-    mbedtls_md5_update(&md5_ctx, input, input_len);
-    mbedtls_md5_finish(&md5_ctx, output);
-    mbedtls_md5_free(&md5_ctx);    
-    
-    return true;
+    return (cpt_md5(input, input_len, output) == 0);
 }
 
 
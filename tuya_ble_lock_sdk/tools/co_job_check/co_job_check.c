@@ -0,0 +1,528 @@
+/**
+****************************************************************************
+* @file      co_job_check.c
+* @brief     host checks of the background job scheduler against a synthetic clock, build and run with co_job_check.sh
+* @author    suding
+* @version   V1.0.0
+* @date      2020-05-11
+* @note
+*   device: co_job.c and co_list.c of the ble sdk unchanged. co_job_clock_set() installs a
+*           simulated clock: connection events of CO_JOB_CHECK_EVENT_US every
+*           CO_JOB_CHECK_INTERVAL_US, or none. A step advances the clock by its cost, a
+*           main loop turn without step by CO_JOB_CHECK_LOOP_US.
+*   noclock: no time source (host builds, clock NULL): one step per co_job_schedule().
+*   budget:  no radio event: a slice runs as many steps as fit in the budget, also across
+*            the 2^32 wrap of the time, budget 0 runs one step per slice.
+*   guard:   only the first step of a slice may run into the CO_JOB_GUARD_US before the
+*            next event, a gap start runs (gap - guard)/step steps.
+*   overlap: CO_JOB_FLAG_NO_OVERLAP steps never run into an event when they fit in a gap
+*            and the job starts with an estimate of its step, without estimate only the
+*            first step may, without the flag many do.
+*   maxwait: a NO_OVERLAP step larger than any gap, sharing the cpu with a job of short
+*            steps, still runs, held back at most CO_JOB_MAX_WAIT_US plus one interval.
+*   share:   two jobs take turns slice by slice.
+*   estimate: the step estimate follows an increase at once, a decrease by 1/8 per step.
+*   abort:   aborted jobs never run nor complete, done() may queue its job again, a
+*            reset drops the pending jobs and keeps the clock.
+******************************************************************************
+* @attention
+*
+* <h2><center>&copy; COPYRIGHT 2020 Tuya </center></h2>
+*/
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "co_job.h"
+
+/*********************************************************************
+ * LOCAL CONSTANTS
+ */
+#define CO_JOB_CHECK_INTERVAL_US    (30000) //connection interval app_ota asks for
+#define CO_JOB_CHECK_EVENT_US       (2500)  //radio event, one data packet and its ack
+#define CO_JOB_CHECK_LOOP_US        (50)    //main loop turn without step
+#define CO_JOB_CHECK_LOG_LEN        (64)
+
+/*********************************************************************
+ * LOCAL STRUCT
+ */
+typedef struct {
+    struct co_job job;
+    char     name;
+    const uint32_t* cost_us;    //cost of each step, the last one repeats
+    uint32_t cost_num;
+    uint32_t steps;             //steps to completion
+    uint32_t restarts;          //done() queues the job again this many times
+    uint32_t done_steps;
+    uint32_t dones;
+    uint32_t overlaps;          //steps which ran into a radio event
+    uint32_t late;              //steps after the first of a slice which ran into the guard
+    uint32_t last_end;
+    uint32_t max_wait;          //longest time between two steps
+} co_job_check_job_t;
+
+/*********************************************************************
+ * LOCAL VARIABLES
+ */
+static uint32_t s_now;
+static uint32_t s_interval;     //0: no radio event
+static uint32_t s_slice_steps;
+static char     s_log[CO_JOB_CHECK_LOG_LEN];
+static uint32_t s_log_len;
+
+/*********************************************************************
+ * LOCAL FUNCTION
+ */
+static void co_job_check_usage(void);
+static uint32_t co_job_check_now_us(void);
+static uint32_t co_job_check_idle_us(void);
+static bool co_job_check_step(void* p_env);
+static void co_job_check_done(void* p_env);
+static void co_job_check_start(co_job_check_job_t* j, char name, const uint32_t* cost_us, uint32_t cost_num,
+                               uint32_t steps, uint32_t budget_us, uint32_t step_us, uint8_t flags);
+static uint32_t co_job_check_run(uint32_t limit_us);
+static void co_job_check_reset(uint32_t now, uint32_t interval);
+static bool co_job_check_noclock(void);
+static bool co_job_check_budget(void);
+static bool co_job_check_guard(void);
+static bool co_job_check_overlap(void);
+static bool co_job_check_maxwait(void);
+static bool co_job_check_share(void);
+static bool co_job_check_estimate(void);
+static bool co_job_check_abort(void);
+
+static const struct co_job_clock s_clock = {
+    .now_us  = co_job_check_now_us,
+    .idle_us = co_job_check_idle_us,
+};
+
+static const struct {
+    const char* name;
+    bool (*run)(void);
+} s_checks[] = {
+    {"noclock",     co_job_check_noclock},
+    {"budget",      co_job_check_budget},
+    {"guard",       co_job_check_guard},
+    {"overlap",     co_job_check_overlap},
+    {"maxwait",     co_job_check_maxwait},
+    {"share",       co_job_check_share},
+    {"estimate",    co_job_check_estimate},
+    {"abort",       co_job_check_abort},
+};
+
+/*********************************************************************
+ * VARIABLES
+ */
+
+
+
+
+/*********************************************************
+FN:
+*/
+int main(int argc, char** argv)
+{
+    static const struct option opts[] = {
+        {"check",        required_argument, NULL, 'c'},
+        {"help",         no_argument,       NULL, 'h'},
+        {NULL, 0, NULL, 0},
+    };
+    const char* only = NULL;
+    uint32_t fails = 0;
+    uint32_t runs = 0;
+    int opt;
+
+    while((opt = getopt_long(argc, argv, "c:h", opts, NULL)) != -1)
+    {
+        switch(opt)
+        {
+            case 'c': only = optarg; break;
+            default: co_job_check_usage(); return 2;
+        }
+    }
+    if(optind != argc) {
+        co_job_check_usage();
+        return 2;
+    }
+
+    co_job_init(false);
+    for(uint32_t idx = 0; idx < sizeof(s_checks)/sizeof(s_checks[0]); idx++)
+    {
+        if((only != NULL) && (strcmp(only, s_checks[idx].name) != 0)) {
+            continue;
+        }
+        printf("%s:\n", s_checks[idx].name);
+        bool ok = s_checks[idx].run();
+        printf("%s: %s\n", s_checks[idx].name, ok ? "ok" : "FAIL");
+        fails += !ok;
+        runs++;
+    }
+    if(runs == 0) {
+        co_job_check_usage();
+        return 2;
+    }
+
+    printf("result: %u/%u ok\n", runs - fails, runs);
+    return (fails == 0) ? 0 : 1;
+}
+
+/*********************************************************
+FN:
+*/
+static void co_job_check_usage(void)
+{
+    printf("co_job_check.sh [options]\n"
+           "  -c, --check NAME       run one check:");
+    for(uint32_t idx = 0; idx < sizeof(s_checks)/sizeof(s_checks[0]); idx++) {
+        printf(" %s", s_checks[idx].name);
+    }
+    printf("\n");
+}
+
+/*********************************************************
+FN: synthetic clock
+*/
+static uint32_t co_job_check_now_us(void)
+{
+    return s_now;
+}
+
+/*********************************************************
+FN: events start at multiples of s_interval (time 0 included)
+*/
+static uint32_t co_job_check_idle_us(void)
+{
+    uint32_t pos;
+
+    if(s_interval == 0) {
+        return CO_JOB_IDLE_UNBOUNDED;
+    }
+    pos = s_now%s_interval;
+    return (pos < CO_JOB_CHECK_EVENT_US) ? 0 : (s_interval - pos);
+}
+
+/*********************************************************
+FN: one step, takes its cost of simulated time
+*/
+static bool co_job_check_step(void* p_env)
+{
+    co_job_check_job_t* j = p_env;
+    uint32_t cost = j->cost_us[(j->done_steps < j->cost_num) ? j->done_steps : (j->cost_num - 1)];
+    uint32_t idle = co_job_check_idle_us();
+
+    if((j->done_steps > 0) && ((s_now - j->last_end) > j->max_wait)) {
+        j->max_wait = s_now - j->last_end;
+    }
+    //event ongoing, or the next one starts before the end of the step
+    if(idle < cost) {
+        j->overlaps++;
+    }
+    if((s_slice_steps > 0) && (idle < cost + CO_JOB_GUARD_US)) {
+        j->late++;
+    }
+
+    s_now += cost;
+    j->last_end = s_now;
+    j->done_steps++;
+    s_slice_steps++;
+    if(s_log_len < CO_JOB_CHECK_LOG_LEN - 1) {
+        s_log[s_log_len++] = j->name;
+    }
+    return ((j->done_steps%j->steps) == 0);
+}
+
+/*********************************************************
+FN:
+*/
+static void co_job_check_done(void* p_env)
+{
+    co_job_check_job_t* j = p_env;
+
+    j->dones++;
+    if(j->restarts > 0)
+    {
+        j->restarts--;
+        co_job_start(&j->job, co_job_check_step, co_job_check_done, j, j->job.budget_us, 0, j->job.flags);
+    }
+}
+
+/*********************************************************
+FN:
+*/
+static void co_job_check_start(co_job_check_job_t* j, char name, const uint32_t* cost_us, uint32_t cost_num,
+                               uint32_t steps, uint32_t budget_us, uint32_t step_us, uint8_t flags)
+{
+    memset(j, 0x00, sizeof(co_job_check_job_t));
+    j->name = name;
+    j->cost_us = cost_us;
+    j->cost_num = cost_num;
+    j->steps = steps;
+    co_job_start(&j->job, co_job_check_step, co_job_check_done, j, budget_us, step_us, flags);
+}
+
+/*********************************************************
+FN: main loop until no job is pending or limit_us, returns the slices which ran a step
+*/
+static uint32_t co_job_check_run(uint32_t limit_us)
+{
+    uint32_t start = s_now;
+    uint32_t slices = 0;
+
+    while(co_job_is_pending() && ((s_now - start) < limit_us))
+    {
+        uint32_t before = s_now;
+
+        s_slice_steps = 0;
+        co_job_schedule();
+        slices += (s_slice_steps > 0);
+        if(s_now == before) {
+            s_now += CO_JOB_CHECK_LOOP_US;
+        }
+    }
+    return slices;
+}
+
+/*********************************************************
+FN: empty job list, clock at now, radio events every interval (0: none)
+*/
+static void co_job_check_reset(uint32_t now, uint32_t interval)
+{
+    co_job_init(true);
+    co_job_clock_set(&s_clock);
+    s_now = now;
+    s_interval = interval;
+    s_log_len = 0;
+    memset(s_log, 0x00, sizeof(s_log));
+}
+
+/*********************************************************
+FN:
+*/
+static bool co_job_check_noclock(void)
+{
+    static const uint32_t cost[] = {1000};
+    co_job_check_job_t j;
+    uint32_t fails = 0;
+
+    co_job_check_reset(0, 0);
+    co_job_clock_set(NULL);
+    co_job_check_start(&j, 'A', cost, 1, 5, 100000, 0, 0);
+    for(uint32_t idx = 0; idx < 5; idx++)
+    {
+        co_job_schedule();
+        fails += (j.done_steps != idx + 1);
+    }
+    fails += (j.dones != 1) || co_job_is_pending();
+    co_job_clock_set(&s_clock);
+
+    printf("  5 schedules: %u steps, %u done\n", j.done_steps, j.dones);
+    return (fails == 0);
+}
+
+/*********************************************************
+FN:
+*/
+static bool co_job_check_budget(void)
+{
+    static const uint32_t cost[] = {300};
+    co_job_check_job_t j;
+    uint32_t fails = 0;
+    uint32_t slices = 0;
+    uint32_t longest = 0;
+
+    //60 steps of 300 us in slices of 2000 us: 6 steps each, the time wraps in the middle
+    co_job_check_reset(0xFFFFFFFF - 10000, 0);
+    co_job_check_start(&j, 'A', cost, 1, 60, 2000, 0, 0);
+    while(co_job_is_pending() && (slices < 100))
+    {
+        uint32_t before = s_now;
+
+        s_slice_steps = 0;
+        co_job_schedule();
+        fails += (s_slice_steps != 6);
+        if((s_now - before) > longest) {
+            longest = s_now - before;
+        }
+        slices++;
+    }
+    fails += (slices != 10) || (longest > 2000) || (j.dones != 1);
+    printf("  budget 2000 us, 300 us steps: %u slices, longest %u us\n", slices, longest);
+
+    //budget 0: one step per slice
+    co_job_check_reset(0, 0);
+    co_job_check_start(&j, 'A', cost, 1, 3, 0, 0, 0);
+    slices = co_job_check_run(1000000);
+    fails += (slices != 3) || (j.dones != 1);
+    printf("  budget 0: %u slices for 3 steps\n", slices);
+    return (fails == 0);
+}
+
+/*********************************************************
+FN:
+*/
+static bool co_job_check_guard(void)
+{
+    static const uint32_t cost[] = {1000};
+    co_job_check_job_t j;
+    uint32_t fails = 0;
+    uint32_t first;
+    uint32_t expect = (CO_JOB_CHECK_INTERVAL_US - CO_JOB_CHECK_EVENT_US - CO_JOB_GUARD_US)/1000;
+
+    //start of a gap, large budget: the gap minus the guard bounds the slice
+    co_job_check_reset(CO_JOB_CHECK_EVENT_US, CO_JOB_CHECK_INTERVAL_US);
+    co_job_check_start(&j, 'A', cost, 1, 300, 1000000, 0, 0);
+    s_slice_steps = 0;
+    co_job_schedule();
+    first = s_slice_steps;
+    co_job_check_run(10000000);
+    fails += (first != expect) || (j.late != 0) || (j.dones != 1);
+
+    printf("  1000 us steps: %u in the first slice (%u expected), %u into the guard, %u first steps into an event\n",
+        first, expect, j.late, j.overlaps);
+    return (fails == 0);
+}
+
+/*********************************************************
+FN:
+*/
+static bool co_job_check_overlap(void)
+{
+    static const uint32_t cost[] = {8000};
+    co_job_check_job_t j;
+    uint32_t fails = 0;
+    uint32_t flagged_us;
+    uint32_t plain;
+
+    //8 ms steps, 3 fit in a 27.5 ms gap, started during an event
+    co_job_check_reset(0, CO_JOB_CHECK_INTERVAL_US);
+    co_job_check_start(&j, 'A', cost, 1, 60, 0, 8000, CO_JOB_FLAG_NO_OVERLAP);
+    co_job_check_run(10000000);
+    flagged_us = s_now;
+    fails += (j.overlaps != 0) || (j.dones != 1) || (flagged_us > 21*CO_JOB_CHECK_INTERVAL_US);
+    printf("  NO_OVERLAP, 60 steps of 8 ms: %u into an event, %u ms\n", j.overlaps, flagged_us/1000);
+
+    //without initial estimate the first step runs at once
+    co_job_check_reset(0, CO_JOB_CHECK_INTERVAL_US);
+    co_job_check_start(&j, 'A', cost, 1, 60, 0, 0, CO_JOB_FLAG_NO_OVERLAP);
+    co_job_check_run(10000000);
+    fails += (j.overlaps != 1) || (j.dones != 1);
+    printf("  same, no initial estimate: %u into an event (the first step)\n", j.overlaps);
+
+    co_job_check_reset(0, CO_JOB_CHECK_INTERVAL_US);
+    co_job_check_start(&j, 'A', cost, 1, 60, 0, 0, 0);
+    co_job_check_run(10000000);
+    plain = j.overlaps;
+    fails += (plain == 0) || (j.dones != 1);
+    printf("  no flag, same steps: %u into an event, %u ms\n", plain, s_now/1000);
+    return (fails == 0);
+}
+
+/*********************************************************
+FN:
+*/
+static bool co_job_check_maxwait(void)
+{
+    static const uint32_t cost_a[] = {100};
+    static const uint32_t cost_b[] = {40000};
+    co_job_check_job_t a, b;
+    uint32_t fails = 0;
+
+    co_job_check_reset(0, CO_JOB_CHECK_INTERVAL_US);
+    co_job_check_start(&a, 'A', cost_a, 1, 0xFFFFFFFF, 0, 0, 0);
+    co_job_check_start(&b, 'B', cost_b, 1, 5, 0, 0, CO_JOB_FLAG_NO_OVERLAP);
+    while((b.dones == 0) && (s_now < 10000000)) {
+        co_job_check_run(CO_JOB_CHECK_INTERVAL_US);
+    }
+    co_job_abort(&a.job);
+    fails += (b.dones != 1) || (b.max_wait > CO_JOB_MAX_WAIT_US + CO_JOB_CHECK_INTERVAL_US) || (a.done_steps == 0);
+
+    printf("  40 ms steps next to 100 us ones: %u steps, held back up to %u us, %u short steps\n",
+        b.done_steps, b.max_wait, a.done_steps);
+    return (fails == 0);
+}
+
+/*********************************************************
+FN:
+*/
+static bool co_job_check_share(void)
+{
+    static const uint32_t cost[] = {400};
+    static const char expect[] = "AABBAABBAABB";
+    co_job_check_job_t a, b;
+    uint32_t fails = 0;
+
+    //slices of 1000 us: two 400 us steps each
+    co_job_check_reset(0, 0);
+    co_job_check_start(&a, 'A', cost, 1, 6, 1000, 0, 0);
+    co_job_check_start(&b, 'B', cost, 1, 6, 1000, 0, 0);
+    co_job_check_run(1000000);
+    fails += (strcmp(s_log, expect) != 0) || (a.dones != 1) || (b.dones != 1);
+
+    printf("  steps in order: %s (%s expected)\n", s_log, expect);
+    return (fails == 0);
+}
+
+/*********************************************************
+FN:
+*/
+static bool co_job_check_estimate(void)
+{
+    static const uint32_t cost[] = {200, 200, 1000, 200, 200};
+    static const uint32_t expect[] = {200, 200, 1000, 900, 813};
+    co_job_check_job_t j;
+    uint32_t fails = 0;
+
+    co_job_check_reset(0, 0);
+    co_job_check_start(&j, 'A', cost, 5, 5, 0, 0, 0);
+    printf("  estimate:");
+    for(uint32_t idx = 0; idx < 5; idx++)
+    {
+        uint32_t step_us;
+
+        co_job_schedule();
+        step_us = j.job.step_us;
+        fails += (step_us != expect[idx]);
+        printf(" %u", step_us);
+    }
+    printf(" us\n");
+    return (fails == 0);
+}
+
+/*********************************************************
+FN:
+*/
+static bool co_job_check_abort(void)
+{
+    static const uint32_t cost[] = {300};
+    co_job_check_job_t a, b, c;
+    uint32_t fails = 0;
+
+    co_job_check_reset(0, 0);
+    co_job_check_start(&a, 'A', cost, 1, 3, 0, 0, 0);
+    co_job_check_start(&b, 'B', cost, 1, 3, 0, 0, 0);
+    co_job_check_start(&c, 'C', cost, 1, 3, 0, 0, 0);
+    fails += !co_job_abort(&b.job);
+    fails += co_job_abort(&b.job);
+    co_job_check_run(1000000);
+    fails += (a.dones != 1) || (b.dones != 0) || (b.done_steps != 0) || (c.dones != 1);
+    fails += co_job_abort(&a.job);
+    printf("  1 of 3 aborted: steps %s\n", s_log);
+
+    //done() starts the job again
+    co_job_check_reset(0, 0);
+    co_job_check_start(&a, 'A', cost, 1, 2, 0, 0, 0);
+    a.restarts = 1;
+    co_job_check_run(1000000);
+    fails += (a.dones != 2) || (a.done_steps != 4);
+    printf("  restarted from done(): %u steps, %u done\n", a.done_steps, a.dones);
+
+    //reset drops the pending job, the clock stays: 6 steps fit in the next slice
+    co_job_check_start(&a, 'A', cost, 1, 3, 0, 0, 0);
+    co_job_init(true);
+    fails += co_job_is_pending();
+    co_job_check_start(&b, 'B', cost, 1, 6, 2000, 0, 0);
+    co_job_schedule();
+    fails += (b.dones != 1) || co_job_is_pending();
+    printf("  reset: %s pending, next job %u steps in one slice\n", co_job_is_pending() ? "still" : "none", b.done_steps);
+    return (fails == 0);
+}
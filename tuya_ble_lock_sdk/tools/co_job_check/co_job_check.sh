@@ -0,0 +1,23 @@
+#!/bin/sh
+# Build the host checks of the background job scheduler (ble sdk co_job.c) and run them,
+# options are passed on (co_job_check.sh -h).
+#
+#   CO_JOB_CHECK_OUT  build directory, /tmp/co_job_check by default
+#   CC                host compiler, cc by default
+#
+# The firmware drives co_job from the radio timers, here a synthetic clock with periodic
+# connection events stands in for them, all times are simulated.
+set -e
+
+HERE=$(cd "$(dirname "$0")" && pwd)
+COM=$HERE/../../../ble_3435_sdk_ext_39_0F0E/sdk/plactform/com
+OUT=${CO_JOB_CHECK_OUT:-/tmp/co_job_check}
+
+mkdir -p "$OUT"
+
+${CC:-cc} -O2 -Wall -Wno-unused-function \
+    -I"$HERE/stub" -I"$COM/api" \
+    "$HERE/co_job_check.c" "$COM/src/co_job.c" "$COM/src/co_list.c" \
+    -o "$OUT/co_job_check"
+
+exec "$OUT/co_job_check" "$@"
@@ -0,0 +1,7 @@
+//co_job_check: host build of co_job/co_list
+#ifndef _COMPILER_H_
+#define _COMPILER_H_
+
+#define __INLINE static inline
+
+#endif //_COMPILER_H_
@@ -0,0 +1,5 @@
+//co_job_check: co_list.c includes it, nothing is allocated
+#ifndef _KE_MEM_H_
+#define _KE_MEM_H_
+
+#endif //_KE_MEM_H_
@@ -0,0 +1,7 @@
+//co_job_check: host build of co_job/co_list, the radio is modelled by the check
+#ifndef RWIP_CONFIG_H_
+#define RWIP_CONFIG_H_
+
+#define BLE_EMB_PRESENT           0
+
+#endif //RWIP_CONFIG_H_
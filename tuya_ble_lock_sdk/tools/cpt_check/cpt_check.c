@@ -0,0 +1,891 @@
+/**
+****************************************************************************
+* @file      cpt_check.c
+* @brief     host known-answer and equivalence checks of src/cpt, build and run with cpt_check.sh
+* @author    suding
+* @version   V1.0.0
+* @date      2020-05-11
+* @note
+*   Every check runs published vectors first, then compares the fast path with the
+*   reference it replaced on random input (fixed seed), then times both.
+*   ff1:    ff1_decrypt_10_digits() against NIST SP 800-38G FF1 samples 1, 4, 7 and the
+*           generic decrypt(), 16/24/32 byte keys.
+*   hmac:   HMAC_SHA1() and one HMAC_SHA1_Precompute() reused by many HMAC_SHA1_Finish()
+*           against RFC 2202 and a plain two-pass HMAC over SHA1Input(), keys up to 2 blocks.
+*   sha1:   sha1.c, unrolled and SHA1_COMPACT (cpt_check_sha1_compact.c), against FIPS 180
+*           vectors and a textbook byte-wise SHA-1, input fed in random chunks, midstate
+*           export/resume on a block boundary.
+*   crc:    cpt_crc16/32_compute() with the byte (default), nibble and slice4 tables
+*           (cpt_check_crc_variant.c) against the catalogue check values and the bit-serial
+*           code they replaced, whole and chained over random splits.
+*   aes:    tuya_ble_aes128_ecb/cbc_*() of tuya_ble_port_bk3431q.c, which keep expanded keys
+*           in a small cache, against FIPS 197 / SP 800-38A vectors and a fresh cpt_aes
+*           context per call (what the port did before), more keys than cache slots and
+*           both directions interleaved, the cbc iv carried over, cache clear in between.
+******************************************************************************
+* @attention
+*
+* <h2><center>&copy; COPYRIGHT 2020 Tuya </center></h2>
+*/
+#include <getopt.h>
+#include <time.h>
+#include <stdio.h>
+#include <string.h>
+#include "ff1.h"
+#include "hmac-sha1.h"
+#include "cpt_math.h"
+#include "cpt_crypto.h"
+
+/*********************************************************************
+ * LOCAL CONSTANTS
+ */
+#define CPT_CHECK_BENCH_MS      (200)
+
+/*********************************************************************
+ * LOCAL STRUCT
+ */
+typedef struct {
+    const char* name;
+    bool (*run)(void);
+} cpt_check_t;
+
+/*********************************************************************
+ * LOCAL VARIABLES
+ */
+static uint32_t s_iterations = 3000;
+static uint32_t s_seed = 1;
+static uint32_t s_rand;
+
+/*********************************************************************
+ * LOCAL FUNCTION
+ */
+static void cpt_check_usage(void);
+static uint32_t cpt_check_rand(void);
+static void cpt_check_rand_buf(uint8_t* buf, uint32_t size);
+static double cpt_check_now_us(void);
+static bool cpt_check_hex(const char* hex, uint8_t* buf, uint32_t size);
+static bool cpt_check_ff1(void);
+static bool cpt_check_hmac(void);
+static bool cpt_check_sha1(void);
+static bool cpt_check_crc(void);
+static bool cpt_check_aes(void);
+
+//cpt_check_sha1_compact.c
+int SHA1Reset_compact(SHA1Context *);
+int SHA1Input_compact(SHA1Context *, const uint8_t *, unsigned int);
+int SHA1Result_compact(SHA1Context *, uint8_t Message_Digest[SHA1HashSize]);
+int SHA1_compact(const uint8_t *message, unsigned int length, uint8_t digest[SHA1HashSize]);
+//cpt_check_crc_variant.c
+uint16_t cpt_crc16_compute_nibble(uint8_t* buf, uint16_t size, uint16_t* p_crc);
+uint32_t cpt_crc32_compute_nibble(uint8_t* buf, uint32_t size, uint32_t* p_crc);
+uint16_t cpt_crc16_compute_slice4(uint8_t* buf, uint16_t size, uint16_t* p_crc);
+uint32_t cpt_crc32_compute_slice4(uint8_t* buf, uint32_t size, uint32_t* p_crc);
+//tuya_ble_port_bk3431q.c
+bool tuya_ble_aes128_ecb_encrypt(uint8_t *key,uint8_t *input,uint16_t input_len,uint8_t *output);
+bool tuya_ble_aes128_ecb_decrypt(uint8_t *key,uint8_t *input,uint16_t input_len,uint8_t *output);
+bool tuya_ble_aes128_cbc_encrypt(uint8_t *key,uint8_t *iv,uint8_t *input,uint16_t input_len,uint8_t *output);
+bool tuya_ble_aes128_cbc_decrypt(uint8_t *key,uint8_t *iv,uint8_t *input,uint16_t input_len,uint8_t *output);
+void tuya_ble_aes128_ctx_cache_clear(void);
+
+static const cpt_check_t s_checks[] = {
+    {"ff1",     cpt_check_ff1},
+    {"hmac",    cpt_check_hmac},
+    {"sha1",    cpt_check_sha1},
+    {"crc",     cpt_check_crc},
+    {"aes",     cpt_check_aes},
+};
+
+/*********************************************************************
+ * VARIABLES
+ */
+
+
+
+
+/*********************************************************
+FN:
+*/
+int main(int argc, char** argv)
+{
+    static const struct option opts[] = {
+        {"check",        required_argument, NULL, 'c'},
+        {"iterations",   required_argument, NULL, 'n'},
+        {"seed",         required_argument, NULL, 'x'},
+        {"help",         no_argument,       NULL, 'h'},
+        {NULL, 0, NULL, 0},
+    };
+    const char* only = NULL;
+    uint32_t fails = 0;
+    uint32_t runs = 0;
+    int opt;
+
+    while((opt = getopt_long(argc, argv, "c:n:x:h", opts, NULL)) != -1)
+    {
+        switch(opt)
+        {
+            case 'c': only = optarg; break;
+            case 'n': s_iterations = strtoul(optarg, NULL, 0); break;
+            case 'x': s_seed = strtoul(optarg, NULL, 0); break;
+            default: cpt_check_usage(); return 2;
+        }
+    }
+    if((optind != argc) || (s_iterations == 0)) {
+        cpt_check_usage();
+        return 2;
+    }
+
+    for(uint32_t idx = 0; idx < sizeof(s_checks)/sizeof(s_checks[0]); idx++)
+    {
+        if((only != NULL) && (strcmp(only, s_checks[idx].name) != 0)) {
+            continue;
+        }
+        s_rand = (s_seed != 0) ? s_seed : 0x9E3779B9;
+        printf("%s:\n", s_checks[idx].name);
+        bool ok = s_checks[idx].run();
+        printf("%s: %s\n", s_checks[idx].name, ok ? "ok" : "FAIL");
+        fails += !ok;
+        runs++;
+    }
+    if(runs == 0) {
+        cpt_check_usage();
+        return 2;
+    }
+
+    printf("result: %u/%u ok\n", runs - fails, runs);
+    return (fails == 0) ? 0 : 1;
+}
+
+/*********************************************************
+FN:
+*/
+static void cpt_check_usage(void)
+{
+    printf("cpt_check.sh [options]\n"
+           "  -c, --check NAME      run one check only:");
+    for(uint32_t idx = 0; idx < sizeof(s_checks)/sizeof(s_checks[0]); idx++) {
+        printf(" %s", s_checks[idx].name);
+    }
+    printf("\n"
+           "  -n, --iterations N    random inputs per equivalence check (3000)\n"
+           "  -x, --seed N          seed of the random inputs (1)\n");
+}
+
+/*********************************************************
+FN: xorshift32, same sequence on every host
+*/
+static uint32_t cpt_check_rand(void)
+{
+    s_rand ^= s_rand << 13;
+    s_rand ^= s_rand >> 17;
+    s_rand ^= s_rand << 5;
+    return s_rand;
+}
+
+/*********************************************************
+FN:
+*/
+static void cpt_check_rand_buf(uint8_t* buf, uint32_t size)
+{
+    for(uint32_t idx = 0; idx < size; idx++) {
+        buf[idx] = cpt_check_rand();
+    }
+}
+
+/*********************************************************
+FN:
+*/
+static double cpt_check_now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec*1e6 + ts.tv_nsec/1e3;
+}
+
+/*********************************************************
+FN:
+*/
+static bool cpt_check_hex(const char* hex, uint8_t* buf, uint32_t size)
+{
+    if(strlen(hex) != size*2) {
+        return false;
+    }
+    for(uint32_t idx = 0; idx < size; idx++) {
+        unsigned int val;
+        if(sscanf(&hex[idx*2], "%2x", &val) != 1) {
+            return false;
+        }
+        buf[idx] = val;
+    }
+    return true;
+}
+
+/*********************************************************
+FN: generic decrypt() of a 10 digit input, what fpe_decrypt() did before the fast path
+*/
+static bool cpt_check_ff1_generic(uint8_t* key, uint32_t key_len, const uint8_t* cipher, uint8_t* plain)
+{
+    byte_str key_str = {.buf=key, .len=key_len};
+    byte_str tweak = create_byte_str((uint8_t*)"", 0);
+    num_str cipher_str = {.buf=(uint8_t*)cipher, .len=FF1_10_DIGITS_LEN};
+    ff1_context ctx;
+    bool ok;
+
+    ctx.ret = 0;
+    ctx.max_tweak_len = 20;
+    num_str result = decrypt(key_str, tweak, cipher_str, ctx);
+    ok = (result.len == FF1_10_DIGITS_LEN);
+    if(ok) {
+        memcpy(plain, result.buf, FF1_10_DIGITS_LEN);
+    }
+    release_str(result);
+    release_str(tweak);
+    return ok;
+}
+
+/*********************************************************
+FN:
+*/
+static bool cpt_check_ff1(void)
+{
+    //NIST SP 800-38G examples, FF1 radix 10, empty tweak, X = 0123456789
+    static const struct {
+        const char* key;
+        const char* cipher;
+    } kat[] = {
+        {"2B7E151628AED2A6ABF7158809CF4F3C",                                 "2433477484"},
+        {"2B7E151628AED2A6ABF7158809CF4F3CEF4359D8D580AA4F",                 "2830668132"},
+        {"2B7E151628AED2A6ABF7158809CF4F3CEF4359D8D580AA4F7F036D6F04FC6A94", "6657667009"},
+    };
+    const uint8_t expect[FF1_10_DIGITS_LEN] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    prf_key_handle handle;
+    uint8_t key[32];
+    uint8_t cipher[FF1_10_DIGITS_LEN];
+    uint8_t plain[FF1_10_DIGITS_LEN];
+    uint8_t plain_ref[FF1_10_DIGITS_LEN];
+    uint32_t fails = 0;
+
+    memset(&handle, 0x00, sizeof(handle));
+    for(uint32_t idx = 0; idx < sizeof(kat)/sizeof(kat[0]); idx++)
+    {
+        uint32_t key_len = strlen(kat[idx].key)/2;
+
+        cpt_check_hex(kat[idx].key, key, key_len);
+        for(uint32_t pos = 0; pos < FF1_10_DIGITS_LEN; pos++) {
+            cipher[pos] = kat[idx].cipher[pos] - '0';
+        }
+        bool fast = (prf_key_load(&handle, key, key_len) == 0)
+            && (ff1_decrypt_10_digits(&handle, cipher, plain) == OK)
+            && (memcmp(plain, expect, FF1_10_DIGITS_LEN) == 0);
+        bool generic = cpt_check_ff1_generic(key, key_len, cipher, plain_ref)
+            && (memcmp(plain_ref, expect, FF1_10_DIGITS_LEN) == 0);
+        printf("  kat aes-%u: fast %s, generic %s\n", key_len*8, fast ? "ok" : "FAIL", generic ? "ok" : "FAIL");
+        fails += !fast + !generic;
+    }
+
+    //random keys and inputs, key reloaded for every attempt like a new login key
+    uint32_t diffs = 0;
+    for(uint32_t iter = 0; iter < s_iterations; iter++)
+    {
+        uint32_t key_len = 16 + 8*(iter % 3);
+
+        cpt_check_rand_buf(key, key_len);
+        for(uint32_t pos = 0; pos < FF1_10_DIGITS_LEN; pos++) {
+            cipher[pos] = cpt_check_rand() % 10;
+        }
+        if((prf_key_load(&handle, key, key_len) != 0)
+            || (ff1_decrypt_10_digits(&handle, cipher, plain) != OK)
+            || !cpt_check_ff1_generic(key, key_len, cipher, plain_ref)
+            || (memcmp(plain, plain_ref, FF1_10_DIGITS_LEN) != 0)) {
+            diffs++;
+        }
+    }
+    printf("  random: %u inputs, %u differ\n", s_iterations, diffs);
+    fails += diffs;
+
+    //time per decrypt, same key (the cached case of fpe_decrypt())
+    uint32_t count_fast = 0, count_generic = 0;
+    double start = cpt_check_now_us();
+    while(cpt_check_now_us() - start < CPT_CHECK_BENCH_MS*1000) {
+        ff1_decrypt_10_digits(&handle, cipher, plain);
+        count_fast++;
+    }
+    double fast_us = (cpt_check_now_us() - start)/count_fast;
+    start = cpt_check_now_us();
+    while(cpt_check_now_us() - start < CPT_CHECK_BENCH_MS*1000) {
+        cpt_check_ff1_generic(key, 32, cipher, plain_ref);
+        count_generic++;
+    }
+    double generic_us = (cpt_check_now_us() - start)/count_generic;
+    printf("  time: fast %.2f us, generic %.2f us, x%.1f\n", fast_us, generic_us, generic_us/fast_us);
+
+    prf_key_wipe(&handle);
+    return (fails == 0);
+}
+
+/*********************************************************
+FN: textbook HMAC, both passes over the full key blocks, no midstate
+*/
+static void cpt_check_hmac_ref(const uint8_t* key, uint32_t key_len, const uint8_t* msg, uint32_t msg_len, uint8_t* digest)
+{
+    uint8_t block[HMAC_BLOCK_SIZE];
+    uint8_t inner[SHA1HashSize];
+    SHA1Context sha;
+
+    memset(block, 0x00, sizeof(block));
+    if(key_len > HMAC_BLOCK_SIZE) {
+        SHA1Reset(&sha);
+        SHA1Input(&sha, key, key_len);
+        SHA1Result(&sha, block);
+    } else {
+        memcpy(block, key, key_len);
+    }
+
+    for(uint32_t idx = 0; idx < HMAC_BLOCK_SIZE; idx++) {
+        block[idx] ^= 0x36;
+    }
+    SHA1Reset(&sha);
+    SHA1Input(&sha, block, HMAC_BLOCK_SIZE);
+    SHA1Input(&sha, msg, msg_len);
+    SHA1Result(&sha, inner);
+
+    for(uint32_t idx = 0; idx < HMAC_BLOCK_SIZE; idx++) {
+        block[idx] ^= 0x36 ^ 0x5c;
+    }
+    SHA1Reset(&sha);
+    SHA1Input(&sha, block, HMAC_BLOCK_SIZE);
+    SHA1Input(&sha, inner, SHA1HashSize);
+    SHA1Result(&sha, digest);
+}
+
+/*********************************************************
+FN:
+*/
+static bool cpt_check_hmac(void)
+{
+    //RFC 2202 section 3, key and data given as (byte, count) or text
+    static const struct {
+        uint8_t     key_byte;
+        uint8_t     key_len;
+        const char* data;
+        uint8_t     data_byte;
+        uint8_t     data_len;
+        const char* digest;
+    } kat[] = {
+        {0x0b, 20, "Hi There",                                                   0,    0,  "b617318655057264e28bc0b6fb378c8ef146be00"},
+        {0,    4,  "what do ya want for nothing?",                               0,    0,  "effcdf6ae5eb2fa2d27416d5f184df9c259a7c79"},
+        {0xaa, 20, NULL,                                                         0xdd, 50, "125d7342b9ac11cd91a39af48aa17b4f63f175d3"},
+        {1,    25, NULL,                                                         0xcd, 50, "4c9007f4026250c6bc8414f9bf50c86c2d7235da"},
+        {0x0c, 20, "Test With Truncation",                                       0,    0,  "4c1a03424b55e07fe7f27be1d58bb9324a9a5a04"},
+        {0xaa, 80, "Test Using Larger Than Block-Size Key - Hash Key First",     0,    0,  "aa4ae5e15272d00e95705637ce8a3b55ed402112"},
+        {0xaa, 80, "Test Using Larger Than Block-Size Key and Larger Than One Block-Size Data", 0, 0, "e8e99d0f45237d786d6bbaa7965c7808bbff1a91"},
+    };
+    HMAC_SHA1Context ctx;
+    uint8_t key[2*HMAC_BLOCK_SIZE];
+    uint8_t msg[3*HMAC_BLOCK_SIZE];
+    uint8_t digest[SHA1HashSize];
+    uint8_t digest_mid[SHA1HashSize];
+    uint8_t digest_ref[SHA1HashSize];
+    uint8_t expect[SHA1HashSize];
+    uint32_t fails = 0;
+
+    for(uint32_t idx = 0; idx < sizeof(kat)/sizeof(kat[0]); idx++)
+    {
+        uint32_t msg_len;
+
+        if(idx == 1) {
+            memcpy(key, "Jefe", 4);
+        } else {
+            for(uint32_t pos = 0; pos < kat[idx].key_len; pos++) {
+                key[pos] = (kat[idx].key_byte == 1) ? (pos + 1) : kat[idx].key_byte;
+            }
+        }
+        if(kat[idx].data != NULL) {
+            msg_len = strlen(kat[idx].data);
+            memcpy(msg, kat[idx].data, msg_len);
+        } else {
+            msg_len = kat[idx].data_len;
+            memset(msg, kat[idx].data_byte, msg_len);
+        }
+        cpt_check_hex(kat[idx].digest, expect, SHA1HashSize);
+
+        HMAC_SHA1(key, kat[idx].key_len, msg, msg_len, digest);
+        HMAC_SHA1_Precompute(&ctx, key, kat[idx].key_len);
+        HMAC_SHA1_Finish(&ctx, msg, msg_len, digest_mid);
+        bool ok = (memcmp(digest, expect, SHA1HashSize) == 0) && (memcmp(digest_mid, expect, SHA1HashSize) == 0);
+        printf("  kat rfc2202 case %u: %s\n", idx + 1, ok ? "ok" : "FAIL");
+        fails += !ok;
+    }
+
+    //random keys, several messages per precomputed key like the 3 tries of a dynamic pwd
+    uint32_t diffs = 0;
+    for(uint32_t iter = 0; iter < s_iterations; iter++)
+    {
+        uint32_t key_len = 1 + cpt_check_rand() % sizeof(key);
+
+        cpt_check_rand_buf(key, key_len);
+        HMAC_SHA1_Precompute(&ctx, key, key_len);
+        for(uint32_t tries = 0; tries < 3; tries++)
+        {
+            uint32_t msg_len = cpt_check_rand() % (sizeof(msg) + 1);
+
+            cpt_check_rand_buf(msg, msg_len);
+            HMAC_SHA1_Finish(&ctx, msg, msg_len, digest_mid);
+            HMAC_SHA1(key, key_len, msg, msg_len, digest);
+            cpt_check_hmac_ref(key, key_len, msg, msg_len, digest_ref);
+            diffs += (memcmp(digest_mid, digest_ref, SHA1HashSize) != 0) || (memcmp(digest, digest_ref, SHA1HashSize) != 0);
+        }
+    }
+    printf("  random: %u keys x 3 messages, %u differ\n", s_iterations, diffs);
+    fails += diffs;
+
+    //time of one 8 byte token: midstate reused against the full HMAC per try
+    uint32_t count_mid = 0, count_full = 0;
+    double start = cpt_check_now_us();
+    while(cpt_check_now_us() - start < CPT_CHECK_BENCH_MS*1000) {
+        HMAC_SHA1_Finish(&ctx, msg, 8, digest_mid);
+        count_mid++;
+    }
+    double mid_us = (cpt_check_now_us() - start)/count_mid;
+    start = cpt_check_now_us();
+    while(cpt_check_now_us() - start < CPT_CHECK_BENCH_MS*1000) {
+        cpt_check_hmac_ref(key, 16, msg, 8, digest_ref);
+        count_full++;
+    }
+    double full_us = (cpt_check_now_us() - start)/count_full;
+    printf("  time: midstate %.2f us, full %.2f us, x%.1f\n", mid_us, full_us, full_us/mid_us);
+
+    memset(&ctx, 0x00, sizeof(ctx));
+    return (fails == 0);
+}
+
+/*********************************************************
+FN: FIPS 180-4 as written: pad the whole message, 80 word schedule per block
+*/
+static void cpt_check_sha1_ref(const uint8_t* msg, uint32_t len, uint8_t* digest)
+{
+    uint32_t H[5] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+    uint32_t total = ((len + 8)/64 + 1)*64;
+    uint8_t* buf = calloc(total, 1);
+    uint64_t bits = (uint64_t)len*8;
+
+    memcpy(buf, msg, len);
+    buf[len] = 0x80;
+    for(uint32_t idx = 0; idx < 8; idx++) {
+        buf[total - 1 - idx] = bits >> (8*idx);
+    }
+
+    for(uint32_t blk = 0; blk < total; blk += 64)
+    {
+        uint32_t W[80];
+        uint32_t a = H[0], b = H[1], c = H[2], d = H[3], e = H[4];
+
+        for(uint32_t t = 0; t < 80; t++) {
+            if(t < 16) {
+                W[t] = ((uint32_t)buf[blk + 4*t] << 24) | ((uint32_t)buf[blk + 4*t + 1] << 16)
+                     | ((uint32_t)buf[blk + 4*t + 2] << 8) | buf[blk + 4*t + 3];
+            } else {
+                uint32_t x = W[t-3] ^ W[t-8] ^ W[t-14] ^ W[t-16];
+                W[t] = (x << 1) | (x >> 31);
+            }
+        }
+        for(uint32_t t = 0; t < 80; t++) {
+            uint32_t f, k;
+            if(t < 20)      { f = (b & c) | (~b & d);          k = 0x5A827999; }
+            else if(t < 40) { f = b ^ c ^ d;                   k = 0x6ED9EBA1; }
+            else if(t < 60) { f = (b & c) | (b & d) | (c & d); k = 0x8F1BBCDC; }
+            else            { f = b ^ c ^ d;                   k = 0xCA62C1D6; }
+            uint32_t tmp = ((a << 5) | (a >> 27)) + f + e + k + W[t];
+            e = d; d = c; c = (b << 30) | (b >> 2); b = a; a = tmp;
+        }
+        H[0] += a; H[1] += b; H[2] += c; H[3] += d; H[4] += e;
+    }
+    for(uint32_t idx = 0; idx < 20; idx++) {
+        digest[idx] = H[idx/4] >> (24 - 8*(idx % 4));
+    }
+    free(buf);
+}
+
+/*********************************************************
+FN:
+*/
+static bool cpt_check_sha1(void)
+{
+    //FIPS 180-2 appendix A and the empty message, count repeats the text
+    static const struct {
+        const char* text;
+        uint32_t    count;
+        const char* digest;
+    } kat[] = {
+        {"",                                                            1,       "da39a3ee5e6b4b0d3255bfef95601890afd80709"},
+        {"abc",                                                         1,       "a9993e364706816aba3e25717850c26c9cd0d89d"},
+        {"abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",    1,       "84983e441c3bd26ebaae4aa1f95129e5e54670f1"},
+        {"a",                                                           1000000, "34aa973cd4c4daa4f61eeb2bdbad27316534016f"},
+    };
+    static uint8_t buf[4096];
+    SHA1Context sha;
+    uint8_t digest[SHA1HashSize];
+    uint8_t digest_compact[SHA1HashSize];
+    uint8_t digest_ref[SHA1HashSize];
+    uint8_t expect[SHA1HashSize];
+    uint32_t fails = 0;
+
+    for(uint32_t idx = 0; idx < sizeof(kat)/sizeof(kat[0]); idx++)
+    {
+        uint32_t len = strlen(kat[idx].text);
+        SHA1Context sha_compact;
+
+        cpt_check_hex(kat[idx].digest, expect, SHA1HashSize);
+        SHA1Reset(&sha);
+        SHA1Reset_compact(&sha_compact);
+        for(uint32_t rep = 0; rep < kat[idx].count; rep++) {
+            SHA1Input(&sha, (const uint8_t*)kat[idx].text, len);
+            SHA1Input_compact(&sha_compact, (const uint8_t*)kat[idx].text, len);
+        }
+        SHA1Result(&sha, digest);
+        SHA1Result_compact(&sha_compact, digest_compact);
+        bool ok = (memcmp(digest, expect, SHA1HashSize) == 0);
+        bool ok_compact = (memcmp(digest_compact, expect, SHA1HashSize) == 0);
+        printf("  kat fips180 \"%.8s%s\" x%u: unrolled %s, compact %s\n", kat[idx].text, (len > 8) ? "..." : "",
+            kat[idx].count, ok ? "ok" : "FAIL", ok_compact ? "ok" : "FAIL");
+        fails += !ok + !ok_compact;
+    }
+
+    //random input fed in random chunks against the one-shot reference
+    uint32_t diffs = 0;
+    for(uint32_t iter = 0; iter < s_iterations; iter++)
+    {
+        uint32_t len = cpt_check_rand() % ((iter & 0x07) ? 300 : sizeof(buf));
+        SHA1Context sha_compact;
+
+        cpt_check_rand_buf(buf, len);
+        cpt_check_sha1_ref(buf, len, digest_ref);
+
+        SHA1Reset(&sha);
+        SHA1Reset_compact(&sha_compact);
+        for(uint32_t pos = 0; pos < len; )
+        {
+            uint32_t chunk = cpt_check_rand() % 130;
+            if(chunk > len - pos) {
+                chunk = len - pos;
+            }
+            SHA1Input(&sha, &buf[pos], chunk);
+            SHA1Input_compact(&sha_compact, &buf[pos], chunk);
+            pos += chunk;
+        }
+        SHA1Result(&sha, digest);
+        SHA1Result_compact(&sha_compact, digest_compact);
+        diffs += (memcmp(digest, digest_ref, SHA1HashSize) != 0) || (memcmp(digest_compact, digest_ref, SHA1HashSize) != 0);
+
+        //midstate after whole blocks, resumed in a fresh context
+        uint32_t blocks = len/64;
+        uint32_t midstate[SHA1HashSize/4];
+        SHA1Reset(&sha);
+        SHA1Input(&sha, buf, blocks*64);
+        SHA1GetMidstate(&sha, midstate);
+        memset(&sha, 0xA5, sizeof(sha));
+        SHA1SetMidstate(&sha, midstate, blocks);
+        SHA1Input(&sha, &buf[blocks*64], len - blocks*64);
+        SHA1Result(&sha, digest);
+        diffs += (memcmp(digest, digest_ref, SHA1HashSize) != 0);
+    }
+    printf("  random: %u inputs (chunked, compact, midstate), %u differ\n", s_iterations, diffs);
+    fails += diffs;
+
+    //throughput on 4 KB buffers
+    uint64_t bytes_fast = 0, bytes_compact = 0, bytes_ref = 0;
+    double start = cpt_check_now_us();
+    while(cpt_check_now_us() - start < CPT_CHECK_BENCH_MS*1000) {
+        SHA1(buf, sizeof(buf), digest);
+        bytes_fast += sizeof(buf);
+    }
+    double fast_mbs = bytes_fast/(cpt_check_now_us() - start);
+    start = cpt_check_now_us();
+    while(cpt_check_now_us() - start < CPT_CHECK_BENCH_MS*1000) {
+        SHA1_compact(buf, sizeof(buf), digest);
+        bytes_compact += sizeof(buf);
+    }
+    double compact_mbs = bytes_compact/(cpt_check_now_us() - start);
+    start = cpt_check_now_us();
+    while(cpt_check_now_us() - start < CPT_CHECK_BENCH_MS*1000) {
+        cpt_check_sha1_ref(buf, sizeof(buf), digest);
+        bytes_ref += sizeof(buf);
+    }
+    double ref_mbs = bytes_ref/(cpt_check_now_us() - start);
+    printf("  speed: unrolled %.0f MB/s, compact %.0f MB/s, textbook %.0f MB/s\n", fast_mbs, compact_mbs, ref_mbs);
+
+    return (fails == 0);
+}
+
+/*********************************************************
+FN: bit-serial CRC-16/MODBUS, the loop cpt_crc16_compute() had before the tables
+*/
+static uint16_t cpt_check_crc16_ref(const uint8_t* buf, uint32_t size, uint16_t crc)
+{
+    uint16_t poly[2] = {0, 0xa001};
+
+    for(uint32_t idx = 0; idx < size; idx++)
+    {
+        uint8_t ds = buf[idx];
+        for(uint32_t bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ poly[(crc ^ ds) & 1];
+            ds >>= 1;
+        }
+    }
+    return crc;
+}
+
+/*********************************************************
+FN: bit-serial CRC-32/ISO-HDLC, the loop cpt_crc32_compute() had before the tables
+*/
+static uint32_t cpt_check_crc32_ref(const uint8_t* buf, uint32_t size)
+{
+    uint32_t crc = 0xFFFFFFFF;
+
+    for(uint32_t idx = 0; idx < size; idx++)
+    {
+        crc ^= buf[idx];
+        for(uint32_t bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320U & ((crc & 1) ? 0xFFFFFFFF : 0));
+        }
+    }
+    return ~crc;
+}
+
+/*********************************************************
+FN:
+*/
+static bool cpt_check_crc(void)
+{
+    static const struct {
+        const char* name;
+        uint16_t (*crc16)(uint8_t* buf, uint16_t size, uint16_t* p_crc);
+        uint32_t (*crc32)(uint8_t* buf, uint32_t size, uint32_t* p_crc);
+    } variant[] = {
+        {"byte",    cpt_crc16_compute,          cpt_crc32_compute},
+        {"nibble",  cpt_crc16_compute_nibble,   cpt_crc32_compute_nibble},
+        {"slice4",  cpt_crc16_compute_slice4,   cpt_crc32_compute_slice4},
+    };
+    //reveng catalogue check values, the empty input, a second published crc32, -1: none
+    static const struct {
+        const char* text;
+        int32_t     crc16;
+        uint32_t    crc32;
+    } kat[] = {
+        {"123456789",                                       0x4B37, 0xCBF43926},
+        {"",                                                0xFFFF, 0x00000000},
+        {"The quick brown fox jumps over the lazy dog",     -1,     0x414FA339},
+    };
+    static volatile uint32_t sink;
+    static uint8_t buf[4096 + 3];
+    uint32_t fails = 0;
+
+    for(uint32_t var = 0; var < sizeof(variant)/sizeof(variant[0]); var++)
+    {
+        uint32_t kat_fails = 0;
+        for(uint32_t idx = 0; idx < sizeof(kat)/sizeof(kat[0]); idx++)
+        {
+            uint32_t len = strlen(kat[idx].text);
+            memcpy(buf, kat[idx].text, len);
+            if(kat[idx].crc16 >= 0) {
+                kat_fails += (variant[var].crc16(buf, len, NULL) != kat[idx].crc16);
+            }
+            kat_fails += (variant[var].crc32(buf, len, NULL) != kat[idx].crc32);
+        }
+
+        //random length and alignment, whole and chained over 1-3 random splits
+        uint32_t diffs = 0;
+        for(uint32_t iter = 0; iter < s_iterations; iter++)
+        {
+            uint32_t len = cpt_check_rand() % ((iter & 0x07) ? 300 : 4096);
+            uint8_t* data = &buf[cpt_check_rand() % 4];
+
+            cpt_check_rand_buf(data, len);
+            uint16_t ref16 = cpt_check_crc16_ref(data, len, 0xffff);
+            uint32_t ref32 = cpt_check_crc32_ref(data, len);
+            diffs += (variant[var].crc16(data, len, NULL) != ref16);
+            diffs += (variant[var].crc32(data, len, NULL) != ref32);
+
+            //what a NULL p_crc starts from
+            uint16_t crc16 = 0xffff;
+            uint32_t crc32 = 0;
+            uint32_t pos = 0;
+            for(uint32_t part = 1 + cpt_check_rand() % 3; part > 0; part--)
+            {
+                uint32_t chunk = (part == 1) ? (len - pos) : (cpt_check_rand() % (len - pos + 1));
+                crc16 = variant[var].crc16(&data[pos], chunk, &crc16);
+                crc32 = variant[var].crc32(&data[pos], chunk, &crc32);
+                pos += chunk;
+            }
+            diffs += (crc16 != ref16) + (crc32 != ref32);
+        }
+
+        uint64_t bytes = 0;
+        double start = cpt_check_now_us();
+        while(cpt_check_now_us() - start < CPT_CHECK_BENCH_MS*1000) {
+            sink = variant[var].crc32(buf, 4096, NULL);
+            bytes += 4096;
+        }
+        double mbs = bytes/(cpt_check_now_us() - start);
+
+        printf("  %-6s: kat %s, random %u inputs %u differ, crc32 %.0f MB/s\n", variant[var].name,
+            (kat_fails == 0) ? "ok" : "FAIL", s_iterations, diffs, mbs);
+        fails += kat_fails + diffs;
+    }
+
+    uint64_t bytes = 0;
+    double start = cpt_check_now_us();
+    while(cpt_check_now_us() - start < CPT_CHECK_BENCH_MS*1000) {
+        sink = cpt_check_crc32_ref(buf, 4096);
+        bytes += 4096;
+    }
+    printf("  bit-serial crc32 %.0f MB/s\n", bytes/(cpt_check_now_us() - start));
+    (void)sink;
+
+    return (fails == 0);
+}
+
+/*********************************************************
+FN: the port before the cache, one context per call
+*/
+static void cpt_check_aes_ref(const uint8_t* key, int mode, uint8_t* iv, const uint8_t* in, uint32_t len, uint8_t* out)
+{
+    cpt_aes_ctx_t ctx;
+
+    cpt_aes_init(&ctx);
+    if(mode == CPT_AES_ENCRYPT) {
+        cpt_aes_setkey_enc(&ctx, key, 128);
+    } else {
+        cpt_aes_setkey_dec(&ctx, key, 128);
+    }
+    if(iv != NULL) {
+        cpt_aes_crypt_cbc(&ctx, mode, len, iv, in, out);
+    } else {
+        for(uint32_t pos = 0; pos < len; pos += 16) {
+            cpt_aes_crypt_ecb(&ctx, mode, &in[pos], &out[pos]);
+        }
+    }
+    cpt_aes_free(&ctx);
+}
+
+/*********************************************************
+FN: op 0 ecb enc, 1 ecb dec, 2 cbc enc, 3 cbc dec
+*/
+static bool cpt_check_aes_port(uint32_t op, uint8_t* key, uint8_t* iv, uint8_t* in, uint32_t len, uint8_t* out)
+{
+    switch(op)
+    {
+        case 0: return tuya_ble_aes128_ecb_encrypt(key, in, len, out);
+        case 1: return tuya_ble_aes128_ecb_decrypt(key, in, len, out);
+        case 2: return tuya_ble_aes128_cbc_encrypt(key, iv, in, len, out);
+        default: return tuya_ble_aes128_cbc_decrypt(key, iv, in, len, out);
+    }
+}
+
+/*********************************************************
+FN:
+*/
+static bool cpt_check_aes(void)
+{
+    //FIPS 197 C.1, SP 800-38A F.2.1 (first two blocks)
+    static const char* kat_key[] = {
+        "000102030405060708090a0b0c0d0e0f",
+        "2b7e151628aed2a6abf7158809cf4f3c",
+    };
+    static const char* kat_iv  = "000102030405060708090a0b0c0d0e0f";
+    static const char* kat_ecb_plain  = "00112233445566778899aabbccddeeff";
+    static const char* kat_ecb_cipher = "69c4e0d86a7b0430d8cdb78070b4c55a";
+    static const char* kat_cbc_plain  = "6bc1bee22e409f96e93d7e117393172aae2d8a571e03ac9c9eb76fac45af8e51";
+    static const char* kat_cbc_cipher = "7649abac8119b246cee98e9b12e9197d5086cb9b507219ee95db113a917678b2";
+    static const uint32_t bench_len[] = {16, 32, 64, 128, 256};
+    static volatile uint32_t sink;
+    static uint8_t keys[5][16];
+    static uint8_t in[256], out[256], ref[256], back[256];
+    uint8_t key[16], iv[16], iv0[16], iv_ref[16], expect[32];
+    uint32_t kat_fails = 0;
+    uint32_t diffs = 0;
+
+    //twice, the second round hits the cache
+    tuya_ble_aes128_ctx_cache_clear();
+    for(uint32_t round = 0; round < 2; round++)
+    {
+        cpt_check_hex(kat_key[0], key, 16);
+        cpt_check_hex(kat_ecb_plain, in, 16);
+        cpt_check_hex(kat_ecb_cipher, expect, 16);
+        kat_fails += !tuya_ble_aes128_ecb_encrypt(key, in, 16, out) || (memcmp(out, expect, 16) != 0);
+        kat_fails += !tuya_ble_aes128_ecb_decrypt(key, expect, 16, out) || (memcmp(out, in, 16) != 0);
+
+        cpt_check_hex(kat_key[1], key, 16);
+        cpt_check_hex(kat_cbc_plain, in, 32);
+        cpt_check_hex(kat_cbc_cipher, expect, 32);
+        cpt_check_hex(kat_iv, iv, 16);
+        kat_fails += !tuya_ble_aes128_cbc_encrypt(key, iv, in, 32, out) || (memcmp(out, expect, 32) != 0);
+        kat_fails += (memcmp(iv, &expect[16], 16) != 0);
+        cpt_check_hex(kat_iv, iv, 16);
+        kat_fails += !tuya_ble_aes128_cbc_decrypt(key, iv, expect, 32, out) || (memcmp(out, in, 32) != 0);
+        kat_fails += (memcmp(iv, &expect[16], 16) != 0);
+    }
+    kat_fails += (tuya_ble_aes128_ecb_encrypt(key, in, 17, out) != false);
+    kat_fails += (tuya_ble_aes128_cbc_decrypt(key, iv, in, 8, out) != false);
+
+    //more keys than slots, a key rewritten in place under the same pointer, clear at random
+    for(uint32_t idx = 0; idx < sizeof(keys)/sizeof(keys[0]); idx++) {
+        cpt_check_rand_buf(keys[idx], 16);
+    }
+    for(uint32_t iter = 0; iter < s_iterations*10; iter++)
+    {
+        uint32_t op = cpt_check_rand() % 4;
+        uint8_t* p_key = keys[cpt_check_rand() % (sizeof(keys)/sizeof(keys[0]))];
+        uint32_t len = 16*(1 + cpt_check_rand() % 16);
+        int mode = ((op & 1) == 0) ? CPT_AES_ENCRYPT : CPT_AES_DECRYPT;
+
+        if((cpt_check_rand() % 64) == 0) {
+            cpt_check_rand_buf(p_key, 16);
+        }
+        if((cpt_check_rand() % 256) == 0) {
+            tuya_ble_aes128_ctx_cache_clear();
+        }
+        cpt_check_rand_buf(in, len);
+        cpt_check_rand_buf(iv0, 16);
+        memcpy(iv, iv0, 16);
+        memcpy(iv_ref, iv0, 16);
+
+        cpt_check_aes_ref(p_key, mode, (op >= 2) ? iv_ref : NULL, in, len, ref);
+        diffs += !cpt_check_aes_port(op, p_key, iv, in, len, out);
+        diffs += (memcmp(out, ref, len) != 0);
+        diffs += (op >= 2) && (memcmp(iv, iv_ref, 16) != 0);
+
+        //and back the other way from the same iv
+        memcpy(iv, iv0, 16);
+        diffs += !cpt_check_aes_port(op ^ 1, p_key, iv, ref, len, back);
+        diffs += (memcmp(back, in, len) != 0);
+    }
+    printf("  kat %s, random %u calls over %u keys %u differ\n", (kat_fails == 0) ? "ok" : "FAIL",
+        s_iterations*20, (uint32_t)(sizeof(keys)/sizeof(keys[0])), diffs);
+
+    //one session key, a frame each call: cached against a setkey per call
+    for(uint32_t idx = 0; idx < sizeof(bench_len)/sizeof(bench_len[0]); idx++)
+    {
+        uint32_t len = bench_len[idx];
+        uint64_t calls[2] = {0, 0};
+        double ns[2];
+
+        for(uint32_t path = 0; path < 2; path++)
+        {
+            double start = cpt_check_now_us();
+            while(cpt_check_now_us() - start < CPT_CHECK_BENCH_MS*1000) {
+                if(path == 0) {
+                    tuya_ble_aes128_cbc_encrypt(keys[0], iv, in, len, out);
+                } else {
+                    cpt_check_aes_ref(keys[0], CPT_AES_ENCRYPT, iv, in, len, out);
+                }
+                sink = out[0];
+                calls[path]++;
+            }
+            ns[path] = (cpt_check_now_us() - start)*1000/calls[path];
+        }
+        printf("  cbc %3u B: cached %.0f ns, setkey per call %.0f ns\n", len, ns[0], ns[1]);
+    }
+    (void)sink;
+
+    return (kat_fails + diffs) == 0;
+}
@@ -0,0 +1,42 @@
+#!/bin/sh
+# Build the host known-answer / equivalence checks of src/cpt and run them, options are
+# passed on (cpt_check.sh -h).
+#
+#   CPT_CHECK_OUT  build directory, /tmp/cpt_check by default
+#   CC             host compiler, cc by default
+#
+# The sources are the ones the keil project builds, unchanged. Timings are of the host,
+# only the ratios between two paths carry over to the chip.
+set -e
+
+HERE=$(cd "$(dirname "$0")" && pwd)
+SRC=$HERE/../../src
+MBEDTLS=$SRC/cpt/mbedtls-2.16.1
+FPE=$SRC/cpt/fpe_tuya
+OUT=${CPT_CHECK_OUT:-/tmp/cpt_check}
+
+CFLAGS="-O2 -Wall -Wno-unused-function -DUSED_STDLIB_MEMALLOC \
+    -I$HERE/stub -I$SRC/cpt/cpt_math -I$SRC/cpt/cpt_crypto -I$SRC/cpt/hash -I$MBEDTLS/include -I$FPE"
+
+mkdir -p "$OUT"
+
+#the crc tables the default build (CPT_CRC_TABLE_BYTE) does not use
+${CC:-cc} $CFLAGS -DCPT_CRC_TABLE=CPT_CRC_TABLE_NIBBLE -DCPT_CHECK_CRC_SUFFIX=_nibble \
+    -c "$HERE/cpt_check_crc_variant.c" -o "$OUT/crc_nibble.o"
+${CC:-cc} $CFLAGS -DCPT_CRC_TABLE=CPT_CRC_TABLE_SLICE4 -DCPT_CHECK_CRC_SUFFIX=_slice4 \
+    -c "$HERE/cpt_check_crc_variant.c" -o "$OUT/crc_slice4.o"
+
+#the aes hooks of the tuya port, the rest of the file (bk calls) is dropped at link
+${CC:-cc} $CFLAGS -D__ASM=__asm__ -ffunction-sections -fdata-sections \
+    -I$SRC/tuya_ble_sdk/include -I$SRC/tuya_ble_sdk/port \
+    -c "$SRC/tuya_ble_sdk/port/tuya_ble_port_bk3431q.c" -o "$OUT/tuya_ble_port.o"
+
+${CC:-cc} $CFLAGS -Wl,--gc-sections \
+    "$HERE/cpt_check.c" "$HERE/cpt_check_sha1_compact.c" \
+    "$FPE/ff1.c" "$FPE/fpe_str.c" "$FPE/fpe_math.c" "$FPE/fpe_cipher.c" \
+    "$SRC/cpt/cpt_math/cpt_math.c" "$SRC/cpt/cpt_crypto/cpt_crypto.c" "$SRC/cpt/hash/hmac-sha1.c" "$SRC/cpt/hash/sha1.c" \
+    "$MBEDTLS/library/md5.c" "$MBEDTLS/library/aes.c" "$MBEDTLS/library/platform_util.c" \
+    "$OUT/crc_nibble.o" "$OUT/crc_slice4.o" "$OUT/tuya_ble_port.o" \
+    -o "$OUT/cpt_check"
+
+exec "$OUT/cpt_check" "$@"
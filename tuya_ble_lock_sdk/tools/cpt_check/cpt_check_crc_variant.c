@@ -0,0 +1,23 @@
+/**
+****************************************************************************
+* @file      cpt_check_crc_variant.c
+* @brief     cpt_math.c built with another CPT_CRC_TABLE, under other names, for cpt_check.c
+* @author    suding
+* @version   V1.0.0
+* @date      2020-05-11
+* @note      cpt_check.sh builds it once per table, -DCPT_CHECK_CRC_SUFFIX=_nibble / _slice4
+******************************************************************************
+* @attention
+*
+* <h2><center>&copy; COPYRIGHT 2020 Tuya </center></h2>
+*/
+#define CPT_CHECK_CRC_CAT(a, b)     a##b
+#define CPT_CHECK_CRC_NAME(a, b)    CPT_CHECK_CRC_CAT(a, b)
+
+#define cpt_check_sum               CPT_CHECK_CRC_NAME(cpt_check_sum, CPT_CHECK_CRC_SUFFIX)
+#define cpt_check_sum_16            CPT_CHECK_CRC_NAME(cpt_check_sum_16, CPT_CHECK_CRC_SUFFIX)
+#define cpt_crc16_compute           CPT_CHECK_CRC_NAME(cpt_crc16_compute, CPT_CHECK_CRC_SUFFIX)
+#define cpt_crc32_compute           CPT_CHECK_CRC_NAME(cpt_crc32_compute, CPT_CHECK_CRC_SUFFIX)
+#define cpt_reverse_byte            CPT_CHECK_CRC_NAME(cpt_reverse_byte, CPT_CHECK_CRC_SUFFIX)
+#define cpt_num_array_2_int         CPT_CHECK_CRC_NAME(cpt_num_array_2_int, CPT_CHECK_CRC_SUFFIX)
+#include "cpt_math.c"
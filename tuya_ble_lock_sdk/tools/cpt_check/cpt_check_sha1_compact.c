@@ -0,0 +1,23 @@
+/**
+****************************************************************************
+* @file      cpt_check_sha1_compact.c
+* @brief     sha1.c built a second time with SHA1_COMPACT, under other names, for cpt_check.c
+* @author    suding
+* @version   V1.0.0
+* @date      2020-05-11
+* @note
+******************************************************************************
+* @attention
+*
+* <h2><center>&copy; COPYRIGHT 2020 Tuya </center></h2>
+*/
+#define SHA1_COMPACT
+#define SHA1Reset                   SHA1Reset_compact
+#define SHA1Input                   SHA1Input_compact
+#define SHA1Result                  SHA1Result_compact
+#define SHA1GetMidstate             SHA1GetMidstate_compact
+#define SHA1SetMidstate             SHA1SetMidstate_compact
+#define SHA1PadMessage              SHA1PadMessage_compact
+#define SHA1ProcessMessageBlock     SHA1ProcessMessageBlock_compact
+#define SHA1                        SHA1_compact
+#include "sha1.c"
@@ -0,0 +1,41 @@
+/**
+****************************************************************************
+* @file      app_common.h
+* @brief     cpt_check stand-in for src/app/app_common/app_common.h
+* @author    suding
+* @version   V1.0.0
+* @date      2020-05-11
+* @note      only what cpt_math.c uses
+******************************************************************************
+* @attention
+*
+* <h2><center>&copy; COPYRIGHT 2020 Tuya </center></h2>
+*/
+
+
+#ifndef __APP_COMMON_H__
+#define __APP_COMMON_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*********************************************************************
+ * INCLUDES
+ */
+//c_lib
+#include "stdio.h"
+#include "stdlib.h"
+#include "stdint.h"
+#include "stdbool.h"
+#include "string.h"
+
+#include "cpt_math.h"
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //__APP_COMMON_H__
@@ -0,0 +1,39 @@
+/**
+****************************************************************************
+* @file      app_port.h
+* @brief     cpt_check stand-in for src/app/app_common/app_port.h
+* @author    suding
+* @version   V1.0.0
+* @date      2020-05-11
+* @note      only what tuya_ble_port_bk3431q.c uses
+******************************************************************************
+* @attention
+*
+* <h2><center>&copy; COPYRIGHT 2020 Tuya </center></h2>
+*/
+
+
+#ifndef __APP_PORT_H__
+#define __APP_PORT_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*********************************************************************
+ * INCLUDES
+ */
+#include "stdint.h"
+
+/*********************************************************************
+ * EXTERNAL FUNCTIONS
+ */
+void app_port_factory_test_process(uint8_t* p_in_data, uint16_t in_len, uint8_t* p_out_data, uint16_t* out_len);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //__APP_PORT_H__
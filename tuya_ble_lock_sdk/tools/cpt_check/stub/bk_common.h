@@ -0,0 +1,78 @@
+/**
+****************************************************************************
+* @file      bk_common.h
+* @brief     cpt_check stand-in for src/bk/bk_common.h
+* @author    suding
+* @version   V1.0.0
+* @date      2020-05-11
+* @note      declarations tuya_ble_port_bk3431q.c needs to compile, nothing behind them:
+*            cpt_check only calls the aes hooks, the rest is dropped by --gc-sections
+******************************************************************************
+* @attention
+*
+* <h2><center>&copy; COPYRIGHT 2020 Tuya </center></h2>
+*/
+
+
+#ifndef __BK_COMMON_H__
+#define __BK_COMMON_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*********************************************************************
+ * INCLUDES
+ */
+#include "stdint.h"
+#include "stdbool.h"
+#include "string.h"
+
+/*********************************************************************
+ * CONSTANTS
+ */
+#define BK_BT_ADDR_LEN                    6
+
+typedef enum {
+    BK_TIMER_SINGLE_SHOT,
+    BK_TIMER_REPEATED,
+} bk_timer_mode_t;
+
+typedef void (*bk_timer_handler_t)(void*);
+
+/*********************************************************************
+ * EXTERNAL VARIABLES
+ */
+extern uint32_t                g_adv_data_len;
+extern uint8_t                 g_adv_data[];
+extern uint32_t                g_scan_rsp_len;
+extern uint8_t                 g_scan_rsp[];
+
+/*********************************************************************
+ * EXTERNAL FUNCTIONS
+ */
+void bk_adv_update_advDataAndScanRsp(void);
+void bk_disconnect(void);
+void bk_get_bt_mac_addr(uint8_t *addr, uint8_t len);
+uint32_t bk_ble_notify(uint8_t* buf, uint8_t len);
+void bk_uart1_send(const uint8_t* buf, uint32_t size);
+uint32_t bk_timer_create(void** p_timer_id, uint32_t timeout_value_ms, bk_timer_mode_t mode, bk_timer_handler_t timeout_handler);
+uint32_t bk_timer_delete(void* timer_id);
+uint32_t bk_timer_start(void* timer_id);
+uint32_t bk_timer_stop(void* timer_id);
+void bk_delay_ms(uint32_t ms);
+void bk_delay_us(uint32_t us);
+void bk_system_reset(void);
+void bk_enter_critical(void);
+void bk_exit_critical(void);
+void bk_flash_read(uint32_t addr, uint8_t *buf, uint32_t size);
+void bk_flash_write(uint32_t addr, uint8_t *buf, uint32_t size);
+void bk_flash_erase(uint32_t addr, uint32_t num);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //__BK_COMMON_H__
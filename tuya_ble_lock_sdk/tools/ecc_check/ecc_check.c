@@ -0,0 +1,642 @@
+/**
+****************************************************************************
+* @file      ecc_check.c
+* @brief     host known-answer and equivalence checks of the P-256 engine, build and run with ecc_check.sh
+* @author    suding
+* @version   V1.0.0
+* @date      2020-05-11
+* @note
+*   device: ecc_p256.c, co_job.c and co_list.c of the ble sdk unchanged (ecc_p256.c included
+*           below for its statics) with SECURE_CONNECTIONS forced on, the project builds it
+*           with CFG_SEC_CON off. Kernel heap and messages are stubbed, the jobs run from
+*           co_job_schedule() with the default clock (one step per call).
+*   naf:    ecc_naf_recode256() on edge and random scalars: digits odd and below 2^(w-1) in
+*           magnitude, at most one non-zero digit in any w consecutive ones, sum back to k.
+*   kat:    k*G for k = 1, 2, 3, 2^255, 0x55..55, n-1, the debug key (core spec vol 3 part H
+*           2.3.5.6.1) and another fixed scalar, one ECDH, values from an independent affine
+*           implementation.
+*   random: ecc_gen_new_public_key() / ecc_generate_key256() through the job against the
+*           MSB first double-and-add the engine used before the wNAF, on the same field
+*           primitives, and a*(b*G) == b*(a*G).
+*   jobs:   three multiplications in flight, the middle one aborted, results to the right
+*           tasks and every block freed.
+*   time:   one multiplication through the job, steps and heap of one element, and the
+*           double-and-add reference on the same key.
+******************************************************************************
+* @attention
+*
+* <h2><center>&copy; COPYRIGHT 2020 Tuya </center></h2>
+*/
+#include <getopt.h>
+#include <stdio.h>
+#include <time.h>
+#include "ecc_p256.c"
+
+/*********************************************************************
+ * LOCAL CONSTANTS
+ */
+#define ECC_CHECK_MSG_ID        (0x0A01)
+#define ECC_CHECK_TASK          (0x0010)
+#define ECC_CHECK_MSG_MAX       (8)
+#define ECC_CHECK_STEP_MAX      (ECC_NAF_TABLE_SIZE + ECC_NAF_MAX_DIGITS)
+#define ECC_CHECK_BENCH_MS      (500)
+
+/*********************************************************************
+ * LOCAL STRUCT
+ */
+typedef struct {
+    ke_msg_id_t             id;
+    ke_task_id_t            dest;
+    struct ecc_result_ind   ind;
+} ecc_check_msg_t;
+
+typedef struct {
+    const char* name;
+    const char* k;      //LSB first, like the ecc api
+    const char* x;
+    const char* y;
+} ecc_check_kat_t;
+
+/*********************************************************************
+ * LOCAL VARIABLES
+ */
+static uint32_t s_iterations = 50;
+static uint32_t s_seed = 1;
+static uint32_t s_rand;
+static ecc_check_msg_t* s_msgs[ECC_CHECK_MSG_MAX];
+static uint32_t s_msg_num;
+
+/*********************************************************************
+ * LOCAL FUNCTION
+ */
+static void ecc_check_usage(void);
+static uint32_t ecc_check_rand(void);
+static void ecc_check_rand_key(uint8_t* key);
+static bool ecc_check_hex(const char* hex, uint8_t* buf, uint32_t size);
+static bool ecc_check_naf(void);
+static bool ecc_check_kat(void);
+static bool ecc_check_random(void);
+static bool ecc_check_jobs(void);
+static bool ecc_check_time(void);
+
+static const struct {
+    const char* name;
+    bool (*run)(void);
+} s_checks[] = {
+    {"naf",     ecc_check_naf},
+    {"kat",     ecc_check_kat},
+    {"random",  ecc_check_random},
+    {"jobs",    ecc_check_jobs},
+    {"time",    ecc_check_time},
+};
+
+/*********************************************************************
+ * VARIABLES
+ */
+int32_t ecc_check_mem_blocks;
+
+
+
+
+/*********************************************************
+FN:
+*/
+int main(int argc, char** argv)
+{
+    static const struct option opts[] = {
+        {"check",        required_argument, NULL, 'c'},
+        {"iterations",   required_argument, NULL, 'n'},
+        {"seed",         required_argument, NULL, 'x'},
+        {"help",         no_argument,       NULL, 'h'},
+        {NULL, 0, NULL, 0},
+    };
+    const char* only = NULL;
+    uint32_t fails = 0;
+    uint32_t runs = 0;
+    int opt;
+
+    while((opt = getopt_long(argc, argv, "c:n:x:h", opts, NULL)) != -1)
+    {
+        switch(opt)
+        {
+            case 'c': only = optarg; break;
+            case 'n': s_iterations = strtoul(optarg, NULL, 0); break;
+            case 'x': s_seed = strtoul(optarg, NULL, 0); break;
+            default: ecc_check_usage(); return 2;
+        }
+    }
+    if((optind != argc) || (s_iterations == 0)) {
+        ecc_check_usage();
+        return 2;
+    }
+
+    printf("ECC_NAF_WINDOW %d, ECC_MULT_ALGO_TYPE %d\n", ECC_NAF_WINDOW, ECC_MULT_ALGO_TYPE);
+    co_job_init(false);
+    ecc_init(false);
+    for(uint32_t idx = 0; idx < sizeof(s_checks)/sizeof(s_checks[0]); idx++)
+    {
+        if((only != NULL) && (strcmp(only, s_checks[idx].name) != 0)) {
+            continue;
+        }
+        s_rand = (s_seed != 0) ? s_seed : 0x9E3779B9;
+        srand(s_rand);
+        printf("%s:\n", s_checks[idx].name);
+        bool ok = s_checks[idx].run();
+        printf("%s: %s\n", s_checks[idx].name, ok ? "ok" : "FAIL");
+        fails += !ok;
+        runs++;
+    }
+    if(runs == 0) {
+        ecc_check_usage();
+        return 2;
+    }
+
+    printf("result: %u/%u ok\n", runs - fails, runs);
+    return (fails == 0) ? 0 : 1;
+}
+
+/*********************************************************
+FN:
+*/
+static void ecc_check_usage(void)
+{
+    printf("ecc_check.sh [options]\n"
+           "  -c, --check NAME       run one check:");
+    for(uint32_t idx = 0; idx < sizeof(s_checks)/sizeof(s_checks[0]); idx++) {
+        printf(" %s", s_checks[idx].name);
+    }
+    printf("\n"
+           "  -n, --iterations N     random multiplications (50)\n"
+           "  -x, --seed N           (1)\n");
+}
+
+/*********************************************************
+FN: xorshift32
+*/
+static uint32_t ecc_check_rand(void)
+{
+    s_rand ^= s_rand << 13;
+    s_rand ^= s_rand >> 17;
+    s_rand ^= s_rand << 5;
+    return s_rand;
+}
+
+/*********************************************************
+FN: a secret key ecc_gen_new_secret_key() could have drawn
+*/
+static void ecc_check_rand_key(uint8_t* key)
+{
+    do {
+        for(uint32_t idx = 0; idx < 32; idx++) {
+            key[idx] = ecc_check_rand();
+        }
+    } while(!isValidSecretKey_256(key));
+}
+
+/*********************************************************
+FN:
+*/
+static bool ecc_check_hex(const char* hex, uint8_t* buf, uint32_t size)
+{
+    if(strlen(hex) != size*2) {
+        return false;
+    }
+    for(uint32_t idx = 0; idx < size; idx++) {
+        unsigned int byte;
+        if(sscanf(&hex[idx*2], "%2x", &byte) != 1) {
+            return false;
+        }
+        buf[idx] = byte;
+    }
+    return true;
+}
+
+/*********************************************************
+FN: stubbed kernel
+*/
+void *ke_malloc(uint32_t size, uint8_t type)
+{
+    ecc_check_mem_blocks++;
+    return malloc(size);
+}
+
+void ke_free(void *mem_ptr)
+{
+    ecc_check_mem_blocks--;
+    free(mem_ptr);
+}
+
+void *ke_msg_alloc(ke_msg_id_t const id, ke_task_id_t const dest_id, ke_task_id_t const src_id, uint16_t const param_len)
+{
+    ecc_check_msg_t* msg = calloc(1, sizeof(ecc_check_msg_t));
+
+    msg->id = id;
+    msg->dest = dest_id;
+    return &msg->ind;
+}
+
+void ke_msg_send(void const *param_ptr)
+{
+    ecc_check_msg_t* msg = (ecc_check_msg_t*)((uint8_t*)param_ptr - offsetof(ecc_check_msg_t, ind));
+
+    assert(s_msg_num < ECC_CHECK_MSG_MAX);
+    s_msgs[s_msg_num++] = msg;
+}
+
+/*********************************************************
+FN: take the result sent to a task, false if none
+*/
+static bool ecc_check_msg_take(ke_task_id_t task, uint8_t* x, uint8_t* y)
+{
+    for(uint32_t idx = 0; idx < s_msg_num; idx++)
+    {
+        if(s_msgs[idx]->dest == task)
+        {
+            ecc_check_msg_t* msg = s_msgs[idx];
+            bool ok = (msg->id == ECC_CHECK_MSG_ID);
+
+            memcpy(x, msg->ind.key_res_x, 32);
+            memcpy(y, msg->ind.key_res_y, 32);
+            free(msg);
+            s_msgs[idx] = s_msgs[--s_msg_num];
+            return ok;
+        }
+    }
+    return false;
+}
+
+/*********************************************************
+FN: k*P through the job, as the link layer runs it; returns the steps, 0 if no result
+*/
+static uint32_t ecc_check_mult_job(const uint8_t* k, const uint8_t* px, const uint8_t* py, uint8_t* x, uint8_t* y)
+{
+    uint32_t steps = 0;
+
+    ecc_generate_key256(k, px, py, ECC_CHECK_MSG_ID, ECC_CHECK_TASK);
+    while(co_job_is_pending() && (steps <= ECC_CHECK_STEP_MAX))
+    {
+        co_job_schedule();
+        steps++;
+    }
+    return ecc_check_msg_take(ECC_CHECK_TASK, x, y) ? steps : 0;
+}
+
+/*********************************************************
+FN: LSB first bytes <-> bigHex256, as ecc_generate_key256() / the job completion do
+*/
+static void ecc_check_to_big(const uint8_t* buf, bigHex256* big)
+{
+    initBigNumber256(big);
+    for(int32_t i = 31, j = 1; i >= 0; i -= 4, j++)
+    {
+        big->num[j] = ((u_int32)buf[i] << 24) | ((u_int32)buf[i-1] << 16) | ((u_int32)buf[i-2] << 8) | buf[i-3];
+    }
+    setBigNumberLength256(big);
+    big->sign = 0;
+}
+
+static void ecc_check_from_big(const bigHex256* big, uint8_t* buf)
+{
+    for(int32_t i = 31, j = 1; i >= 0; i -= 4, j++)
+    {
+        buf[i]   = big->num[j] >> 24;
+        buf[i-1] = big->num[j] >> 16;
+        buf[i-2] = big->num[j] >> 8;
+        buf[i-3] = big->num[j];
+    }
+}
+
+/*********************************************************
+FN: k*P, MSB first double-and-add over the same field primitives
+*/
+static void ecc_check_mult_ref(const uint8_t* k, const uint8_t* px, const uint8_t* py, uint8_t* x, uint8_t* y)
+{
+    ECC_Point256 point;
+    ECC_Jacobian_Point256 p, q, tmp;
+
+    ecc_check_to_big(px, &point.x);
+    ecc_check_to_big(py, &point.y);
+    GF_Affine_To_Jacobian_Point_Copy256(&point, &p);
+    GF_Setup_Jacobian_Infinity_Point256(&q);
+
+    for(int32_t bit = 255; bit >= 0; bit--)
+    {
+        if(!Is_Infinite256(&q)) {
+            GF_Jacobian_Point_Double256(&q, &tmp);
+            GF_Jacobian_Point_Copy256(&tmp, &q);
+        }
+        if(k[bit >> 3] & (1 << (bit & 0x07))) {
+            GF_Jacobian_Point_Addition256(&q, &p, &tmp);
+            GF_Jacobian_Point_Copy256(&tmp, &q);
+        }
+    }
+
+    initBigNumber256(&point.x);
+    initBigNumber256(&point.y);
+    GF_Point_Jacobian_To_Affine256(&q, &point.x, &point.y);
+    ecc_check_from_big(&point.x, x);
+    ecc_check_from_big(&point.y, y);
+}
+
+/*********************************************************
+FN:
+*/
+static bool ecc_check_naf_one(const uint8_t* k, uint32_t* p_len)
+{
+    u_int8 naf[(ECC_NAF_MAX_DIGITS + 1) / 2];
+    int32_t digits[ECC_NAF_MAX_DIGITS];
+    int32_t sum[10] = {0};      //LSW first, signed 32 bit limbs, carried at the end
+    uint16_t len = ecc_naf_recode256(k, naf);
+    int32_t last_nonzero = -ECC_NAF_WINDOW;
+
+    *p_len = len;
+    if(len > ECC_NAF_MAX_DIGITS) {
+        return false;
+    }
+    for(int32_t idx = 0; idx < len; idx++)
+    {
+        int32_t digit = (naf[idx >> 1] >> ((idx & 0x1) * 4)) & 0x0F;
+        if(digit & 0x08) {
+            digit -= 0x10;
+        }
+        digits[idx] = digit;
+        if(digit == 0) {
+            continue;
+        }
+        //odd, |d| < 2^(w-1), w-1 zeros after every non-zero digit
+        if(((digit & 0x1) == 0) || (abs(digit) >= (1 << (ECC_NAF_WINDOW - 1)))) {
+            return false;
+        }
+        if(idx - last_nonzero < ECC_NAF_WINDOW) {
+            return false;
+        }
+        last_nonzero = idx;
+    }
+    if((len > 0) && (digits[len - 1] == 0)) {
+        return false;
+    }
+
+    //sum d_i*2^i, 64 bit accumulation per limb
+    int64_t acc[10] = {0};
+    for(int32_t idx = 0; idx < len; idx++) {
+        acc[idx / 32] += (int64_t)digits[idx] << (idx % 32);
+    }
+    int64_t carry = 0;
+    for(uint32_t limb = 0; limb < 10; limb++)
+    {
+        carry += acc[limb];
+        sum[limb] = (int32_t)(uint32_t)carry;
+        carry >>= 32;
+    }
+    for(uint32_t limb = 0; limb < 10; limb++)
+    {
+        uint32_t expect = 0;
+        if(limb < 8) {
+            expect = k[limb*4] | (k[limb*4+1] << 8) | (k[limb*4+2] << 16) | ((uint32_t)k[limb*4+3] << 24);
+        }
+        if((uint32_t)sum[limb] != expect) {
+            return false;
+        }
+    }
+    return (carry == 0);
+}
+
+static bool ecc_check_naf(void)
+{
+    static const char* edge[] = {
+        "0000000000000000000000000000000000000000000000000000000000000000",
+        "0100000000000000000000000000000000000000000000000000000000000000",
+        "0300000000000000000000000000000000000000000000000000000000000000",
+        "0700000000000000000000000000000000000000000000000000000000000000",
+        "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF",
+        "0000000000000000000000000000000000000000000000000000000000000080",
+        "5555555555555555555555555555555555555555555555555555555555555555",
+        "AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA",
+        "502563FCC2CAB9F3849E17A7ADFAE6BCFFFFFFFFFFFFFFFF00000000FFFFFFFF",
+    };
+    uint8_t k[32];
+    uint32_t len, fails = 0;
+    uint32_t len_max = 0;
+
+    for(uint32_t idx = 0; idx < sizeof(edge)/sizeof(edge[0]); idx++)
+    {
+        ecc_check_hex(edge[idx], k, 32);
+        fails += !ecc_check_naf_one(k, &len);
+        len_max = (len > len_max) ? len : len_max;
+    }
+
+    uint32_t random = s_iterations*1000;
+    uint64_t len_sum = 0;
+    for(uint32_t iter = 0; iter < random; iter++)
+    {
+        for(uint32_t idx = 0; idx < 32; idx++) {
+            k[idx] = ecc_check_rand();
+        }
+        fails += !ecc_check_naf_one(k, &len);
+        len_sum += len;
+        len_max = (len > len_max) ? len : len_max;
+    }
+    printf("  %u edge + %u random scalars, %u wrong, digits: %.1f average, %u max\n",
+        (uint32_t)(sizeof(edge)/sizeof(edge[0])), random, fails, (double)len_sum/random, len_max);
+
+    return (fails == 0) && (len_max <= ECC_NAF_MAX_DIGITS);
+}
+
+/*********************************************************
+FN:
+*/
+static bool ecc_check_kat(void)
+{
+    //affine python reference over the curve equation, coordinates LSB first
+    static const ecc_check_kat_t kat[] = {
+        {"1",
+         "0100000000000000000000000000000000000000000000000000000000000000",
+         "96C298D84539A1F4A033EB2D817D0377F240A463E5E6BCF847422CE1F2D1176B",
+         "F551BF376840B6CBCE5E316B5733CE2B169E0F7C4AEBE78E9B7F1AFEE242E34F"},
+        {"2",
+         "0200000000000000000000000000000000000000000000000000000000000000",
+         "78996647FC480BA6351BF277E26989C0C31AB5040338528A7E4F038D187BF27C",
+         "D17378229DB7049E2982E93CE6AD7DBADB30749FC69A3D2940D08EDB10557707"},
+        {"3",
+         "0300000000000000000000000000000000000000000000000000000000000000",
+         "6CFDE7C61B6641FB85A9ADEF21B7C6E665F14B1D95EFF7C8440A33A6D1E4CB5E",
+         "32507DA227B1799A3DB84F3836B02AD8ECA2641ACE064B377EFF98490C643487"},
+        {"2^255",
+         "0000000000000000000000000000000000000000000000000000000000000080",
+         "542B5F378FEC2DB55023E9E36035FE4EBC24158911E9665013236B2E910AB277",
+         "FF67CCD6FC01A8CAF1E050E8A13D62DF728A03DDFC0BB1F7F7A3CE251829DCA3"},
+        {"0x55..55",
+         "5555555555555555555555555555555555555555555555555555555555555555",
+         "34AB62D7D3B747A4FC8286456DF5CA097098ED4228CF7AFEC3337EDBF677E957",
+         "ECC271C49CF5E5684DDBC4DE84FA6D345BFB0F64654041F5DF3B57BA7037ABC5"},
+        {"n-1",
+         "502563FCC2CAB9F3849E17A7ADFAE6BCFFFFFFFFFFFFFFFF00000000FFFFFFFF",
+         "96C298D84539A1F4A033EB2D817D0377F240A463E5E6BCF847422CE1F2D1176B",
+         "0AAE40C897BF493431A1CE94A9CC31D4E961F083B51418716580E5011CBD1CB0"},
+        {"debug",
+         "BD1A3CCDA6B8995899B740EB7B60FF4A503F10D2E3B3C974385FC5A3D4F6493F",
+         "E69D350E480103CCDBFDF4AC1191F4EFB9A5F9E9A7832C5E2CBE97F2D203B020",
+         "8BD28915D08E1C742430ED8FC24563765C15525ABF9A32636DEB2A65499C80DC"},
+        {"0x1234..",
+         "EFCDAB9078563412EFCDAB9078563412EFCDAB9078563412EFCDAB9078563412",
+         "4C71FA6DD7B0E7F8D25BD25707EBAD24F5D08E11537EBA5B2804498C753E1C47",
+         "58A8F7092DA125DC02E7828385ADE3BBC9F0E81DF537CC7A918B8ACA7A0F52DD"},
+    };
+    //the debug key times b*G, b = 0x55188B3D..F47FC5FD
+    static const ecc_check_kat_t dh = {"ecdh",
+         "BD1A3CCDA6B8995899B740EB7B60FF4A503F10D2E3B3C974385FC5A3D4F6493F",
+         "98A6BF73F3348D86F166F8B4136B79999B7D390AA610103405ADC857A33402EC",
+         "B1E2E7DC7DFBBDF1C771240393D40D5E19509FA1EC2F9869B6796E6D5EC29710"};
+    static const char* dh_peer_x = "90A1AA2FB27790559FA61586FD8AB547004C9EF184225909961DAF1FF0F0A11E";
+    static const char* dh_peer_y = "4A21B115F9AF895F76368EE230112D476051B89A3A70567337AD9D423EF3554C";
+    uint8_t k[32], x[32], y[32], expect_x[32], expect_y[32], px[32], py[32];
+    uint32_t fails = 0;
+
+    for(uint32_t idx = 0; idx <= sizeof(kat)/sizeof(kat[0]); idx++)
+    {
+        const ecc_check_kat_t* p_kat = (idx < sizeof(kat)/sizeof(kat[0])) ? &kat[idx] : &dh;
+        if(p_kat == &dh) {
+            ecc_check_hex(dh_peer_x, px, 32);
+            ecc_check_hex(dh_peer_y, py, 32);
+        } else {
+            memcpy(px, BasePoint_x_256, 32);
+            memcpy(py, BasePoint_y_256, 32);
+        }
+        ecc_check_hex(p_kat->k, k, 32);
+        ecc_check_hex(p_kat->x, expect_x, 32);
+        ecc_check_hex(p_kat->y, expect_y, 32);
+
+        uint32_t steps = ecc_check_mult_job(k, px, py, x, y);
+        bool ok = (steps != 0) && (memcmp(x, expect_x, 32) == 0) && (memcmp(y, expect_y, 32) == 0);
+        printf("  %-9s %s, %u steps\n", p_kat->name, ok ? "ok" : "FAIL", steps);
+        fails += !ok;
+    }
+
+    //the debug keys the stack hands out
+    uint8_t dbg_k[32], dbg_x[32], dbg_y[32];
+    ecc_get_debug_Keys(dbg_k, dbg_x, dbg_y);
+    ecc_check_hex(kat[6].x, expect_x, 32);
+    ecc_check_hex(kat[6].y, expect_y, 32);
+    fails += (memcmp(dbg_x, expect_x, 32) != 0) || (memcmp(dbg_y, expect_y, 32) != 0);
+
+    return (fails == 0) && (ecc_check_mem_blocks == 0);
+}
+
+/*********************************************************
+FN:
+*/
+static bool ecc_check_random(void)
+{
+    uint8_t a[32], b[32];
+    uint8_t ax[32], ay[32], bx[32], by[32];
+    uint8_t x[32], y[32], ref_x[32], ref_y[32], x2[32], y2[32];
+    uint32_t diffs = 0, dh_diffs = 0;
+    uint64_t steps = 0;
+
+    for(uint32_t iter = 0; iter < s_iterations; iter++)
+    {
+        if(iter & 0x1) {
+            ecc_gen_new_secret_key(a, false);   //co_rand_word(), srand(seed)
+        } else {
+            ecc_check_rand_key(a);
+        }
+        ecc_check_rand_key(b);
+
+        //public keys: the job against the reference
+        steps += ecc_check_mult_job(a, BasePoint_x_256, BasePoint_y_256, ax, ay);
+        ecc_check_mult_ref(a, BasePoint_x_256, BasePoint_y_256, ref_x, ref_y);
+        diffs += (memcmp(ax, ref_x, 32) != 0) || (memcmp(ay, ref_y, 32) != 0);
+        ecc_check_mult_job(b, BasePoint_x_256, BasePoint_y_256, bx, by);
+
+        //shared key, both ways and against the reference
+        ecc_check_mult_job(a, bx, by, x, y);
+        ecc_check_mult_job(b, ax, ay, x2, y2);
+        ecc_check_mult_ref(a, bx, by, ref_x, ref_y);
+        dh_diffs += (memcmp(x, x2, 32) != 0) || (memcmp(y, y2, 32) != 0);
+        diffs += (memcmp(x, ref_x, 32) != 0) || (memcmp(y, ref_y, 32) != 0);
+    }
+    printf("  %u key pairs: %u differ from double-and-add, %u dh mismatches, %.1f steps per public key\n",
+        s_iterations, diffs, dh_diffs, (double)steps/s_iterations);
+
+    return (diffs == 0) && (dh_diffs == 0) && (ecc_check_mem_blocks == 0);
+}
+
+/*********************************************************
+FN:
+*/
+static bool ecc_check_jobs(void)
+{
+    uint8_t k[3][32], x[32], y[32], ref_x[32], ref_y[32];
+    uint32_t fails = 0;
+    uint32_t steps = 0;
+
+    for(uint32_t idx = 0; idx < 3; idx++) {
+        ecc_check_rand_key(k[idx]);
+        ecc_generate_key256(k[idx], BasePoint_x_256, BasePoint_y_256, ECC_CHECK_MSG_ID, ECC_CHECK_TASK + idx);
+    }
+    //a few steps in, then drop the middle one
+    for(uint32_t idx = 0; idx < 40; idx++) {
+        co_job_schedule();
+    }
+    ecc_abort_key256_generation(ECC_CHECK_TASK + 1);
+    while(co_job_is_pending() && (steps <= 3*ECC_CHECK_STEP_MAX)) {
+        co_job_schedule();
+        steps++;
+    }
+
+    for(uint32_t idx = 0; idx < 3; idx++)
+    {
+        bool got = ecc_check_msg_take(ECC_CHECK_TASK + idx, x, y);
+        if(idx == 1) {
+            fails += got;
+            continue;
+        }
+        ecc_check_mult_ref(k[idx], BasePoint_x_256, BasePoint_y_256, ref_x, ref_y);
+        fails += !got || (memcmp(x, ref_x, 32) != 0) || (memcmp(y, ref_y, 32) != 0);
+    }
+    fails += (s_msg_num != 0) || !co_list_is_empty(&ecc_env.ongoing_mul);
+
+    //reset with one in flight
+    ecc_generate_key256(k[0], BasePoint_x_256, BasePoint_y_256, ECC_CHECK_MSG_ID, ECC_CHECK_TASK);
+    co_job_schedule();
+    ecc_init(true);
+    co_job_init(true);
+    fails += co_job_is_pending();
+
+    printf("  3 in flight, 1 aborted, 1 reset: %u wrong, %d blocks left\n", fails, ecc_check_mem_blocks);
+    return (fails == 0) && (ecc_check_mem_blocks == 0);
+}
+
+/*********************************************************
+FN:
+*/
+static bool ecc_check_time(void)
+{
+    static const char* key = "BD1A3CCDA6B8995899B740EB7B60FF4A503F10D2E3B3C974385FC5A3D4F6493F";
+    uint8_t k[32], x[32], y[32];
+    uint32_t runs = 0, steps = 0;
+    struct timespec t0, t1;
+
+    ecc_check_hex(key, k, 32);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    do {
+        steps = ecc_check_mult_job(k, BasePoint_x_256, BasePoint_y_256, x, y);
+        runs++;
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+    } while(((t1.tv_sec - t0.tv_sec)*1000 + (t1.tv_nsec - t0.tv_nsec)/1000000) < ECC_CHECK_BENCH_MS);
+    double us = ((t1.tv_sec - t0.tv_sec)*1e6 + (t1.tv_nsec - t0.tv_nsec)/1e3)/runs;
+
+    uint32_t ref_runs = 0;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    do {
+        ecc_check_mult_ref(k, BasePoint_x_256, BasePoint_y_256, x, y);
+        ref_runs++;
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+    } while(((t1.tv_sec - t0.tv_sec)*1000 + (t1.tv_nsec - t0.tv_nsec)/1000000) < ECC_CHECK_BENCH_MS);
+    double ref_us = ((t1.tv_sec - t0.tv_sec)*1e6 + (t1.tv_nsec - t0.tv_nsec)/1e3)/ref_runs;
+
+    printf("  debug key * G: %.0f us, %u steps (%.1f us each), element %u B of heap\n",
+        us, steps, us/steps, (uint32_t)sizeof(struct ecc_elt_tag));
+    printf("  double-and-add: %.0f us, x%.2f\n", ref_us, ref_us/us);
+    return (steps != 0);
+}
@@ -0,0 +1,30 @@
+#!/bin/sh
+# Build the host checks of the P-256 engine (ble sdk ecc_p256.c) for every NAF window and
+# run them, options are passed on (ecc_check.sh -h).
+#
+#   ECC_CHECK_OUT      build directory, /tmp/ecc_check by default
+#   ECC_CHECK_WINDOWS  ECC_NAF_WINDOW values built, "2 3 4" by default (3 is the default)
+#   CC                 host compiler, cc by default
+#
+# The project builds ecc_p256.c with CFG_SEC_CON off, stub/rwip_config.h turns
+# SECURE_CONNECTIONS on. Timings are of the host, only the ratios between windows carry
+# over to the chip.
+set -e
+
+HERE=$(cd "$(dirname "$0")" && pwd)
+COM=$HERE/../../../ble_3435_sdk_ext_39_0F0E/sdk/plactform/com
+OUT=${ECC_CHECK_OUT:-/tmp/ecc_check}
+
+mkdir -p "$OUT"
+
+fails=0
+for w in ${ECC_CHECK_WINDOWS:-2 3 4}
+do
+    ${CC:-cc} -O2 -Wall -Wno-unused-function -Wno-unused-variable -Wno-misleading-indentation -Wno-restrict -DECC_NAF_WINDOW=$w \
+        -I"$HERE/stub" -I"$COM/api" -I"$COM/src" \
+        "$HERE/ecc_check.c" "$COM/src/co_job.c" "$COM/src/co_list.c" \
+        -o "$OUT/ecc_check_w$w"
+    "$OUT/ecc_check_w$w" "$@" || fails=$((fails + 1))
+done
+
+exit $fails
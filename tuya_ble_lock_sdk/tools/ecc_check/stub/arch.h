@@ -0,0 +1,11 @@
+//ecc_check: host build of ecc_p256/co_list
+#ifndef _ARCH_H_
+#define _ARCH_H_
+
+#include <assert.h>
+
+#define ASSERT_ERR(cond)              assert(cond)
+#define ASSERT_INFO(cond, p0, p1)     assert(cond)
+#define ASSERT_WARN(cond, p0, p1)
+
+#endif //_ARCH_H_
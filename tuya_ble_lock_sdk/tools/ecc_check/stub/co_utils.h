@@ -0,0 +1,14 @@
+//ecc_check: host build of ecc_p256, only what it uses of co_utils.h
+#ifndef _CO_UTILS_H_
+#define _CO_UTILS_H_
+
+#include <stdint.h>
+#include <string.h>
+#include "compiler.h"
+
+__INLINE void co_write32p(void const *ptr32, uint32_t value)
+{
+    memcpy((void *)ptr32, &value, sizeof(value));
+}
+
+#endif //_CO_UTILS_H_
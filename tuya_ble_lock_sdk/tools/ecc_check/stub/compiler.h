@@ -0,0 +1,7 @@
+//ecc_check: host build of ecc_p256/co_job/co_list
+#ifndef _COMPILER_H_
+#define _COMPILER_H_
+
+#define __INLINE static inline
+
+#endif //_COMPILER_H_
@@ -0,0 +1,7 @@
+//ecc_check: host build of ecc_p256, no diagnostic port
+#ifndef DBG_SWDIAG_H_
+#define DBG_SWDIAG_H_
+
+#define DBG_SWDIAG(bank, field, value)
+
+#endif //DBG_SWDIAG_H_
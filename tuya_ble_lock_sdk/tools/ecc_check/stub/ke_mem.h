@@ -0,0 +1,14 @@
+//ecc_check: host build of ecc_p256, the kernel heap is malloc, allocations are counted
+#ifndef _KE_MEM_H_
+#define _KE_MEM_H_
+
+#include <stdint.h>
+
+#define KE_MEM_NON_RETENTION      2
+
+extern int32_t ecc_check_mem_blocks;
+
+void *ke_malloc(uint32_t size, uint8_t type);
+void ke_free(void *mem_ptr);
+
+#endif //_KE_MEM_H_
@@ -0,0 +1,18 @@
+//ecc_check: host build of ecc_p256, messages are collected by ecc_check.c
+#ifndef _KE_TASK_H_
+#define _KE_TASK_H_
+
+#include <stdint.h>
+
+typedef uint16_t ke_msg_id_t;
+typedef uint16_t ke_task_id_t;
+
+#define TASK_NONE                 ((ke_task_id_t) 0xFFFF)
+
+#define KE_MSG_ALLOC(id, dest, src, param_str) \
+    (struct param_str*) ke_msg_alloc(id, dest, src, sizeof(struct param_str))
+
+void *ke_msg_alloc(ke_msg_id_t const id, ke_task_id_t const dest_id, ke_task_id_t const src_id, uint16_t const param_len);
+void ke_msg_send(void const *param_ptr);
+
+#endif //_KE_TASK_H_
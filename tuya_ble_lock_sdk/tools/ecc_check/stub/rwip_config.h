@@ -0,0 +1,11 @@
+//ecc_check: host build of ecc_p256/co_job/co_list, no radio
+#ifndef RWIP_CONFIG_H_
+#define RWIP_CONFIG_H_
+
+#define BLE_EMB_PRESENT           0
+#define SECURE_CONNECTIONS        (1)
+#ifndef ECC_MULT_ALGO_TYPE
+#define ECC_MULT_ALGO_TYPE        (32)
+#endif
+
+#endif //RWIP_CONFIG_H_
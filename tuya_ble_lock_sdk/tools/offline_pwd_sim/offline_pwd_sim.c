@@ -0,0 +1,489 @@
+/**
+****************************************************************************
+* @file      offline_pwd_sim.c
+* @brief     host test of the offline pwd slot table, build and run with offline_pwd_sim.sh
+* @author    suding
+* @version   V1.0.0
+* @date      2020-05-11
+* @note
+*   device: lock_offline_pwd.c unchanged (included below for its statics), app_port replaced
+*           by a nv store that survives lock_offline_pwd_init() like flash does.
+*   history: random stores as lock_offline_pwd_verify() does them (find + save), single
+*           clears, clear-all (epoch, also past the wrap), deletes, reboots, T0 changes and
+*           a clock that only moves forward.
+*   check:  before every step lock_offline_pwd_find() (free list + heaps) is compared with a
+*           linear scan of the slot table written from the documented policy:
+*             1. the lowest unused slot
+*             2. else the expired entry (T3 < T_now) with the earliest T3
+*             3. else timeliness invalid by T3, timeliness valid by T2, single by T3,
+*                clear-all by T3
+*           ties go to the lower slot. The hash lookup is checked against a scan as well.
+*           The first-in-slot-order pick of the old scan (expired) is counted, not checked:
+*           that is the behaviour the heaps changed on purpose.
+******************************************************************************
+* @attention
+*
+* <h2><center>&copy; COPYRIGHT 2020 Tuya </center></h2>
+*/
+#include <getopt.h>
+#include "lock_offline_pwd.c"
+
+/*********************************************************************
+ * LOCAL CONSTANTS
+ */
+#define OFFLINE_PWD_SIM_NV_ID_MAX       (OFFLINE_PWD_MAX_NUM)
+#define OFFLINE_PWD_SIM_NV_LEN          (8)
+#define OFFLINE_PWD_SIM_PWD_RANGE       (1000)
+
+/*********************************************************************
+ * LOCAL STRUCT
+ */
+typedef struct {
+    uint32_t steps;
+    uint32_t runs;
+    uint32_t seed;
+} offline_pwd_sim_cfg_t;
+
+typedef struct {
+    uint32_t finds;
+    uint32_t free_picks;
+    uint32_t expired_picks;
+    uint32_t evict_picks;
+    uint32_t legacy_diffs;
+    uint32_t stores;
+    uint32_t clears;
+    uint32_t epochs;
+    uint32_t deletes;
+    uint32_t reboots;
+    uint32_t mismatches;
+} offline_pwd_sim_stats_t;
+
+/*********************************************************************
+ * LOCAL VARIABLES
+ */
+static offline_pwd_sim_cfg_t s_cfg = {
+    .steps = 20000,
+    .runs  = 20,
+    .seed  = 1,
+};
+static offline_pwd_sim_stats_t s_stats;
+static uint32_t s_rand;
+static uint32_t s_now;
+
+static uint8_t s_nv[SF_AREA_MAX][OFFLINE_PWD_SIM_NV_ID_MAX][OFFLINE_PWD_SIM_NV_LEN];
+static bool    s_nv_valid[SF_AREA_MAX][OFFLINE_PWD_SIM_NV_ID_MAX];
+
+/*********************************************************************
+ * LOCAL FUNCTION
+ */
+static void offline_pwd_sim_usage(void);
+static uint32_t offline_pwd_sim_rand(void);
+static uint32_t offline_pwd_sim_below(uint32_t n);
+static uint32_t offline_pwd_sim_ref_rank(lock_offline_pwd_storage_t* pwd_storage, uint32_t* T, uint32_t* T3);
+static int32_t offline_pwd_sim_ref_find(uint32_t T_now, bool* expired);
+static int32_t offline_pwd_sim_legacy_expired(uint32_t T_now);
+static bool offline_pwd_sim_check(uint32_t step);
+static void offline_pwd_sim_store(void);
+static bool offline_pwd_sim_run(uint32_t run);
+
+/*********************************************************************
+ * VARIABLES
+ */
+int offline_pwd_sim_verbose;
+
+
+
+
+/*********************************************************
+FN:
+*/
+int main(int argc, char** argv)
+{
+    static const struct option opts[] = {
+        {"steps",        required_argument, NULL, 's'},
+        {"runs",         required_argument, NULL, 'n'},
+        {"seed",         required_argument, NULL, 'x'},
+        {"verbose",      no_argument,       NULL, 'v'},
+        {"help",         no_argument,       NULL, 'h'},
+        {NULL, 0, NULL, 0},
+    };
+    offline_pwd_sim_stats_t total;
+    uint32_t fails = 0;
+    uint32_t run;
+    int opt;
+
+    while((opt = getopt_long(argc, argv, "s:n:x:vh", opts, NULL)) != -1)
+    {
+        switch(opt)
+        {
+            case 's': s_cfg.steps = strtoul(optarg, NULL, 0); break;
+            case 'n': s_cfg.runs = strtoul(optarg, NULL, 0); break;
+            case 'x': s_cfg.seed = strtoul(optarg, NULL, 0); break;
+            case 'v': offline_pwd_sim_verbose++; break;
+            default: offline_pwd_sim_usage(); return 2;
+        }
+    }
+    if((optind != argc) || (s_cfg.runs == 0) || (s_cfg.steps == 0)) {
+        offline_pwd_sim_usage();
+        return 2;
+    }
+
+    memset(&total, 0x00, sizeof(total));
+    for(run = 0; run < s_cfg.runs; run++)
+    {
+        bool ok = offline_pwd_sim_run(run);
+        fails += !ok;
+
+        total.finds += s_stats.finds;
+        total.free_picks += s_stats.free_picks;
+        total.expired_picks += s_stats.expired_picks;
+        total.evict_picks += s_stats.evict_picks;
+        total.legacy_diffs += s_stats.legacy_diffs;
+        total.stores += s_stats.stores;
+        total.clears += s_stats.clears;
+        total.epochs += s_stats.epochs;
+        total.deletes += s_stats.deletes;
+        total.reboots += s_stats.reboots;
+        total.mismatches += s_stats.mismatches;
+
+        if(offline_pwd_sim_verbose || !ok) {
+            printf("run %3u seed %u: %s\n", run, s_cfg.seed + run, ok ? "ok" : "FAIL");
+        }
+    }
+
+    printf("%u run(s) x %u steps, %u slots\n", s_cfg.runs, s_cfg.steps, OFFLINE_PWD_MAX_NUM);
+    printf("ops:    %u stores, %u single clears, %u epochs, %u deletes, %u reboots\n",
+        total.stores, total.clears, total.epochs, total.deletes, total.reboots);
+    printf("finds:  %u, free %u, expired %u, evict %u\n",
+        total.finds, total.free_picks, total.expired_picks, total.evict_picks);
+    printf("old scan would pick another expired slot: %u\n", total.legacy_diffs);
+    printf("mismatches: %u\n", total.mismatches);
+    printf("result: %u/%u ok\n", s_cfg.runs - fails, s_cfg.runs);
+    return (fails == 0) ? 0 : 1;
+}
+
+/*********************************************************
+FN:
+*/
+static void offline_pwd_sim_usage(void)
+{
+    printf("offline_pwd_sim.sh [options]\n"
+           "  -s, --steps N     operations per run (20000)\n"
+           "  -n, --runs N      runs, seeds seed..seed+N-1 (20)\n"
+           "  -x, --seed N      first seed (1)\n"
+           "  -v, --verbose     one line per run, -vv adds the device log\n");
+}
+
+/*********************************************************
+FN: xorshift32, same sequence on every host
+*/
+static uint32_t offline_pwd_sim_rand(void)
+{
+    s_rand ^= s_rand << 13;
+    s_rand ^= s_rand >> 17;
+    s_rand ^= s_rand << 5;
+    return s_rand;
+}
+
+/*********************************************************
+FN:
+*/
+static uint32_t offline_pwd_sim_below(uint32_t n)
+{
+    return offline_pwd_sim_rand() % n;
+}
+
+/*********************************************************
+FN: rank in the documented order, T is the time compared inside the rank
+*/
+static uint32_t offline_pwd_sim_ref_rank(lock_offline_pwd_storage_t* pwd_storage, uint32_t* T, uint32_t* T3)
+{
+    uint32_t T2;
+
+    lock_offline_pwd_storage_calculate_T2_T3_offset(pwd_storage, &T2, T3);
+    *T = *T3;
+    if(pwd_storage->type == PWD_TYPE_TIMELINESS) {
+        if(pwd_storage->status == PWD_STATUS_INVALID) {
+            return 0;
+        }
+        *T = T2;
+        return 1;
+    }
+    return (pwd_storage->type == PWD_TYPE_SINGLE) ? 2 : 3;
+}
+
+/*********************************************************
+FN: the documented policy as a plain scan
+*/
+static int32_t offline_pwd_sim_ref_find(uint32_t T_now, bool* expired)
+{
+    uint32_t T0_round = T0 - (T0 % 3600);
+    int32_t  expired_id = -1;
+    uint32_t expired_T3 = 0;
+    int32_t  evict_id = -1;
+    uint32_t evict_rank = 0;
+    uint32_t evict_T = 0;
+
+    for(int32_t idx = 0; idx < OFFLINE_PWD_MAX_NUM; idx++)
+    {
+        lock_offline_pwd_storage_t pwd_storage;
+        uint32_t rank, T, T3;
+
+        lock_offline_pwd_load(idx, &pwd_storage);
+        if(pwd_storage.status == PWD_STATUS_UNUSED) {
+            *expired = false;
+            return idx;
+        }
+
+        rank = offline_pwd_sim_ref_rank(&pwd_storage, &T, &T3);
+        if(((T3 + T0_round) < T_now) && ((expired_id < 0) || (T3 < expired_T3))) {
+            expired_id = idx;
+            expired_T3 = T3;
+        }
+        if((evict_id < 0) || (rank < evict_rank) || ((rank == evict_rank) && (T < evict_T))) {
+            evict_id = idx;
+            evict_rank = rank;
+            evict_T = T;
+        }
+    }
+
+    *expired = (expired_id >= 0);
+    return (expired_id >= 0) ? expired_id : evict_id;
+}
+
+/*********************************************************
+FN: what the old scan picked when the table was full: the first expired slot
+*/
+static int32_t offline_pwd_sim_legacy_expired(uint32_t T_now)
+{
+    uint32_t T0_round = T0 - (T0 % 3600);
+
+    for(int32_t idx = 0; idx < OFFLINE_PWD_MAX_NUM; idx++)
+    {
+        lock_offline_pwd_storage_t pwd_storage;
+        uint32_t T2, T3;
+
+        lock_offline_pwd_load(idx, &pwd_storage);
+        lock_offline_pwd_storage_calculate_T2_T3_offset(&pwd_storage, &T2, &T3);
+        if((T3 + T0_round) < T_now) {
+            return idx;
+        }
+    }
+    return -1;
+}
+
+/*********************************************************
+FN:
+*/
+static bool offline_pwd_sim_check(uint32_t step)
+{
+    bool expired;
+    int32_t got = lock_offline_pwd_find(s_now);
+    int32_t want = offline_pwd_sim_ref_find(s_now, &expired);
+    bool ok = true;
+
+    s_stats.finds++;
+    if(got != want) {
+        printf("  step %u: find -> %d, policy -> %d (T_now %u, T0 %u)\n", step, got, want, s_now, T0);
+        ok = false;
+    } else if(s_pwd_free_head != OFFLINE_PWD_SLOT_NONE) {
+        s_stats.free_picks++;
+    } else if(expired) {
+        s_stats.expired_picks++;
+        s_stats.legacy_diffs += (offline_pwd_sim_legacy_expired(s_now) != want);
+    } else {
+        s_stats.evict_picks++;
+    }
+
+    //hash index against the table
+    uint8_t  type = offline_pwd_sim_below(2) ? PWD_TYPE_TIMELINESS : PWD_TYPE_SINGLE;
+    uint32_t pwd = offline_pwd_sim_below(OFFLINE_PWD_SIM_PWD_RANGE);
+    int32_t  scan = -1;
+    for(int32_t idx = 0; idx < OFFLINE_PWD_MAX_NUM; idx++)
+    {
+        if((lock_offline_pwd_status_get(&s_pwd_table[idx]) != PWD_STATUS_UNUSED)
+            && (s_pwd_table[idx].type == type) && (s_pwd_table[idx].pwd == pwd)) {
+            scan = idx;
+            break;
+        }
+    }
+    if(lock_offline_pwd_hash_lookup(type, pwd) != scan) {
+        printf("  step %u: lookup(%u, %u) -> %d, scan -> %d\n", step, type, pwd,
+            lock_offline_pwd_hash_lookup(type, pwd), scan);
+        ok = false;
+    }
+
+    s_stats.mismatches += !ok;
+    return ok;
+}
+
+/*********************************************************
+FN: store a new pwd the way lock_offline_pwd_verify() does
+*/
+static void offline_pwd_sim_store(void)
+{
+    lock_offline_pwd_storage_t pwd_storage;
+    uint32_t T0_round = T0 - (T0 % 3600);
+    uint32_t hours_now = (s_now - T0_round) / OFFLINE_PWD_TIME_ACCURACY;
+    uint32_t sel = offline_pwd_sim_below(10);
+    //inside the activation window
+    uint32_t num_1_5 = hours_now - ((hours_now > 24) ? offline_pwd_sim_below(offline_pwd_sim_below(8) ? 2 : 24) : 0);
+
+    //pwd = num_1_5*10000 + num_6_9, num_6_9 is the validity in hours for timeliness and
+    //the serial number otherwise (any value here, to get repeats and long hash chains)
+    if(sel < 6) {
+        pwd_storage.type = PWD_TYPE_TIMELINESS;
+        pwd_storage.pwd = num_1_5*10000 + 1 + offline_pwd_sim_below(240);
+    } else {
+        pwd_storage.type = (sel < 9) ? PWD_TYPE_SINGLE : PWD_TYPE_CLEAR_ALL;
+        pwd_storage.pwd = num_1_5*10000 + offline_pwd_sim_below(OFFLINE_PWD_SIM_PWD_RANGE);
+    }
+
+    if(lock_offline_pwd_hash_lookup(pwd_storage.type, pwd_storage.pwd) >= 0) {
+        return;
+    }
+
+    int32_t pwdid = lock_offline_pwd_find(s_now);
+    if(pwdid < 0) {
+        return;
+    }
+    pwd_storage.status = (pwd_storage.type == PWD_TYPE_TIMELINESS) ? PWD_STATUS_VALID : PWD_STATUS_INVALID;
+    lock_offline_pwd_save(pwdid, &pwd_storage);
+    s_stats.stores++;
+
+    if(pwd_storage.type == PWD_TYPE_CLEAR_ALL) {
+        if(lock_offline_pwd_clear(PWD_TYPE_CLEAR_ALL, 0) == OFFLINE_PWD_CLEAR_ALL_SUCCESS) {
+            s_stats.epochs++;
+        }
+    }
+}
+
+/*********************************************************
+FN:
+*/
+static bool offline_pwd_sim_run(uint32_t run)
+{
+    bool ok = true;
+
+    memset(&s_stats, 0x00, sizeof(s_stats));
+    memset(s_nv_valid, 0x00, sizeof(s_nv_valid));
+    s_rand = s_cfg.seed + run;
+    if(s_rand == 0) {
+        s_rand = 0x9E3779B9;
+    }
+
+    lock_offline_pwd_set_T0(1589251799 - offline_pwd_sim_below(3600*24*30));
+    s_now = T0 + 3600*24*2;
+    lock_offline_pwd_init();
+
+    for(uint32_t step = 0; ok && (step < s_cfg.steps); step++)
+    {
+        uint32_t sel = offline_pwd_sim_below(1000);
+
+        ok = offline_pwd_sim_check(step);
+
+        if(sel < 600) {
+            offline_pwd_sim_store();
+        }
+        else if(sel < 750) {
+            //clear single, a stored pwd or an unknown one
+            int32_t idx = offline_pwd_sim_below(OFFLINE_PWD_MAX_NUM);
+            lock_offline_pwd_clear(PWD_TYPE_CLEAR_SINGLE, s_pwd_table[idx].pwd + offline_pwd_sim_below(2));
+            s_stats.clears++;
+        }
+        else if(sel < 780) {
+            //epoch only, lets the 6 bit epoch wrap inside a run
+            if(lock_offline_pwd_epoch_advance() == APP_PORT_SUCCESS) {
+                s_stats.epochs++;
+            }
+        }
+        else if(sel < 800) {
+            lock_offline_pwd_delete(offline_pwd_sim_below(OFFLINE_PWD_MAX_NUM));
+            s_stats.deletes++;
+        }
+        else if(sel < 801) {
+            lock_offline_pwd_delete_all();
+            s_stats.deletes++;
+        }
+        else if(sel < 810) {
+            lock_offline_pwd_init();
+            s_stats.reboots++;
+        }
+        else if(sel < 815) {
+            //T0 synced again, never past now
+            uint32_t T0_new = T0 + offline_pwd_sim_below(3600*48) - 3600*24;
+            if(T0_new < s_now) {
+                lock_offline_pwd_set_T0(T0_new);
+            }
+        }
+
+        //mostly minutes between pwds, sometimes days, so all three picks happen
+        s_now += (offline_pwd_sim_below(500) == 0) ? offline_pwd_sim_below(3600*24*3) : offline_pwd_sim_below(300);
+    }
+    return ok;
+}
+
+/*********************************************************
+FN: nv store, kept across lock_offline_pwd_init() like flash
+*/
+uint32_t app_port_nv_set(uint32_t area_id, uint16_t id, void *buf, uint8_t size)
+{
+    if((area_id >= SF_AREA_MAX) || (id >= OFFLINE_PWD_SIM_NV_ID_MAX) || (size > OFFLINE_PWD_SIM_NV_LEN)) {
+        return APP_PORT_ERROR_COMMON;
+    }
+    memcpy(s_nv[area_id][id], buf, size);
+    s_nv_valid[area_id][id] = true;
+    return APP_PORT_SUCCESS;
+}
+
+/*********************************************************
+FN:
+*/
+uint32_t app_port_nv_get(uint32_t area_id, uint16_t id, void *buf, uint8_t size)
+{
+    if((area_id >= SF_AREA_MAX) || (id >= OFFLINE_PWD_SIM_NV_ID_MAX) || (size > OFFLINE_PWD_SIM_NV_LEN)
+        || !s_nv_valid[area_id][id]) {
+        return APP_PORT_ERROR_COMMON;
+    }
+    memcpy(buf, s_nv[area_id][id], size);
+    return APP_PORT_SUCCESS;
+}
+
+/*********************************************************
+FN:
+*/
+uint32_t app_port_nv_del(uint32_t area_id, uint16_t id)
+{
+    if((area_id >= SF_AREA_MAX) || (id >= OFFLINE_PWD_SIM_NV_ID_MAX)) {
+        return APP_PORT_ERROR_COMMON;
+    }
+    s_nv_valid[area_id][id] = false;
+    return APP_PORT_SUCCESS;
+}
+
+/*********************************************************
+FN: only reached from lock_offline_pwd_verify(), which is not driven here
+*/
+uint32_t app_port_num_array_2_int(uint8_t *num_array, uint32_t start_idx, uint32_t size)
+{
+    uint32_t num = 0;
+    for(uint32_t idx = start_idx; idx < start_idx + size; idx++) {
+        num = num*10 + num_array[idx];
+    }
+    return num;
+}
+
+uint32_t app_port_get_timestamp(void)
+{
+    return s_now;
+}
+
+void tuya_ble_utc_sec_2_mytime(uint32_t utc_sec, tuya_ble_time_struct_data_t *result, bool daylightSaving)
+{
+    memset(result, 0x00, sizeof(tuya_ble_time_struct_data_t));
+}
+
+int fpe_decrypt(uint8_t *input_key, uint8_t key_len, uint8_t *input_cipher, uint16_t cipher_len, uint8_t *output, uint8_t *output_len)
+{
+    return -1;
+}
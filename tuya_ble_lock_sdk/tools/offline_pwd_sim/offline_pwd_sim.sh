@@ -0,0 +1,25 @@
+#!/bin/sh
+# Build the host test of the offline pwd slot table and run it, options are passed on
+# (offline_pwd_sim.sh -h).
+#
+#   OFFLINE_PWD_SIM_OUT  build directory, /tmp/offline_pwd_sim by default
+#   CC                   host compiler, cc by default
+#
+# lock_offline_pwd.[ch] are compiled from a copy so that the quoted include picks up
+# stub/lock_common.h, offline_pwd_sim.c includes the .c to reach the static table and heaps.
+set -e
+
+HERE=$(cd "$(dirname "$0")" && pwd)
+SRC=$HERE/../../src
+OUT=${OFFLINE_PWD_SIM_OUT:-/tmp/offline_pwd_sim}
+
+mkdir -p "$OUT/src"
+cp "$SRC"/app/app_lock/lock_offline_pwd.[ch] "$OUT/src/"
+
+${CC:-cc} -O2 -Wall -Wno-unused-function \
+    -I"$HERE/stub" -I"$OUT/src" \
+    -I"$SRC/tuya_ble_sdk/include" -I"$SRC/cpt/fpe_tuya" \
+    "$HERE/offline_pwd_sim.c" \
+    -o "$OUT/offline_pwd_sim"
+
+exec "$OUT/offline_pwd_sim" "$@"
@@ -0,0 +1,78 @@
+/**
+****************************************************************************
+* @file      lock_common.h
+* @brief     offline_pwd_sim stand-in for src/app/app_lock/lock_common.h
+* @author    suding
+* @version   V1.0.0
+* @date      2020-05-11
+* @note      only what lock_offline_pwd.c uses; app_port is implemented by offline_pwd_sim.c
+******************************************************************************
+* @attention
+*
+* <h2><center>&copy; COPYRIGHT 2020 Tuya </center></h2>
+*/
+
+
+#ifndef __LOCK_COMMON_H__
+#define __LOCK_COMMON_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*********************************************************************
+ * INCLUDES
+ */
+//c_lib
+#include "stdio.h"
+#include "stdlib.h"
+#include "stdint.h"
+#include "stdbool.h"
+#include "string.h"
+
+#include "tuya_ble_unix_time.h"
+
+/*********************************************************************
+ * CONSTANTS
+ */
+enum {
+    APP_PORT_SUCCESS  = 0x00,
+    APP_PORT_ERROR_COMMON  = 0x01,
+};
+
+extern int offline_pwd_sim_verbose;
+#define APP_DEBUG_PRINTF(...)            do { if(offline_pwd_sim_verbose > 1) { printf("    dev: "); printf(__VA_ARGS__); printf("\n"); } } while(0)
+#define APP_DEBUG_HEXDUMP(name, buf, size)
+
+//sf_port.h
+enum {
+    SF_AREA_0 = 0,
+    SF_AREA_1,
+    SF_AREA_2,
+    SF_AREA_3,
+    SF_AREA_MAX,
+};
+
+//app_flash.h, values only need to be distinct here
+enum {
+    NV_ID_T0_STORAGE = 0,
+    NV_ID_OFFLINE_PWD_EPOCH,
+    NV_ID_MAX,
+};
+
+/*********************************************************************
+ * EXTERNAL FUNCTIONS
+ */
+uint32_t app_port_nv_set(uint32_t area_id, uint16_t id, void *buf, uint8_t size);
+uint32_t app_port_nv_get(uint32_t area_id, uint16_t id, void *buf, uint8_t size);
+uint32_t app_port_nv_del(uint32_t area_id, uint16_t id);
+uint32_t app_port_num_array_2_int(uint8_t *num_array, uint32_t start_idx, uint32_t size);
+uint32_t app_port_get_timestamp(void);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //__LOCK_COMMON_H__
@@ -0,0 +1,263 @@
+#!/usr/bin/env python3
+"""Delta OTA patch tool for app_ota_delta.c.
+
+    ota_delta.py diff  OLD NEW PATCH   make PATCH so that the lock rebuilds NEW from OLD
+    ota_delta.py apply OLD PATCH NEW   rebuild NEW on the host (same algorithm as the lock)
+
+OLD is the ota file the lock is running (the running image at 0x20010 is a byte copy of
+it), NEW the ota file to install. The patch is sent with file type 0x01 (delta) in
+place of NEW; see app_ota_delta.h for the format.
+
+Matching follows bsdiff 4.3 (suffix array, approximate extension of exact matches).
+The diff bytes are not compressed, they are run-length coded instead: zero runs (bytes
+equal in OLD and NEW) cost two bytes per ZERO_MAX, so that no patch byte makes the lock
+write more than ZERO_MAX bytes.
+"""
+
+import struct
+import sys
+import zlib
+
+MAGIC = 0x50445954  # "TYDP"
+HEAD = struct.Struct("<5I")
+MIN_ZERO_RUN = 3    # shorter zero runs stay inside the literal
+ZERO_MAX = 256      # APP_OTA_DELTA_ZERO_MAX
+
+
+def crc32(buf):
+    return zlib.crc32(buf) & 0xFFFFFFFF
+
+
+def suffix_array(buf):
+    """Prefix doubling, O(n log^2 n); fine for 128 KB images."""
+    n = len(buf)
+    sa = list(range(n))
+    rank = list(buf)
+    k = 1
+    while True:
+        key = [(rank[i], rank[i + k] if i + k < n else -1) for i in range(n)]
+        sa.sort(key=key.__getitem__)
+        new_rank = [0] * n
+        for j in range(1, n):
+            new_rank[sa[j]] = new_rank[sa[j - 1]] + (key[sa[j]] != key[sa[j - 1]])
+        rank = new_rank
+        if n == 0 or rank[sa[-1]] == n - 1:
+            return sa
+        k *= 2
+
+
+def match_len(old, opos, new, npos):
+    n = min(len(old) - opos, len(new) - npos)
+    length = 0
+    step = 64
+    while length < n:
+        size = min(step, n - length)
+        if old[opos + length:opos + length + size] == new[npos + length:npos + length + size]:
+            length += size
+        else:
+            while old[opos + length] == new[npos + length]:
+                length += 1
+            break
+    return length
+
+
+def search(sa, old, new, npos, probe=256):
+    """Longest exact match of new[npos:] in old, as (length, old position)."""
+    st, en = 0, len(sa)
+    key = new[npos:npos + probe]
+    while en - st >= 2:
+        x = st + (en - st) // 2
+        if old[sa[x]:sa[x] + probe] < key:
+            st = x
+        else:
+            en = x
+    best = (0, 0)
+    for x in (st, en):
+        if x < len(sa):
+            length = match_len(old, sa[x], new, npos)
+            if length > best[0]:
+                best = (length, sa[x])
+    return best
+
+
+def bsdiff_controls(old, new):
+    """Yield (diff_len, extra_len, seek, old_pos, new_pos) as bsdiff does."""
+    sa = suffix_array(old)
+    oldsize, newsize = len(old), len(new)
+    scan = length = lastscan = lastpos = lastoffset = 0
+    pos = 0
+    while scan < newsize:
+        oldscore = 0
+        scan += length
+        scsc = scan
+        while scan < newsize:
+            length, pos = search(sa, old, new, scan) if oldsize else (0, 0)
+            while scsc < scan + length:
+                if scsc + lastoffset < oldsize and old[scsc + lastoffset] == new[scsc]:
+                    oldscore += 1
+                scsc += 1
+            if (length == oldscore and length != 0) or length > oldscore + 8:
+                break
+            if scan + lastoffset < oldsize and old[scan + lastoffset] == new[scan]:
+                oldscore -= 1
+            scan += 1
+
+        if length != oldscore or scan == newsize:
+            s = sf = lenf = 0
+            i = 0
+            while lastscan + i < scan and lastpos + i < oldsize:
+                if old[lastpos + i] == new[lastscan + i]:
+                    s += 1
+                i += 1
+                if s * 2 - i > sf * 2 - lenf:
+                    sf, lenf = s, i
+
+            lenb = 0
+            if scan < newsize:
+                s = sb = 0
+                i = 1
+                while scan >= lastscan + i and pos >= i:
+                    if old[pos - i] == new[scan - i]:
+                        s += 1
+                    if s * 2 - i > sb * 2 - lenb:
+                        sb, lenb = s, i
+                    i += 1
+
+            if lastscan + lenf > scan - lenb:
+                overlap = (lastscan + lenf) - (scan - lenb)
+                s = ss = lens = 0
+                for i in range(overlap):
+                    if new[lastscan + lenf - overlap + i] == old[lastpos + lenf - overlap + i]:
+                        s += 1
+                    if new[scan - lenb + i] == old[pos - lenb + i]:
+                        s -= 1
+                    if s > ss:
+                        ss, lens = s, i + 1
+                lenf += lens - overlap
+                lenb -= lens
+
+            extra = (scan - lenb) - (lastscan + lenf)
+            seek = (pos - lenb) - (lastpos + lenf)
+            yield lenf, extra, seek, lastpos, lastscan
+            lastscan, lastpos, lastoffset = scan - lenb, pos - lenb, pos - scan
+
+
+def varint(value):
+    out = bytearray()
+    while True:
+        byte = value & 0x7F
+        value >>= 7
+        if value:
+            out.append(byte | 0x80)
+        else:
+            out.append(byte)
+            return bytes(out)
+
+
+def zigzag(value):
+    return varint((value << 1) if value >= 0 else ((-value << 1) - 1))
+
+
+def encode_diff(diff):
+    """(zero_run, lit_len, lit) pairs covering the whole diff block."""
+    out = bytearray()
+    i, n = 0, len(diff)
+    while i < n:
+        z = i
+        while z < n and diff[z] == 0:
+            z += 1
+        j = z
+        while j < n:
+            if diff[j] == 0 and diff[j:j + MIN_ZERO_RUN] == bytes(min(MIN_ZERO_RUN, n - j)):
+                break
+            j += 1
+        run = z - i
+        while run > ZERO_MAX:
+            out += varint(ZERO_MAX) + varint(0)
+            run -= ZERO_MAX
+        out += varint(run) + varint(j - z) + diff[z:j]
+        i = j
+    return bytes(out)
+
+
+def make_patch(old, new):
+    patch = bytearray(HEAD.pack(MAGIC, len(old), crc32(old), len(new), crc32(new)))
+    for lenf, extra, seek, opos, npos in bsdiff_controls(old, new):
+        diff = bytes((new[npos + i] - old[opos + i]) & 0xFF for i in range(lenf))
+        patch += varint(lenf) + encode_diff(diff)
+        patch += varint(extra) + new[npos + lenf:npos + lenf + extra]
+        patch += zigzag(seek)
+    return bytes(patch)
+
+
+def apply_patch(old, patch):
+    magic, old_len, old_crc, new_len, new_crc = HEAD.unpack_from(patch)
+    if magic != MAGIC:
+        raise ValueError("not a delta patch")
+    if old_len != len(old) or old_crc != crc32(old):
+        raise ValueError("patch was not made against this image")
+
+    p = HEAD.size
+
+    def get_varint():
+        nonlocal p
+        value = shift = 0
+        while True:
+            byte = patch[p]
+            p += 1
+            value |= (byte & 0x7F) << shift
+            shift += 7
+            if not byte & 0x80:
+                return value
+
+    new = bytearray()
+    opos = 0
+    while len(new) < new_len:
+        left = get_varint()
+        while left:
+            zero = get_varint()
+            if zero > ZERO_MAX:
+                raise ValueError("zero run longer than %d" % ZERO_MAX)
+            new += old[opos:opos + zero]
+            opos += zero
+            lit = get_varint()
+            new += bytes((old[opos + i] + patch[p + i]) & 0xFF for i in range(lit))
+            opos += lit
+            p += lit
+            left -= zero + lit
+        extra = get_varint()
+        new += patch[p:p + extra]
+        p += extra
+        seek = get_varint()
+        opos += (seek >> 1) if not seek & 1 else -((seek + 1) >> 1)
+    if p != len(patch) or len(new) != new_len or crc32(new) != new_crc:
+        raise ValueError("patch is corrupted")
+    return bytes(new)
+
+
+def main(argv):
+    if len(argv) != 5 or argv[1] not in ("diff", "apply"):
+        sys.stderr.write(__doc__)
+        return 2
+    with open(argv[2], "rb") as f:
+        old = f.read()
+    with open(argv[3], "rb") as f:
+        src = f.read()
+
+    if argv[1] == "diff":
+        out = make_patch(old, src)
+        if apply_patch(old, out) != src:
+            raise SystemExit("internal error: patch does not rebuild NEW")
+        print("old %d, new %d, patch %d bytes (%.1f%% of new)"
+              % (len(old), len(src), len(out), 100.0 * len(out) / max(len(src), 1)))
+    else:
+        out = apply_patch(old, src)
+        print("new %d bytes, crc32 %08x" % (len(out), crc32(out)))
+
+    with open(argv[4], "wb") as f:
+        f.write(out)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,222 @@
+#!/usr/bin/env python3
+"""Compressed OTA tool for app_ota_unpack.c.
+
+    ota_pack.py pack   [-w BITS] [-l BITS] IN PACKED   compress an ota file (or delta patch)
+    ota_pack.py unpack PACKED OUT                      decompress on the host (same algorithm as the lock)
+
+PACKED is sent with the compressed flag (0x02) set in the file type, together with the
+delta flag (0x01) when IN is a patch from ota_delta.py; see app_ota_unpack.h for the format.
+
+The stream is LZSS in heatshrink's bit layout: -w window bits (at most
+APP_OTA_UNPACK_WINDOW_BITS, 10 by default), -l length bits (4 by default). Matches are
+chosen by an optimal parse over the longest match at each position.
+
+Every 32 bytes of code in an ota file carry the crc16 the flash controller checks, which
+breaks up most repeats. When the lock can rebuild those crcs exactly the tool removes them
+before compressing and sets APP_OTA_UNPACK_FLAG_FLASH_CRC.
+"""
+
+import hashlib
+import struct
+import sys
+import zlib
+
+MAGIC = 0x53485954  # "TYHS"
+HEAD = struct.Struct("<I4B3I16s")
+FLAG_FLASH_CRC = 0x01
+WINDOW_BITS_MAX = 10
+FLASH_CRC_SKIP = 16
+FLASH_CRC_BLOCK = 32
+
+
+def crc32(buf):
+    return zlib.crc32(buf) & 0xFFFFFFFF
+
+
+def crc16(buf):
+    """Poly 0x8005, init 0xFFFF, not reflected; erased blocks keep 0xFFFF."""
+    if buf == b"\xff" * len(buf):
+        return 0xFFFF
+    crc = 0xFFFF
+    for byte in buf:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x8005) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def flash_crc_insert(data):
+    out = bytearray(data[:FLASH_CRC_SKIP])
+    for p in range(FLASH_CRC_SKIP, len(data), FLASH_CRC_BLOCK):
+        block = data[p:p + FLASH_CRC_BLOCK]
+        out += block
+        if len(block) == FLASH_CRC_BLOCK:
+            out += struct.pack(">H", crc16(block))
+    return bytes(out)
+
+
+def flash_crc_strip(data):
+    """data without the flash crcs, None if the lock would not rebuild data from it."""
+    out = bytearray(data[:FLASH_CRC_SKIP])
+    for p in range(FLASH_CRC_SKIP, len(data), FLASH_CRC_BLOCK + 2):
+        out += data[p:p + FLASH_CRC_BLOCK]
+    out = bytes(out)
+    return out if flash_crc_insert(out) == data else None
+
+
+def longest_matches(data, window, max_len):
+    """(length, distance) of the longest match at each position, 2 bytes at least."""
+    n = len(data)
+    head = {}
+    prev = [-1] * n
+    result = [(0, 0)] * n
+    for i in range(n - 1):
+        key = data[i:i + 2]
+        best = (0, 0)
+        cand = head.get(key, -1)
+        limit = min(max_len, n - i)
+        depth = 0
+        while cand >= 0 and i - cand <= window and depth < 256:
+            length = 2
+            while length < limit and data[cand + length] == data[i + length]:
+                length += 1
+            if length > best[0]:
+                best = (length, i - cand)
+                if length == limit:
+                    break
+            cand = prev[cand]
+            depth += 1
+        result[i] = best
+        prev[i] = head.get(key, -1)
+        head[key] = i
+    return result
+
+
+def compress(data, window_bits, count_bits):
+    n = len(data)
+    max_len = 1 << count_bits
+    ref_bits = 1 + window_bits + count_bits
+    matches = longest_matches(data, 1 << window_bits, max_len)
+
+    # cost[i]: fewest bits for data[i:]; a shorter match at the same distance is always valid
+    cost = [0] * (n + 1)
+    choice = [0] * n
+    for i in range(n - 1, -1, -1):
+        cost[i] = cost[i + 1] + 9
+        choice[i] = 1
+        length = matches[i][0]
+        for l in range(2, length + 1):
+            if cost[i + l] + ref_bits < cost[i]:
+                cost[i] = cost[i + l] + ref_bits
+                choice[i] = l
+
+    bits = []
+    i = 0
+    while i < n:
+        if choice[i] == 1:
+            bits.append((1 << 8 | data[i], 9))
+        else:
+            bits.append(((matches[i][1] - 1) << count_bits | (choice[i] - 1), ref_bits))
+        i += choice[i]
+
+    out = bytearray()
+    acc = acc_bits = 0
+    for value, width in bits:
+        acc = acc << width | value
+        acc_bits += width
+        while acc_bits >= 8:
+            acc_bits -= 8
+            out.append(acc >> acc_bits & 0xFF)
+        acc &= (1 << acc_bits) - 1
+    if acc_bits:
+        out.append(acc << (8 - acc_bits) & 0xFF)
+    return bytes(out)
+
+
+def decompress(stream, lz_len, window_bits, count_bits):
+    out = bytearray()
+    pos = 0
+
+    def get(width):
+        nonlocal pos
+        value = 0
+        for _ in range(width):
+            if pos >> 3 >= len(stream):
+                raise ValueError("packed file is truncated")
+            value = value << 1 | (stream[pos >> 3] >> (7 - (pos & 7)) & 1)
+            pos += 1
+        return value
+
+    while len(out) < lz_len:
+        if get(1):
+            out.append(get(8))
+        else:
+            dist = get(window_bits) + 1
+            count = get(count_bits) + 1
+            if dist > len(out) or count > lz_len - len(out):
+                raise ValueError("packed file is corrupted")
+            for _ in range(count):
+                out.append(out[-dist])
+    if (pos + 7) >> 3 != len(stream):
+        raise ValueError("packed file has trailing data")
+    return bytes(out)
+
+
+def pack(data, window_bits, count_bits):
+    stripped = flash_crc_strip(data)
+    flags = FLAG_FLASH_CRC if stripped is not None else 0
+    plain = stripped if stripped is not None else data
+    head = HEAD.pack(MAGIC, flags, window_bits, count_bits, 0, len(plain), len(data),
+                     crc32(data), hashlib.md5(data).digest())
+    return head + compress(plain, window_bits, count_bits)
+
+
+def unpack(packed):
+    magic, flags, window_bits, count_bits, _, lz_len, file_len, file_crc, file_md5 = \
+        HEAD.unpack_from(packed)
+    if magic != MAGIC or flags & ~FLAG_FLASH_CRC or not 0 < window_bits <= WINDOW_BITS_MAX \
+            or not 0 < count_bits <= 8:
+        raise ValueError("not a packed ota file, or parameters the lock does not support")
+    data = decompress(packed[HEAD.size:], lz_len, window_bits, count_bits)
+    if flags & FLAG_FLASH_CRC:
+        data = flash_crc_insert(data)
+    if len(data) != file_len or crc32(data) != file_crc or hashlib.md5(data).digest() != file_md5:
+        raise ValueError("packed file is corrupted")
+    return data
+
+
+def main(argv):
+    args = argv[1:]
+    window_bits, count_bits = WINDOW_BITS_MAX, 4
+    while len(args) > 1 and args[1] in ("-w", "-l"):
+        if args[1] == "-w":
+            window_bits = int(args[2])
+        else:
+            count_bits = int(args[2])
+        del args[1:3]
+    if len(args) != 3 or args[0] not in ("pack", "unpack") \
+            or not 0 < window_bits <= WINDOW_BITS_MAX or not 0 < count_bits <= 8:
+        sys.stderr.write(__doc__)
+        return 2
+    with open(args[1], "rb") as f:
+        src = f.read()
+
+    if args[0] == "pack":
+        out = pack(src, window_bits, count_bits)
+        if unpack(out) != src:
+            raise SystemExit("internal error: packed file does not unpack to IN")
+        print("file %d, packed %d bytes (%.1f%%)%s"
+              % (len(src), len(out), 100.0 * len(out) / max(len(src), 1),
+                 ", flash crc removed" if out[4] & FLAG_FLASH_CRC else ""))
+    else:
+        out = unpack(src)
+        print("file %d bytes, crc32 %08x" % (len(out), crc32(out)))
+
+    with open(args[2], "wb") as f:
+        f.write(out)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,168 @@
+#!/bin/sh
+# Regression cases of the ota path on the host simulator, non-zero exit when one fails.
+# The result counts the ota_sim runs and the limits checked.
+#
+#   OTA_SIM_OUT     build directory shared with ota_sim.sh, /tmp/ota_sim by default
+#   OTA_SIM_IMAGES  directory of the shipped ota files the delta cases are made from
+#
+# A case passes when ota_sim does (every run ends with the expected image in the ota area,
+# no erase/program violation) and the limits put on its report hold. The limits are the
+# behaviour each change was made for, not the timings of a given build.
+
+HERE=$(cd "$(dirname "$0")" && pwd)
+OUT=${OTA_SIM_OUT:-/tmp/ota_sim}
+SIM=$OUT/ota_sim
+IMAGES=${OTA_SIM_IMAGES:-$HERE/../../../ble_3435_sdk_ext_39_0F0E/projects/ble_app_gatt/output/app/ota}
+
+rm -f "$SIM"
+"$HERE/ota_sim.sh" -h >/dev/null 2>&1
+if [ ! -x "$SIM" ]; then
+    echo "ota_sim build failed"
+    exit 2
+fi
+
+checks=0
+fails=0
+report=
+
+# ota_case NAME ota_sim-options...
+ota_case()
+{
+    name=$1
+    shift
+    checks=$((checks + 1))
+    if report=$("$SIM" "$@"); then
+        echo "$name: ok ($(echo "$report" | tail -n 1))"
+    else
+        echo "$name: FAIL ($(echo "$report" | tail -n 1))"
+        echo "  ota_sim $*"
+        fails=$((fails + 1))
+    fi
+}
+
+# ota_limit FIELD OP VALUE: the number printed before FIELD in the last report, OP is <= or >=
+ota_limit()
+{
+    got=$(echo "$report" | sed -n "s/.* \([0-9.][0-9.]*\) $1.*/\1/p" | head -n 1)
+    checks=$((checks + 1))
+    if [ -n "$got" ] && awk -v a="$got" -v b="$3" -v op="$2" \
+        'BEGIN { exit !((op == "<=") ? (a + 0 <= b + 0) : (a + 0 >= b + 0)) }'; then
+        echo "  $1: $got $2 $3"
+    else
+        echo "  $1: ${got:-none} $2 $3 FAIL"
+        fails=$((fails + 1))
+    fi
+}
+
+# erase ahead: sectors erased one ahead of the write pointer in the idle time, never the
+# whole ota area, a write never lands on an unerased page (violation)
+ota_case "erase ahead, one sector" -s 4000
+ota_limit "sector erases" "<=" 2
+ota_case "erase ahead, unaligned end" -s 89552 -n 3
+ota_limit "sector erases" "<=" 23
+ota_case "erase ahead, whole ota area" -s 131072
+ota_limit "sector erases" "<=" 32
+ota_case "erase ahead, one connection event per packet" -s 89552 --rtt-events 1
+ota_limit "sector erases" "<=" 23
+ota_limit "ms longest stall" "<=" 70
+ota_case "erase ahead, erase slower than the link" -s 89552 --t-se 200000
+ota_limit "sector erases" "<=" 23
+ota_case "erase ahead, stop mid-sector" -s 89552 -n 10 --disconnect 0.01 --sessions 200
+
+# resume: after a disconnect the transfer goes on from the last checkpoint once the
+# prefix in flash is checked again, the image still comes out bit-identical
+ota_case "resume, random disconnects" -s 89552 -n 20 --disconnect 0.01
+ota_limit "resumed" ">=" 1
+ota_limit "bytes sent" "<=" 134328
+ota_case "resume, whole ota area" -s 131072 -n 5 --disconnect 0.01
+ota_limit "resumed" ">=" 1
+ota_limit "deferred rsp" ">=" 1
+# state errors after lost responses restart sessions too, resumed as well
+ota_case "resume, lossy link" -s 89552 -n 20 --disconnect 0.01 --loss 0.02 --dup 0.02 --reorder 0.02 --sessions 400
+ota_limit "resumed" ">=" 1
+ota_limit "bytes sent" "<=" 268656
+
+# page combining: packets gathered into 256 byte pages, one write protection toggle per
+# page, partial pages flushed on END and on disconnect
+ota_case "page combining, 192 byte packets" -s 89552
+ota_limit "status register writes" "<=" 800
+ota_limit "page programs" "<=" 2860
+ota_limit "ms per data packet" "<=" 14
+ota_limit "ms longest stall" "<=" 70
+ota_case "page combining, less than a page" -s 100
+ota_limit "status register writes" "<=" 6
+ota_case "page combining, partial pages at disconnects" -s 89552 -n 20 --disconnect 0.02 --sessions 200
+
+# packet size: a data packet longer than package_maxlen is refused with a size error before
+# it is copied, the transfer resumes from the checkpoint
+ota_case "packet size, oversized packets" -s 89552 -n 10 --oversize 0.02 --sessions 400
+ota_limit "oversized" ">=" 1
+
+# delta: patches made by ota_delta.py from the shipped images. A packet that rebuilds more
+# than about a page is written by a background job and answered when done, so the longest
+# stall stays one sector erase however much a packet rebuilds (1.6 -> 1.6 is all zero runs).
+# The running image crc in the patch header is checked one 256 byte window per job step, the
+# rebuild waits for it: the most read in one go stays a few windows, not the whole image.
+# The main loop does not sleep while a job is pending, a few steps run per connection event
+# delta_case OLD NEW NAME ota_sim-options..., OLD and NEW are versions of the shipped images
+delta_case()
+{
+    old=$IMAGES/tuya_ble_lock_common_bk3431q_$1.bin
+    new=$IMAGES/tuya_ble_lock_common_bk3431q_$2.bin
+    patch=$OUT/delta_$1_$2.bin
+    name=$3
+    shift 3
+    rm -f "$patch"
+    python3 "$HERE/../ota_delta/ota_delta.py" diff "$old" "$new" "$patch" >/dev/null
+    ota_case "$name" -t 1 -f "$patch" -o "$old" -e "$new" --idle-steps 4 "$@"
+}
+delta_case 1.6 1.7 "delta, 1.6 to 1.7"
+ota_limit "ms longest stall" "<=" 70
+ota_limit "deferred rsp" ">=" 1
+ota_limit "bytes longest running image read" "<=" 4096
+delta_case 1.7 1.6 "delta, 1.7 to 1.6"
+ota_limit "ms longest stall" "<=" 70
+ota_limit "bytes longest running image read" "<=" 4096
+delta_case 1.6 1.6 "delta, same image"
+ota_limit "ms longest stall" "<=" 70
+ota_limit "bytes sent" "<=" 2048
+delta_case 1.6 1.7 "delta, random disconnects" -n 20 --disconnect 0.01 --sessions 400
+ota_limit "ms longest stall" "<=" 70
+
+# compressed: ota files and delta patches packed by ota_pack.py, unpacked on the fly. The image
+# in the ota area must come out bit-identical (-e), the file sent is checked against the image
+# it replaces ("of the image"). A packed patch of an unchanged image rebuilds the whole image
+# from one packet, the client waits for its response as long as the flash takes to program it
+# pack_case IN NAME ota_sim-options..., IN packed into $OUT
+pack_case()
+{
+    packed=$OUT/packed_$(basename "$1")
+    in=$1
+    name=$2
+    shift 2
+    rm -f "$packed"
+    packing=$(python3 "$HERE/../ota_pack/ota_pack.py" pack "$in" "$packed")
+    ota_case "$name" -f "$packed" "$@"
+    echo "  ota_pack: $packing"
+}
+pack_case "$IMAGES/tuya_ble_lock_common_bk3431q_1.7.bin" "compressed, 1.7" -t 2 \
+    -e "$IMAGES/tuya_ble_lock_common_bk3431q_1.7.bin"
+ota_limit "of the image" "<=" 0.8
+ota_limit "ms longest stall" "<=" 70
+pack_case "$IMAGES/tuya_ble_lock_common_bk3431q_1.6.bin" "compressed, 1.6" -t 2 \
+    -e "$IMAGES/tuya_ble_lock_common_bk3431q_1.6.bin"
+ota_limit "of the image" "<=" 0.8
+pack_case "$IMAGES/tuya_ble_lock_common_bk3431q_1.7.bin" "compressed, random disconnects" -t 2 \
+    -e "$IMAGES/tuya_ble_lock_common_bk3431q_1.7.bin" -n 20 --disconnect 0.01 --sessions 400
+pack_case "$OUT/delta_1.6_1.7.bin" "compressed delta, 1.6 to 1.7" -t 3 --idle-steps 4 \
+    -o "$IMAGES/tuya_ble_lock_common_bk3431q_1.6.bin" -e "$IMAGES/tuya_ble_lock_common_bk3431q_1.7.bin"
+ota_limit "of the image" "<=" 0.25
+ota_limit "ms longest stall" "<=" 70
+ota_limit "bytes longest running image read" "<=" 4096
+pack_case "$OUT/delta_1.6_1.6.bin" "compressed delta, same image" -t 3 --timeout 10000 --idle-steps 4 \
+    -o "$IMAGES/tuya_ble_lock_common_bk3431q_1.6.bin" -e "$IMAGES/tuya_ble_lock_common_bk3431q_1.6.bin"
+ota_limit "of the image" "<=" 0.01
+ota_limit "ms longest stall" "<=" 70
+
+echo "result: $((checks - fails))/$checks ok"
+[ $fails -eq 0 ]
@@ -0,0 +1,996 @@
+/**
+****************************************************************************
+* @file      ota_sim.c
+* @brief     host simulator of the ota path, build and run with ota_sim.sh
+* @author    suding
+* @version   V1.0.0
+* @date      2020-05-11
+* @note
+*   device: app_ota.c (+ app_ota_delta.c, app_ota_unpack.c, co_job.c) unchanged, app_port
+*           replaced below by a nor flash model (erase before write checked, cost counted as
+*           flash.c drives the chip), a nv store and the response hook app_port_ota_rsp(),
+*           which on target only hands the response to tuya_ble_ota_response().
+*   client: REQ, FILE_INFO, FILE_OFFSET (resumes when the checkpoint matches), DATA, END,
+*           stop and wait like the app. A command without response is sent again, an error
+*           response or too many retries starts a new session.
+*   link:   loss (commands and responses), duplicates, late copies of data packets
+*           (reordering), disconnects, all with a fixed seed. Oversized data packets
+*           (longer than package_maxlen) must be refused with a size error.
+*   time:   an exchange takes rtt_events connection intervals, more when the device is busy
+*           with flash longer than that (handler + background erase between the events).
+*           A response sent later from a background job (FILE_OFFSET after the checkpoint
+*           check, a data packet still being written) is waited for event by event, up to
+*           the timeout. The longest stall is the most flash time spent in one handler call
+*           or one co_job step, the time the main loop cannot serve the radio.
+******************************************************************************
+* @attention
+*
+* <h2><center>&copy; COPYRIGHT 2020 Tuya </center></h2>
+*/
+#include <getopt.h>
+#include <math.h>
+#include "app_common.h"
+
+
+
+
+/*********************************************************************
+ * LOCAL CONSTANTS
+ */
+#define OTA_SIM_OTA_LEN         (BK_FLASH_OTA_END_ADDR - BK_FLASH_OTA_START_ADDR)
+#define OTA_SIM_RUNNING_LEN     (BK_FLASH_APP_END_ADDR - BK_FLASH_APP_IMAGE_ADDR)
+#define OTA_SIM_SECTOR_SIZE     TUYA_NV_ERASE_MIN_SIZE
+#define OTA_SIM_PAGE_SIZE       256     //flash_write() splits at page boundaries
+#define OTA_SIM_PP_SIZE         32      //flash_write_data() programs 32 bytes at a time
+#define OTA_SIM_NV_MAX          NV_ID_MAX
+#define OTA_SIM_NV_LEN          64
+#define OTA_SIM_OVERSIZE        64      //bytes beyond package_maxlen in an oversized data packet
+#define OTA_SIM_CMD_LEN         (7 + APP_OTA_PKG_LEN + OTA_SIM_OVERSIZE)
+
+enum {
+    OTA_SIM_LINK_OK = 0,
+    OTA_SIM_LINK_TIMEOUT,
+    OTA_SIM_LINK_DISCONNECT,
+};
+
+enum {
+    OTA_SIM_SESSION_DONE = 0,
+    OTA_SIM_SESSION_ERROR,          //error response, new session on the same link
+    OTA_SIM_SESSION_DISCONNECT,     //link lost or given up, new session after reconnecting
+    OTA_SIM_SESSION_REFUSED,        //file refused (pid/version/size/md5...), no point retrying
+};
+
+/*********************************************************************
+ * LOCAL STRUCT
+ */
+typedef struct {
+    //file
+    const char* file;
+    const char* old;
+    const char* expect;
+    uint8_t  type;
+    uint32_t size;
+    //link
+    double   loss;
+    double   dup;
+    double   reorder;
+    double   disconnect;
+    double   oversize;
+    //client
+    uint32_t retries;
+    double   timeout_ms;
+    double   reconnect_ms;
+    uint32_t max_sessions;
+    //time
+    double   interval_ms;   //0: the interval app_ota asks for
+    uint32_t rtt_events;
+    uint32_t idle_steps;    //co_job_schedule() calls per connection event
+    double   t_wrsr_us;
+    double   t_pp_us;
+    double   t_se_us;
+    //run
+    uint32_t runs;
+    uint32_t seed;
+} ota_sim_cfg_t;
+
+typedef struct {
+    uint32_t sessions;
+    uint32_t disconnects;
+    uint32_t timeouts;
+    uint32_t errors;
+    uint32_t lost;
+    uint32_t dups;
+    uint32_t late;
+    uint32_t oversized;
+    uint32_t resumes;
+    uint32_t deferred;      //responses sent from a background job
+    uint32_t data_pkgs;
+    uint64_t data_bytes;
+    uint64_t wrsr;
+    uint64_t pp;
+    uint64_t erase;
+    uint64_t nv_set;
+    uint64_t violations;
+    double   busy_us;       //flash busy time
+    double   data_busy_us;  //part of it spent in data packets and between them
+    double   stall_us;      //longest flash busy time in one handler call or one job step
+    uint64_t read;          //running image bytes read
+    uint64_t read_max;      //most running image bytes read in one handler call or one job step
+    double   time_ms;
+} ota_sim_stats_t;
+
+typedef struct {
+    uint32_t countdown;     //commands to wait before delivering, 0: none held
+    tuya_ble_ota_data_type_t type;
+    uint16_t len;
+    uint8_t  buf[OTA_SIM_CMD_LEN];
+} ota_sim_held_t;
+
+/*********************************************************************
+ * LOCAL VARIABLES
+ */
+static ota_sim_cfg_t s_cfg = {
+    .type = APP_OTA_FILE_TYPE_FULL,
+    .size = 89552,
+    .retries = 2,
+    .timeout_ms = 2000,
+    .reconnect_ms = 3000,
+    .max_sessions = 100,
+    .rtt_events = 2,
+    .idle_steps = 1,
+    .t_wrsr_us = 5000,
+    .t_pp_us = 400,
+    .t_se_us = 60000,
+    .runs = 1,
+    .seed = 1,
+};
+static ota_sim_stats_t s_stats;
+static uint32_t s_rand;
+//device
+static uint8_t  s_flash[OTA_SIM_OTA_LEN];
+static uint8_t  s_flash_erased[OTA_SIM_OTA_LEN];
+static uint8_t  s_running[OTA_SIM_RUNNING_LEN];
+static uint8_t  s_nv[OTA_SIM_NV_MAX][OTA_SIM_NV_LEN];
+static bool     s_nv_valid[OTA_SIM_NV_MAX];
+static uint16_t s_conn_interval;    //1.25ms units, requested by app_ota
+static int32_t  s_critical;
+static uint8_t  s_rsp[64];
+static uint16_t s_rsp_len;
+static bool     s_rsp_valid;
+//client
+static uint8_t* s_file;
+static uint32_t s_file_len;
+static uint8_t* s_expect;
+static uint32_t s_expect_len;
+static uint16_t s_pkg_max;
+static ota_sim_held_t s_held;
+
+/*********************************************************************
+ * LOCAL FUNCTION
+ */
+static void ota_sim_usage(void);
+static uint32_t ota_sim_rand(void);
+static bool ota_sim_chance(double p);
+static uint8_t* ota_sim_load(const char* name, uint32_t* len);
+static void ota_sim_flash_cost(uint32_t addr, uint32_t size);
+static double ota_sim_interval_ms(void);
+static void ota_sim_stall(double busy, uint64_t read);
+static void ota_sim_idle(uint32_t events);
+static bool ota_sim_deliver(tuya_ble_ota_data_type_t type, const uint8_t* buf, uint16_t len, double* busy_us);
+static uint32_t ota_sim_wait(double* busy_us);
+static void ota_sim_disconnect(void);
+static uint32_t ota_sim_exchange(tuya_ble_ota_data_type_t type, const uint8_t* buf, uint16_t len);
+static uint32_t ota_sim_command(tuya_ble_ota_data_type_t type, const uint8_t* buf, uint16_t len);
+static uint32_t ota_sim_session(void);
+static bool ota_sim_run(uint32_t run);
+static void ota_sim_report(const ota_sim_stats_t* st, uint32_t runs);
+
+/*********************************************************************
+ * VARIABLES
+ */
+int ota_sim_verbose = 0;
+
+
+
+
+/*********************************************************
+FN:
+*/
+int main(int argc, char** argv)
+{
+    static const struct option opts[] = {
+        {"file",         required_argument, NULL, 'f'},
+        {"type",         required_argument, NULL, 't'},
+        {"old",          required_argument, NULL, 'o'},
+        {"expect",       required_argument, NULL, 'e'},
+        {"size",         required_argument, NULL, 's'},
+        {"loss",         required_argument, NULL, 'L'},
+        {"dup",          required_argument, NULL, 'D'},
+        {"reorder",      required_argument, NULL, 'R'},
+        {"disconnect",   required_argument, NULL, 'X'},
+        {"oversize",     required_argument, NULL, 'O'},
+        {"retries",      required_argument, NULL, 'r'},
+        {"timeout",      required_argument, NULL, 'T'},
+        {"reconnect",    required_argument, NULL, 'C'},
+        {"sessions",     required_argument, NULL, 'S'},
+        {"interval",     required_argument, NULL, 'i'},
+        {"rtt-events",   required_argument, NULL, 'E'},
+        {"idle-steps",   required_argument, NULL, 'I'},
+        {"t-wrsr",       required_argument, NULL, 'W'},
+        {"t-pp",         required_argument, NULL, 'P'},
+        {"t-se",         required_argument, NULL, 'Z'},
+        {"runs",         required_argument, NULL, 'n'},
+        {"seed",         required_argument, NULL, 'x'},
+        {"verbose",      no_argument,       NULL, 'v'},
+        {"help",         no_argument,       NULL, 'h'},
+        {NULL, 0, NULL, 0},
+    };
+    ota_sim_stats_t total;
+    uint32_t fails = 0;
+    uint32_t run;
+    int opt;
+
+    while((opt = getopt_long(argc, argv, "f:t:o:e:s:n:x:vh", opts, NULL)) != -1)
+    {
+        switch(opt)
+        {
+            case 'f': s_cfg.file = optarg; break;
+            case 't': s_cfg.type = strtoul(optarg, NULL, 0); break;
+            case 'o': s_cfg.old = optarg; break;
+            case 'e': s_cfg.expect = optarg; break;
+            case 's': s_cfg.size = strtoul(optarg, NULL, 0); break;
+            case 'L': s_cfg.loss = atof(optarg); break;
+            case 'D': s_cfg.dup = atof(optarg); break;
+            case 'R': s_cfg.reorder = atof(optarg); break;
+            case 'X': s_cfg.disconnect = atof(optarg); break;
+            case 'O': s_cfg.oversize = atof(optarg); break;
+            case 'r': s_cfg.retries = strtoul(optarg, NULL, 0); break;
+            case 'T': s_cfg.timeout_ms = atof(optarg); break;
+            case 'C': s_cfg.reconnect_ms = atof(optarg); break;
+            case 'S': s_cfg.max_sessions = strtoul(optarg, NULL, 0); break;
+            case 'i': s_cfg.interval_ms = atof(optarg); break;
+            case 'E': s_cfg.rtt_events = strtoul(optarg, NULL, 0); break;
+            case 'I': s_cfg.idle_steps = strtoul(optarg, NULL, 0); break;
+            case 'W': s_cfg.t_wrsr_us = atof(optarg); break;
+            case 'P': s_cfg.t_pp_us = atof(optarg); break;
+            case 'Z': s_cfg.t_se_us = atof(optarg); break;
+            case 'n': s_cfg.runs = strtoul(optarg, NULL, 0); break;
+            case 'x': s_cfg.seed = strtoul(optarg, NULL, 0); break;
+            case 'v': ota_sim_verbose++; break;
+            default: ota_sim_usage(); return 2;
+        }
+    }
+    if((optind != argc) || (s_cfg.rtt_events == 0) || (s_cfg.runs == 0)
+        || ((s_cfg.type != APP_OTA_FILE_TYPE_FULL) && ((s_cfg.file == NULL) || (s_cfg.expect == NULL)))
+        || ((s_cfg.type & APP_OTA_FILE_TYPE_DELTA) && (s_cfg.old == NULL))) {
+        ota_sim_usage();
+        return 2;
+    }
+
+    //file sent, image expected in the ota area, running image
+    if(s_cfg.file != NULL) {
+        s_file = ota_sim_load(s_cfg.file, &s_file_len);
+    } else {
+        //random image, with the length field the end handler checks
+        s_file_len = s_cfg.size;
+        s_file = malloc(s_file_len);
+        s_rand = s_cfg.seed;
+        for(uint32_t idx = 0; idx < s_file_len; idx++) {
+            s_file[idx] = ota_sim_rand();
+        }
+        if(s_file_len >= 8) {
+            s_file[6] = (s_file_len/4) & 0xFF;
+            s_file[7] = (s_file_len/4) >> 8;
+        }
+    }
+    if(s_cfg.expect != NULL) {
+        s_expect = ota_sim_load(s_cfg.expect, &s_expect_len);
+    } else {
+        s_expect = s_file;
+        s_expect_len = s_file_len;
+    }
+    memset(s_running, 0xFF, sizeof(s_running));
+    if(s_cfg.old != NULL) {
+        uint32_t old_len;
+        uint8_t* old = ota_sim_load(s_cfg.old, &old_len);
+        if(old_len > sizeof(s_running)) {
+            printf("%s: larger than the app area\n", s_cfg.old);
+            return 2;
+        }
+        memcpy(s_running, old, old_len);
+    }
+    if((s_file_len == 0) || (s_file_len > OTA_SIM_OTA_LEN) || (s_expect_len > OTA_SIM_OTA_LEN)) {
+        printf("file size out of range\n");
+        return 2;
+    }
+
+    memset(&total, 0x00, sizeof(total));
+    for(run = 0; run < s_cfg.runs; run++)
+    {
+        bool ok = ota_sim_run(run);
+        fails += !ok;
+
+        total.sessions += s_stats.sessions;
+        total.disconnects += s_stats.disconnects;
+        total.timeouts += s_stats.timeouts;
+        total.errors += s_stats.errors;
+        total.lost += s_stats.lost;
+        total.dups += s_stats.dups;
+        total.late += s_stats.late;
+        total.oversized += s_stats.oversized;
+        total.resumes += s_stats.resumes;
+        total.deferred += s_stats.deferred;
+        total.data_pkgs += s_stats.data_pkgs;
+        total.data_bytes += s_stats.data_bytes;
+        total.wrsr += s_stats.wrsr;
+        total.pp += s_stats.pp;
+        total.erase += s_stats.erase;
+        total.nv_set += s_stats.nv_set;
+        total.violations += s_stats.violations;
+        total.busy_us += s_stats.busy_us;
+        total.data_busy_us += s_stats.data_busy_us;
+        if(total.stall_us < s_stats.stall_us) {
+            total.stall_us = s_stats.stall_us;
+        }
+        if(total.read_max < s_stats.read_max) {
+            total.read_max = s_stats.read_max;
+        }
+        total.time_ms += s_stats.time_ms;
+
+        if((s_cfg.runs > 1) && (ota_sim_verbose || !ok)) {
+            printf("run %3u seed %u: %s, %u sessions, %.1f s, %.2f KB/s\n", run, s_cfg.seed + run,
+                ok ? "ok" : "FAIL", s_stats.sessions, s_stats.time_ms/1000, s_file_len/s_stats.time_ms);
+        }
+    }
+
+    printf("file %u bytes, %.3f of the image, type 0x%02x, %u run(s), loss %.3f dup %.3f reorder %.3f disconnect %.3f\n",
+        s_file_len, (double)s_file_len/s_expect_len, s_cfg.type, s_cfg.runs, s_cfg.loss, s_cfg.dup, s_cfg.reorder, s_cfg.disconnect);
+    ota_sim_report(&total, s_cfg.runs);
+    printf("result: %u/%u ok\n", s_cfg.runs - fails, s_cfg.runs);
+    return (fails == 0) ? 0 : 1;
+}
+
+/*********************************************************
+FN:
+*/
+static void ota_sim_usage(void)
+{
+    printf("ota_sim.sh [options]\n"
+        "file:\n"
+        "  -f, --file FILE        ota file sent (default: random image of --size bytes)\n"
+        "  -t, --type N           file type, 0x01 delta, 0x02 compressed (default 0)\n"
+        "  -o, --old FILE         running image, required by delta\n"
+        "  -e, --expect FILE      image expected in the ota area, required when type != 0\n"
+        "  -s, --size N           random image size (default 89552)\n"
+        "link (probabilities per command):\n"
+        "      --loss P           command or response lost\n"
+        "      --dup P            command delivered twice\n"
+        "      --reorder P        data packet delivered late, after the next one\n"
+        "      --disconnect P     link lost before the command\n"
+        "      --oversize P       data packet longer than package_maxlen, must get a size error\n"
+        "client:\n"
+        "      --retries N        same command sent again N times without response (2)\n"
+        "      --timeout MS       response timeout (2000)\n"
+        "      --reconnect MS     time to reconnect after a disconnect (3000)\n"
+        "      --sessions N       give up after N sessions (100)\n"
+        "time:\n"
+        "      --interval MS      connection interval (default: as requested by app_ota)\n"
+        "      --rtt-events N     connection events per command/response (2)\n"
+        "      --idle-steps N     co_job_schedule() per connection event (1)\n"
+        "      --t-wrsr US        status register write (5000)\n"
+        "      --t-pp US          32 byte page program (400)\n"
+        "      --t-se US          sector erase (60000)\n"
+        "run:\n"
+        "  -n, --runs N           runs, seeds seed..seed+N-1 (1)\n"
+        "  -x, --seed N           (1)\n"
+        "  -v, --verbose          -v: client trace, -vv: device log too\n");
+}
+
+/*********************************************************
+FN: xorshift32, same sequence on every host
+*/
+static uint32_t ota_sim_rand(void)
+{
+    s_rand ^= s_rand << 13;
+    s_rand ^= s_rand >> 17;
+    s_rand ^= s_rand << 5;
+    return s_rand;
+}
+
+/*********************************************************
+FN:
+*/
+static bool ota_sim_chance(double p)
+{
+    return (p > 0) && ((ota_sim_rand() / 4294967296.0) < p);
+}
+
+/*********************************************************
+FN:
+*/
+static uint8_t* ota_sim_load(const char* name, uint32_t* len)
+{
+    FILE* fp = fopen(name, "rb");
+    uint8_t* buf = malloc(OTA_SIM_OTA_LEN + 1);
+
+    if((fp == NULL) || (buf == NULL)) {
+        printf("%s: cannot read\n", name);
+        exit(2);
+    }
+    *len = fread(buf, 1, OTA_SIM_OTA_LEN + 1, fp);
+    fclose(fp);
+    return buf;
+}
+
+/*********************************************************
+FN: flash_write(): split once at a 256 byte page, each part is one flash_write_data():
+    wp_NONE + wp_ALL (2 status register writes) and one page program per 32 bytes
+*/
+static void ota_sim_flash_cost(uint32_t addr, uint32_t size)
+{
+    uint32_t page_end = (addr/OTA_SIM_PAGE_SIZE + 1)*OTA_SIM_PAGE_SIZE;
+    uint32_t part[2] = {size, 0};
+
+    if(addr + size > page_end) {
+        part[0] = page_end - addr;
+        part[1] = size - part[0];
+    }
+    for(uint32_t idx = 0; idx < 2; idx++) {
+        if(part[idx] > 0) {
+            uint32_t pp = (part[idx] + OTA_SIM_PP_SIZE - 1)/OTA_SIM_PP_SIZE;
+            s_stats.wrsr += 2;
+            s_stats.pp += pp;
+            s_stats.busy_us += 2*s_cfg.t_wrsr_us + pp*s_cfg.t_pp_us;
+        }
+    }
+}
+
+/*********************************************************
+FN:
+*/
+static double ota_sim_interval_ms(void)
+{
+    if(s_cfg.interval_ms > 0) {
+        return s_cfg.interval_ms;
+    }
+    return (s_conn_interval > 0) ? s_conn_interval*1.25 : 30;
+}
+
+/*********************************************************
+FN: the radio waits for the cpu while the flash is busy, the longest wait is kept, as is
+    the most running image read in one go (not costed, the cpu time of the base image crc)
+*/
+static void ota_sim_stall(double busy, uint64_t read)
+{
+    if(s_stats.stall_us < s_stats.busy_us - busy) {
+        s_stats.stall_us = s_stats.busy_us - busy;
+    }
+    if(s_stats.read_max < s_stats.read - read) {
+        s_stats.read_max = s_stats.read - read;
+    }
+}
+
+/*********************************************************
+FN: main loop between connection events, where the background erase runs
+*/
+static void ota_sim_idle(uint32_t events)
+{
+    for(uint32_t evt = 0; evt < events; evt++) {
+        for(uint32_t idx = 0; idx < s_cfg.idle_steps; idx++) {
+            double busy = s_stats.busy_us;
+            uint64_t read = s_stats.read;
+            co_job_schedule();
+            ota_sim_stall(busy, read);
+        }
+    }
+}
+
+/*********************************************************
+FN: one command into app_ota_handler(), true if it responded (response in s_rsp)
+*/
+static bool ota_sim_deliver(tuya_ble_ota_data_type_t type, const uint8_t* buf, uint16_t len, double* busy_us)
+{
+    uint8_t cmd[OTA_SIM_CMD_LEN];
+    tuya_ble_ota_data_t ota;
+    double busy = s_stats.busy_us;
+    uint64_t read = s_stats.read;
+
+    //the handler converts fields in place
+    memcpy(cmd, buf, len);
+    ota.type = type;
+    ota.data_len = len;
+    ota.p_data = cmd;
+    s_rsp_valid = false;
+    app_ota_handler(&ota);
+    ota_sim_stall(busy, read);
+    if(busy_us != NULL) {
+        *busy_us = s_stats.busy_us - busy;
+    }
+    return s_rsp_valid;
+}
+
+/*********************************************************
+FN: idle event by event until a deferred response or the timeout, returns the events
+*/
+static uint32_t ota_sim_wait(double* busy_us)
+{
+    uint32_t max = s_cfg.timeout_ms/ota_sim_interval_ms();
+    double busy = s_stats.busy_us;
+    uint32_t events;
+
+    for(events = 0; (events < max) && !s_rsp_valid; events++) {
+        ota_sim_idle(1);
+    }
+    *busy_us += s_stats.busy_us - busy;
+    return events;
+}
+
+/*********************************************************
+FN:
+*/
+static void ota_sim_disconnect(void)
+{
+    s_stats.disconnects++;
+    s_held.countdown = 0;
+    app_ota_disconn_handler();
+    s_stats.time_ms += s_cfg.reconnect_ms;
+    ota_sim_idle(s_cfg.reconnect_ms/ota_sim_interval_ms());
+}
+
+/*********************************************************
+FN: one command and its response over the impaired link
+*/
+static uint32_t ota_sim_exchange(tuya_ble_ota_data_type_t type, const uint8_t* buf, uint16_t len)
+{
+    double interval = ota_sim_interval_ms();
+    double busy = 0;
+    double idle_busy;
+    double events;
+    uint32_t waited = 0;
+    uint8_t rsp[sizeof(s_rsp)];
+    uint16_t rsp_len;
+    bool responded;
+
+    //a late copy held back earlier arrives now, nobody waits for its response
+    if((s_held.countdown > 0) && (--s_held.countdown == 0)) {
+        s_stats.late++;
+        ota_sim_deliver(s_held.type, s_held.buf, s_held.len, NULL);
+    }
+
+    if(ota_sim_chance(s_cfg.disconnect)) {
+        if(ota_sim_verbose) {
+            printf("  link lost\n");
+        }
+        ota_sim_disconnect();
+        return OTA_SIM_LINK_DISCONNECT;
+    }
+
+    if(ota_sim_chance(s_cfg.loss)) {
+        s_stats.lost++;
+        responded = false;
+    } else if((type == TUYA_BLE_OTA_DATA) && (s_held.countdown == 0) && ota_sim_chance(s_cfg.reorder)) {
+        //delivered after the retry of this packet and the next command
+        s_held.countdown = 2;
+        s_held.type = type;
+        s_held.len = len;
+        memcpy(s_held.buf, buf, len);
+        responded = false;
+    } else {
+        responded = ota_sim_deliver(type, buf, len, &busy);
+        if(!responded) {
+            waited = ota_sim_wait(&busy);
+            responded = s_rsp_valid;
+            s_stats.deferred += responded;
+        }
+        memcpy(rsp, s_rsp, sizeof(rsp));
+        rsp_len = s_rsp_len;
+        if(ota_sim_chance(s_cfg.dup)) {
+            s_stats.dups++;
+            ota_sim_deliver(type, buf, len, NULL);
+        }
+        if(responded && ota_sim_chance(s_cfg.loss)) {
+            s_stats.lost++;
+            responded = false;
+        }
+        memcpy(s_rsp, rsp, sizeof(rsp));
+        s_rsp_len = rsp_len;
+    }
+
+    if(!responded) {
+        s_stats.timeouts++;
+        s_stats.time_ms += s_cfg.timeout_ms;
+        ota_sim_idle(s_cfg.timeout_ms/interval - waited);
+        return OTA_SIM_LINK_TIMEOUT;
+    }
+
+    //response after the handler, next command rtt_events after this one at the earliest
+    idle_busy = s_stats.busy_us;
+    ota_sim_idle(s_cfg.rtt_events);
+    busy += s_stats.busy_us - idle_busy;
+    events = waited + 1 + ceil(busy/1000/interval);
+    if(events < waited + s_cfg.rtt_events) {
+        events = waited + s_cfg.rtt_events;
+    }
+    s_stats.time_ms += events*interval;
+    if(type == TUYA_BLE_OTA_DATA) {
+        s_stats.data_busy_us += busy;
+    }
+    return OTA_SIM_LINK_OK;
+}
+
+/*********************************************************
+FN: exchange, sent again on timeout
+*/
+static uint32_t ota_sim_command(tuya_ble_ota_data_type_t type, const uint8_t* buf, uint16_t len)
+{
+    uint32_t ret = OTA_SIM_LINK_TIMEOUT;
+
+    for(uint32_t tries = 0; (tries <= s_cfg.retries) && (ret == OTA_SIM_LINK_TIMEOUT); tries++) {
+        ret = ota_sim_exchange(type, buf, len);
+    }
+    if(ret == OTA_SIM_LINK_TIMEOUT) {
+        //the app gives up and drops the link
+        if(ota_sim_verbose) {
+            printf("  no response, disconnect\n");
+        }
+        ota_sim_disconnect();
+    }
+    return ret;
+}
+
+/*********************************************************
+FN: REQ .. END, big endian fields as the app sends them
+*/
+static uint32_t ota_sim_session(void)
+{
+    uint8_t cmd[OTA_SIM_CMD_LEN];
+    uint32_t offset;
+    uint32_t old_len;
+    uint32_t old_crc;
+    uint16_t pkg_id;
+    uint8_t md5[16];
+
+    s_stats.sessions++;
+
+    //req
+    cmd[0] = 0x00;
+    if(ota_sim_command(TUYA_BLE_OTA_REQ, cmd, 1) != OTA_SIM_LINK_OK) {
+        return OTA_SIM_SESSION_DISCONNECT;
+    }
+    if(s_rsp[0] != 0x00) {
+        s_stats.errors++;
+        return OTA_SIM_SESSION_ERROR;
+    }
+    s_pkg_max = (s_rsp[7] << 8) | s_rsp[8];
+    if((s_pkg_max == 0) || (s_pkg_max > APP_OTA_PKG_LEN)) {
+        s_pkg_max = APP_OTA_PKG_LEN;
+    }
+
+    //file info
+    cpt_md5(s_file, s_file_len, md5);
+    cmd[0] = s_cfg.type;
+    memcpy(&cmd[1], TUYA_DEVICE_PID, APP_PORT_PID_LEN);
+    cmd[9] = 0; cmd[10] = 0; cmd[11] = (TUYA_DEVICE_FVER_NUM + 1) >> 8; cmd[12] = (TUYA_DEVICE_FVER_NUM + 1) & 0xFF;
+    memcpy(&cmd[13], md5, 16);
+    cmd[29] = s_file_len >> 24; cmd[30] = s_file_len >> 16; cmd[31] = s_file_len >> 8; cmd[32] = s_file_len;
+    old_crc = app_port_crc32_compute(s_file, s_file_len, NULL);
+    cmd[33] = old_crc >> 24; cmd[34] = old_crc >> 16; cmd[35] = old_crc >> 8; cmd[36] = old_crc;
+    if(ota_sim_command(TUYA_BLE_OTA_FILE_INFO, cmd, 37) != OTA_SIM_LINK_OK) {
+        return OTA_SIM_SESSION_DISCONNECT;
+    }
+    if(s_rsp[1] != 0x00) {
+        s_stats.errors++;
+        //pid/version/size refused, or the state machine was out of step (old rsp)
+        return (s_rsp_len >= 10) ? OTA_SIM_SESSION_REFUSED : OTA_SIM_SESSION_ERROR;
+    }
+
+    //offset, resume where the device stopped if it holds the same data
+    old_len = ((uint32_t)s_rsp[2] << 24) | ((uint32_t)s_rsp[3] << 16) | ((uint32_t)s_rsp[4] << 8) | s_rsp[5];
+    old_crc = ((uint32_t)s_rsp[6] << 24) | ((uint32_t)s_rsp[7] << 16) | ((uint32_t)s_rsp[8] << 8) | s_rsp[9];
+    offset = 0;
+    if((old_len > 0) && (old_len <= s_file_len) && (app_port_crc32_compute(s_file, old_len, NULL) == old_crc)) {
+        offset = old_len;
+    }
+    cmd[0] = s_cfg.type;
+    cmd[1] = offset >> 24; cmd[2] = offset >> 16; cmd[3] = offset >> 8; cmd[4] = offset;
+    if(ota_sim_command(TUYA_BLE_OTA_FILE_OFFSET_REQ, cmd, 5) != OTA_SIM_LINK_OK) {
+        return OTA_SIM_SESSION_DISCONNECT;
+    }
+    offset = ((uint32_t)s_rsp[1] << 24) | ((uint32_t)s_rsp[2] << 16) | ((uint32_t)s_rsp[3] << 8) | s_rsp[4];
+    if((s_rsp_len != 5) || (offset > s_file_len)) {
+        s_stats.errors++;
+        return OTA_SIM_SESSION_ERROR;
+    }
+    if(offset > 0) {
+        s_stats.resumes++;
+    }
+    if(ota_sim_verbose) {
+        printf("  session %u: from %u\n", s_stats.sessions, offset);
+    }
+
+    //data
+    for(pkg_id = 0; offset < s_file_len; pkg_id++)
+    {
+        uint16_t len = (s_file_len - offset < s_pkg_max) ? (s_file_len - offset) : s_pkg_max;
+        bool oversize = ota_sim_chance(s_cfg.oversize);
+        uint16_t crc;
+        uint32_t ret;
+
+        //a well formed packet (length and crc match) longer than the device asked for
+        memset(&cmd[7], 0xFF, s_pkg_max + OTA_SIM_OVERSIZE);
+        memcpy(&cmd[7], &s_file[offset], len);
+        if(oversize) {
+            len = s_pkg_max + OTA_SIM_OVERSIZE;
+        }
+        crc = app_port_crc16_compute(&cmd[7], len, NULL);
+        cmd[0] = s_cfg.type;
+        cmd[1] = pkg_id >> 8; cmd[2] = pkg_id;
+        cmd[3] = len >> 8; cmd[4] = len;
+        cmd[5] = crc >> 8; cmd[6] = crc;
+
+        s_stats.data_pkgs++;
+        s_stats.data_bytes += len;
+        ret = ota_sim_command(TUYA_BLE_OTA_DATA, cmd, 7 + len);
+        if(ret != OTA_SIM_LINK_OK) {
+            return OTA_SIM_SESSION_DISCONNECT;
+        }
+        if(oversize) {
+            s_stats.oversized++;
+            if(s_rsp[1] != 0x02) {
+                printf("data %u @%u: %u bytes, state %u instead of a size error\n", pkg_id, offset, len, s_rsp[1]);
+                s_stats.violations++;
+            }
+        }
+        if(s_rsp[1] != 0x00) {
+            if(ota_sim_verbose) {
+                printf("  data %u @%u: state %u\n", pkg_id, offset, s_rsp[1]);
+            }
+            s_stats.errors++;
+            return OTA_SIM_SESSION_ERROR;
+        }
+        offset += len;
+    }
+
+    //end
+    cmd[0] = s_cfg.type;
+    if(ota_sim_command(TUYA_BLE_OTA_END, cmd, 1) != OTA_SIM_LINK_OK) {
+        return OTA_SIM_SESSION_DISCONNECT;
+    }
+    if(s_rsp[1] != 0x00) {
+        if(ota_sim_verbose) {
+            printf("  end: state %u\n", s_rsp[1]);
+        }
+        s_stats.errors++;
+        return OTA_SIM_SESSION_ERROR;
+    }
+    return OTA_SIM_SESSION_DONE;
+}
+
+/*********************************************************
+FN: one transfer from a fresh device, true when the ota area holds the expected image
+*/
+static bool ota_sim_run(uint32_t run)
+{
+    uint32_t ret = OTA_SIM_SESSION_ERROR;
+
+    memset(&s_stats, 0x00, sizeof(s_stats));
+    memset(&s_held, 0x00, sizeof(s_held));
+    s_rand = s_cfg.seed + run;
+    if(s_rand == 0) {
+        s_rand = 1;
+    }
+
+    //flash left dirty by the previous image, no checkpoint
+    for(uint32_t idx = 0; idx < OTA_SIM_OTA_LEN; idx++) {
+        s_flash[idx] = ota_sim_rand();
+    }
+    memset(s_flash_erased, 0, sizeof(s_flash_erased));
+    memset(s_nv_valid, 0, sizeof(s_nv_valid));
+    co_job_init(false);
+    app_ota_init();
+    app_ota_disconn_handler();
+    memset(&s_stats, 0x00, sizeof(s_stats));
+
+    while((ret != OTA_SIM_SESSION_DONE) && (ret != OTA_SIM_SESSION_REFUSED) && (s_stats.sessions < s_cfg.max_sessions))
+    {
+        ret = ota_sim_session();
+        if(ret == OTA_SIM_SESSION_ERROR) {
+            //the app reports the failure and starts again
+            s_stats.time_ms += ota_sim_interval_ms();
+        }
+    }
+    if(s_critical != 0) {
+        printf("critical section not balanced: %d\n", s_critical);
+        s_stats.violations++;
+    }
+
+    if(ret != OTA_SIM_SESSION_DONE) {
+        return false;
+    }
+    if(memcmp(s_flash, s_expect, s_expect_len) != 0) {
+        printf("run %u: END accepted, but the ota area does not hold the expected image\n", run);
+        return false;
+    }
+    return (s_stats.violations == 0);
+}
+
+/*********************************************************
+FN:
+*/
+static void ota_sim_report(const ota_sim_stats_t* st, uint32_t runs)
+{
+    double interval = ota_sim_interval_ms();
+    double time_ms = st->time_ms/runs;
+    double pkgs = (st->data_pkgs > 0) ? st->data_pkgs : 1;
+
+    printf("link:    interval %.2f ms, %u events per packet, %u bytes per packet, link bound %.2f KB/s\n",
+        interval, s_cfg.rtt_events, s_pkg_max, s_pkg_max/(s_cfg.rtt_events*interval));
+    printf("session: %.1f sessions, %.1f resumed, %.1f disconnects, %.1f timeouts, %.1f error rsp (per run)\n",
+        (double)st->sessions/runs, (double)st->resumes/runs, (double)st->disconnects/runs,
+        (double)st->timeouts/runs, (double)st->errors/runs);
+    printf("         %.1f lost, %.1f duplicated, %.1f late, %.1f oversized, %.1f deferred rsp (per run)\n",
+        (double)st->lost/runs, (double)st->dups/runs, (double)st->late/runs, (double)st->oversized/runs,
+        (double)st->deferred/runs);
+    printf("data:    %.0f packets, %.0f bytes sent (%.2fx file) per run\n",
+        pkgs/runs, (double)st->data_bytes/runs, (double)st->data_bytes/runs/s_file_len);
+    printf("flash:   %.0f status register writes, %.0f page programs, %.0f sector erases, %.0f nv writes per run\n",
+        (double)st->wrsr/runs, (double)st->pp/runs, (double)st->erase/runs, (double)st->nv_set/runs);
+    printf("         busy %.2f s per run, %.2f ms per data packet, %.2f ms longest stall, %llu erase/program violations\n",
+        st->busy_us/1e6/runs, st->data_busy_us/1000/pkgs, st->stall_us/1000, (unsigned long long)st->violations);
+    printf("         %llu bytes longest running image read\n", (unsigned long long)st->read_max);
+    printf("time:    %.2f s per run, %.2f KB/s of file, %.2f KB/s of image\n",
+        time_ms/1000, s_file_len/time_ms, s_expect_len/time_ms);
+}
+
+/*********************************************************
+FN: app_port for app_ota.c
+*/
+uint32_t app_port_nv_erase(uint32_t addr, uint32_t size)
+{
+    uint32_t offset = addr - BK_FLASH_OTA_START_ADDR;
+
+    if((addr < BK_FLASH_OTA_START_ADDR) || (offset%OTA_SIM_SECTOR_SIZE != 0) || (offset + size > OTA_SIM_OTA_LEN)) {
+        printf("erase outside the ota area or not aligned: 0x%x, %u\n", addr, size);
+        s_stats.violations++;
+        return APP_PORT_ERROR_COMMON;
+    }
+    for(; size > 0; offset += OTA_SIM_SECTOR_SIZE) {
+        memset(&s_flash[offset], 0xFF, OTA_SIM_SECTOR_SIZE);
+        memset(&s_flash_erased[offset], 1, OTA_SIM_SECTOR_SIZE);
+        s_stats.erase++;
+        s_stats.wrsr += 2;
+        s_stats.busy_us += 2*s_cfg.t_wrsr_us + s_cfg.t_se_us;
+        size = (size > OTA_SIM_SECTOR_SIZE) ? (size - OTA_SIM_SECTOR_SIZE) : 0;
+    }
+    return APP_PORT_SUCCESS;
+}
+
+uint32_t app_port_nv_write(uint32_t addr, const uint8_t* p_data, uint32_t size)
+{
+    uint32_t offset = addr - BK_FLASH_OTA_START_ADDR;
+
+    if((addr < BK_FLASH_OTA_START_ADDR) || (offset + size > OTA_SIM_OTA_LEN)) {
+        printf("write outside the ota area: 0x%x, %u\n", addr, size);
+        s_stats.violations++;
+        return APP_PORT_ERROR_COMMON;
+    }
+    ota_sim_flash_cost(addr, size);
+    for(uint32_t idx = 0; idx < size; idx++, offset++) {
+        if(!s_flash_erased[offset]) {
+            if(s_stats.violations < 5) {
+                printf("write to 0x%x, not erased since the last write\n", addr + idx);
+            }
+            s_stats.violations++;
+        }
+        //nor flash only clears bits
+        s_flash[offset] &= p_data[idx];
+        s_flash_erased[offset] = 0;
+    }
+    return APP_PORT_SUCCESS;
+}
+
+uint32_t app_port_nv_read(uint32_t addr, uint8_t* p_data, uint32_t size)
+{
+    if((addr >= BK_FLASH_APP_IMAGE_ADDR) && (addr + size <= BK_FLASH_APP_END_ADDR)) {
+        memcpy(p_data, &s_running[addr - BK_FLASH_APP_IMAGE_ADDR], size);
+        s_stats.read += size;
+        return APP_PORT_SUCCESS;
+    }
+    if((addr >= BK_FLASH_OTA_START_ADDR) && (addr + size <= BK_FLASH_OTA_END_ADDR)) {
+        memcpy(p_data, &s_flash[addr - BK_FLASH_OTA_START_ADDR], size);
+        return APP_PORT_SUCCESS;
+    }
+    printf("read outside the app and ota areas: 0x%x, %u\n", addr, size);
+    s_stats.violations++;
+    return APP_PORT_ERROR_COMMON;
+}
+
+uint32_t app_port_nv_set(uint32_t area_id, uint16_t id, void *buf, uint8_t size)
+{
+    if((id >= OTA_SIM_NV_MAX) || (size > OTA_SIM_NV_LEN)) {
+        s_stats.violations++;
+        return APP_PORT_ERROR_COMMON;
+    }
+    memcpy(s_nv[id], buf, size);
+    s_nv_valid[id] = true;
+    s_stats.nv_set++;
+    //a record appended by simpleflash, costed as a plain write
+    ota_sim_flash_cost(0, size + 8);
+    return APP_PORT_SUCCESS;
+}
+
+uint32_t app_port_nv_get(uint32_t area_id, uint16_t id, void *buf, uint8_t size)
+{
+    if((id >= OTA_SIM_NV_MAX) || (size > OTA_SIM_NV_LEN) || !s_nv_valid[id]) {
+        return APP_PORT_ERROR_COMMON;
+    }
+    memcpy(buf, s_nv[id], size);
+    return APP_PORT_SUCCESS;
+}
+
+uint32_t app_port_nv_del(uint32_t area_id, uint16_t id)
+{
+    if(id < OTA_SIM_NV_MAX) {
+        s_nv_valid[id] = false;
+    }
+    return APP_PORT_SUCCESS;
+}
+
+uint32_t app_port_ota_rsp(tuya_ble_ota_data_response_t *rsp)
+{
+    s_rsp_len = (rsp->data_len < sizeof(s_rsp)) ? rsp->data_len : sizeof(s_rsp);
+    memcpy(s_rsp, rsp->p_data, s_rsp_len);
+    s_rsp_valid = true;
+    return APP_PORT_SUCCESS;
+}
+
+uint32_t app_port_conn_param_update(uint16_t cMin, uint16_t cMax, uint16_t latency, uint16_t timeout)
+{
+    s_conn_interval = cMax;
+    return APP_PORT_SUCCESS;
+}
+
+uint32_t app_port_ble_conn_evt_ext(void)
+{
+    return APP_PORT_SUCCESS;
+}
+
+uint16_t app_port_crc16_compute(uint8_t* buf, uint16_t size, uint16_t* p_crc)
+{
+    return cpt_crc16_compute(buf, size, p_crc);
+}
+
+uint32_t app_port_crc32_compute(uint8_t* buf, uint32_t size, uint32_t* p_crc)
+{
+    return cpt_crc32_compute(buf, size, p_crc);
+}
+
+void app_port_reverse_byte(void* buf, uint32_t size)
+{
+    uint8_t* p = buf;
+    for(uint32_t idx = 0; idx < size/2; idx++) {
+        uint8_t tmp = p[idx];
+        p[idx] = p[size - 1 - idx];
+        p[size - 1 - idx] = tmp;
+    }
+}
+
+tuya_ble_status_t tuya_ble_nv_read(uint32_t addr, uint8_t *p_data, uint32_t size)
+{
+    return (app_port_nv_read(addr, p_data, size) == APP_PORT_SUCCESS) ? TUYA_BLE_SUCCESS : TUYA_BLE_ERR_INTERNAL;
+}
+
+void tuya_ble_device_enter_critical(void)
+{
+    s_critical++;
+}
+
+void tuya_ble_device_exit_critical(void)
+{
+    s_critical--;
+}
+
+uint32_t lock_timer_start(lock_timer_t p_timer)
+{
+    return APP_PORT_SUCCESS;
+}
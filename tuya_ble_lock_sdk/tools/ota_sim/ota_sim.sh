@@ -0,0 +1,30 @@
+#!/bin/sh
+# Build the host OTA simulator and run it, options are passed on (ota_sim.sh -h).
+#
+#   OTA_SIM_OUT  build directory, /tmp/ota_sim by default
+#   CC           host compiler, cc by default
+#
+# app_ota*.c are compiled from a copy: a quoted include looks in the directory of the
+# including file first, the copies pick up stub/app_common.h instead of the real one.
+set -e
+
+HERE=$(cd "$(dirname "$0")" && pwd)
+SRC=$HERE/../../src
+COM=$HERE/../../../ble_3435_sdk_ext_39_0F0E/sdk/plactform/com
+MBEDTLS=$SRC/cpt/mbedtls-2.16.1
+OUT=${OTA_SIM_OUT:-/tmp/ota_sim}
+
+mkdir -p "$OUT/src"
+cp "$SRC"/app/app_common/app_ota*.[ch] "$OUT/src/"
+
+${CC:-cc} -O2 -Wall -Wno-unused-function \
+    -I"$HERE/stub" -I"$OUT/src" \
+    -I"$SRC/tuya_ble_sdk/include" -I"$SRC/bk" -I"$COM/api" \
+    -I"$SRC/cpt/cpt_math" -I"$SRC/cpt/cpt_crypto" -I"$SRC/cpt/hash" -I"$MBEDTLS/include" \
+    "$HERE/ota_sim.c" "$OUT"/src/app_ota*.c \
+    "$COM/src/co_job.c" "$COM/src/co_list.c" \
+    "$SRC/cpt/cpt_math/cpt_math.c" "$SRC/cpt/cpt_crypto/cpt_crypto.c" "$SRC/cpt/hash/hmac-sha1.c" "$SRC/cpt/hash/sha1.c" \
+    "$MBEDTLS/library/md5.c" "$MBEDTLS/library/aes.c" "$MBEDTLS/library/platform_util.c" \
+    -lm -o "$OUT/ota_sim"
+
+exec "$OUT/ota_sim" "$@"
@@ -0,0 +1,107 @@
+/**
+****************************************************************************
+* @file      app_common.h
+* @brief     ota_sim stand-in for src/app/app_common/app_common.h
+* @author    suding
+* @version   V1.0.0
+* @date      2020-05-11
+* @note      only what app_ota*.c use; app_port is implemented by ota_sim.c
+******************************************************************************
+* @attention
+*
+* <h2><center>&copy; COPYRIGHT 2020 Tuya </center></h2>
+*/
+
+
+#ifndef __APP_COMMON_H__
+#define __APP_COMMON_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*********************************************************************
+ * INCLUDES
+ */
+//c_lib
+#include "stdio.h"
+#include "stdlib.h"
+#include "stdint.h"
+#include "string.h"
+
+//tuya_ble_type.h, gcc branch
+#define __ASM __asm__
+#include "tuya_ble_type.h"
+//flash layout only, not the bk sdk behind bk_common.h
+#define __BK_COMMON_H__
+#include "bk_flash.h"
+#include "co_job.h"
+#include "cpt_math.h"
+#include "cpt_crypto.h"
+
+/*********************************************************************
+ * CONSTANTS
+ */
+#define TUYA_DEVICE_PID                  "3bmxfsql"
+#define TUYA_DEVICE_FVER_NUM             0x00000108
+
+enum {
+    APP_PORT_SUCCESS  = 0x00,
+    APP_PORT_ERROR_COMMON  = 0x01,
+};
+#define APP_PORT_PID_LEN          8
+
+extern int ota_sim_verbose;
+#define APP_DEBUG_PRINTF(...)            do { if(ota_sim_verbose > 1) { printf("    dev: "); printf(__VA_ARGS__); printf("\n"); } } while(0)
+#define APP_DEBUG_HEXDUMP(name, buf, size)
+
+//sf_port.h
+enum {
+    SF_AREA_0 = 0,
+};
+
+//app_flash.h, values only need to be distinct here
+enum {
+    NV_ID_OTA_FILE_MD5 = 0,
+    NV_ID_OTA_DATA_LEN,
+    NV_ID_OTA_DATA_CRC,
+    NV_ID_OTA_CHECKPOINT,
+    NV_ID_MAX,
+};
+
+//lock_timer.h
+typedef enum {
+    LOCK_TIMER_RESET_WITH_DISCONN = 3,
+} lock_timer_t;
+
+/*********************************************************************
+ * EXTERNAL FUNCTIONS
+ */
+uint32_t app_port_nv_set(uint32_t area_id, uint16_t id, void *buf, uint8_t size);
+uint32_t app_port_nv_get(uint32_t area_id, uint16_t id, void *buf, uint8_t size);
+uint32_t app_port_nv_del(uint32_t area_id, uint16_t id);
+uint32_t app_port_nv_write(uint32_t addr, const uint8_t* p_data, uint32_t size);
+uint32_t app_port_nv_read(uint32_t addr, uint8_t* p_data, uint32_t size);
+uint32_t app_port_nv_erase(uint32_t addr, uint32_t size);
+uint32_t app_port_ota_rsp(tuya_ble_ota_data_response_t *rsp);
+uint32_t app_port_conn_param_update(uint16_t cMin, uint16_t cMax, uint16_t latency, uint16_t timeout);
+uint32_t app_port_ble_conn_evt_ext(void);
+uint16_t app_port_crc16_compute(uint8_t* buf, uint16_t size, uint16_t* p_crc);
+uint32_t app_port_crc32_compute(uint8_t* buf, uint32_t size, uint32_t* p_crc);
+void app_port_reverse_byte(void* buf, uint32_t size);
+tuya_ble_status_t tuya_ble_nv_read(uint32_t addr, uint8_t *p_data, uint32_t size);
+void tuya_ble_device_enter_critical(void);
+void tuya_ble_device_exit_critical(void);
+uint32_t lock_timer_start(lock_timer_t p_timer);
+
+#include "app_ota.h"
+#include "app_ota_delta.h"
+#include "app_ota_unpack.h"
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //__APP_COMMON_H__
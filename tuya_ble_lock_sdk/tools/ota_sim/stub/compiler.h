@@ -0,0 +1,7 @@
+//ota_sim: host build of co_list/co_job
+#ifndef _COMPILER_H_
+#define _COMPILER_H_
+
+#define __INLINE static inline
+
+#endif //_COMPILER_H_
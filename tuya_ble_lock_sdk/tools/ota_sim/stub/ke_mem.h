@@ -0,0 +1,5 @@
+//ota_sim: host build of co_list, no kernel heap needed
+#ifndef _KE_MEM_H_
+#define _KE_MEM_H_
+
+#endif //_KE_MEM_H_
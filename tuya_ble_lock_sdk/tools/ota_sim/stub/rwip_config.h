@@ -0,0 +1,7 @@
+//ota_sim: host build of co_list/co_job, no radio
+#ifndef RWIP_CONFIG_H_
+#define RWIP_CONFIG_H_
+
+#define BLE_EMB_PRESENT 0
+
+#endif //RWIP_CONFIG_H_